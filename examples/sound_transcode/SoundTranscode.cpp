@@ -0,0 +1,110 @@
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio.hpp>
+
+#include <filesystem>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <cstdlib>
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+/// Print the command line usage
+///
+////////////////////////////////////////////////////////////
+void printUsage()
+{
+    std::cout << "Usage: sound_transcode [options] <files...>\n"
+              << "Convert sound files, writing each output next to its input.\n\n"
+              << "Options:\n"
+              << "  --format <extension>  Output format: ogg, flac or wav (default: ogg)\n"
+              << "  --quality <value>     Encoder quality in range [0, 1] (default: format default)\n"
+              << "  --threads <count>     Number of threads (default: one per hardware thread)\n"
+              << "  --chunk <seconds>     Duration of the chunks long files are split into, 0 to disable (default: 10)"
+              << std::endl;
+}
+} // namespace
+
+
+////////////////////////////////////////////////////////////
+/// Entry point of application
+///
+/// \return Application exit code
+///
+////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    std::string                               format = "ogg";
+    sf::SoundFileTranscoder                   transcoder;
+    std::vector<sf::SoundFileTranscoder::Job> jobs;
+
+    // Parse the command line
+    try
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            const std::string argument = argv[i];
+            const bool        hasValue = i + 1 < argc;
+
+            if (argument == "--format" && hasValue)
+                format = argv[++i];
+            else if (argument == "--quality" && hasValue)
+                transcoder.setQuality(std::stof(argv[++i]));
+            else if (argument == "--threads" && hasValue)
+                transcoder.setThreadCount(static_cast<unsigned int>(std::stoul(argv[++i])));
+            else if (argument == "--chunk" && hasValue)
+                transcoder.setChunkDuration(sf::seconds(std::stof(argv[++i])));
+            else if (argument.rfind("--", 0) == 0)
+                throw std::invalid_argument(argument);
+            else
+                jobs.push_back({argument, std::filesystem::path(argument).replace_extension(format)});
+        }
+
+        // Don't overwrite files that are already in the requested format
+        for (const auto& job : jobs)
+        {
+            if (job.input == job.output)
+                throw std::invalid_argument(job.input.string());
+        }
+    }
+    catch (const std::logic_error&)
+    {
+        printUsage();
+        return EXIT_FAILURE;
+    }
+
+    if (jobs.empty())
+    {
+        printUsage();
+        return EXIT_FAILURE;
+    }
+
+    // Display the progress of each file
+    std::size_t finishedCount = 0;
+    transcoder.setProgressCallback(
+        [&](const sf::SoundFileTranscoder::Progress& progress)
+        {
+            if (progress.status == sf::SoundFileTranscoder::Status::Running)
+                return;
+
+            ++finishedCount;
+            std::cout << '[' << finishedCount << '/' << jobs.size() << "] " << jobs[progress.jobIndex].input.string()
+                      << (progress.status == sf::SoundFileTranscoder::Status::Succeeded ? " -> " : " FAILED -> ")
+                      << jobs[progress.jobIndex].output.string() << std::endl;
+        });
+
+    // Convert the files
+    const sf::Clock clock;
+    const bool      succeeded = transcoder.run(jobs);
+
+    std::cout << "Converted " << jobs.size() << " files in " << clock.getElapsedTime().asSeconds() << " seconds"
+              << std::endl;
+
+    return succeeded ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -28,20 +28,32 @@
 // Headers
 ////////////////////////////////////////////////////////////
 
+#include <SFML/Audio/AudioBlock.hpp>
+#include <SFML/Audio/AudioBus.hpp>
+#include <SFML/Audio/AudioEffect.hpp>
+#include <SFML/Audio/BiquadFilter.hpp>
+#include <SFML/Audio/DelayEffect.hpp>
+#include <SFML/Audio/GainEffect.hpp>
 #include <SFML/Audio/InputSoundFile.hpp>
+#include <SFML/Audio/LimiterEffect.hpp>
 #include <SFML/Audio/Listener.hpp>
 #include <SFML/Audio/Music.hpp>
 #include <SFML/Audio/OutputSoundFile.hpp>
 #include <SFML/Audio/PlaybackDevice.hpp>
+#include <SFML/Audio/ReverbEffect.hpp>
+#include <SFML/Audio/SeekIndex.hpp>
 #include <SFML/Audio/Sound.hpp>
 #include <SFML/Audio/SoundBuffer.hpp>
 #include <SFML/Audio/SoundBufferRecorder.hpp>
+#include <SFML/Audio/SoundCommandBuffer.hpp>
 #include <SFML/Audio/SoundFileFactory.hpp>
 #include <SFML/Audio/SoundFileReader.hpp>
+#include <SFML/Audio/SoundFileTranscoder.hpp>
 #include <SFML/Audio/SoundFileWriter.hpp>
 #include <SFML/Audio/SoundRecorder.hpp>
 #include <SFML/Audio/SoundSource.hpp>
 #include <SFML/Audio/SoundStream.hpp>
+#include <SFML/Audio/VoiceManager.hpp>
 
 #include <SFML/System.hpp>
 
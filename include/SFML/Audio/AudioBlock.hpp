@@ -0,0 +1,127 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/Export.hpp>
+
+#include <cstddef>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Block of deinterleaved audio samples processed by
+///        audio effects
+///
+////////////////////////////////////////////////////////////
+class SFML_AUDIO_API AudioBlock
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Maximum number of frames in a block
+    ///
+    ////////////////////////////////////////////////////////////
+    static constexpr std::size_t MaxFrameCount{256};
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Alignment in bytes of the channel buffers of
+    ///        blocks provided by `sf::AudioBus`
+    ///
+    ////////////////////////////////////////////////////////////
+    static constexpr std::size_t Alignment{64};
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct a block from existing channel buffers
+    ///
+    /// The block does not copy the samples, the buffers must
+    /// stay alive as long as the block is used.
+    ///
+    /// \param channels     Array of \a channelCount pointers to the samples of each channel
+    /// \param channelCount Number of channels
+    /// \param frameCount   Number of frames, at most `MaxFrameCount`
+    ///
+    ////////////////////////////////////////////////////////////
+    AudioBlock(float* const* channels, unsigned int channelCount, std::size_t frameCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of channels of the block
+    ///
+    /// \return Number of channels
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getChannelCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of frames of the block
+    ///
+    /// \return Number of frames, at most `MaxFrameCount`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getFrameCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the samples of a channel
+    ///
+    /// \param channel Index of the channel
+    ///
+    /// \return Pointer to the `getFrameCount()` samples of the channel
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] float* getChannel(unsigned int channel) const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    float* const* m_channels;     //!< Pointers to the samples of each channel
+    unsigned int  m_channelCount; //!< Number of channels
+    std::size_t   m_frameCount;   //!< Number of frames
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::AudioBlock
+/// \ingroup audio
+///
+/// `sf::AudioBlock` is the unit of work of audio effects. It
+/// stores each channel in its own contiguous buffer instead of
+/// interleaving the channels frame by frame, so that effects
+/// can process a channel with a simple loop the compiler is
+/// able to vectorize.
+///
+/// Blocks handed to effects by `sf::AudioBus` never hold more
+/// than `MaxFrameCount` frames and their channel buffers are
+/// aligned to `Alignment` bytes. The number of frames may vary
+/// from one block to the next.
+///
+/// \see `sf::AudioEffect`, `sf::AudioBus`
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,218 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/Export.hpp>
+
+#include <SFML/Audio/AudioResource.hpp>
+
+#include <memory>
+
+#include <cstddef>
+
+
+namespace sf
+{
+class AudioEffect;
+
+namespace priv
+{
+class MixBus;
+}
+
+////////////////////////////////////////////////////////////
+/// \brief Mixing bus that sound sources and other buses
+///        feed into before a shared chain of effects runs
+///
+////////////////////////////////////////////////////////////
+class SFML_AUDIO_API AudioBus : AudioResource
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// The bus starts out with no effects and is routed
+    /// straight to the playback device.
+    ///
+    ////////////////////////////////////////////////////////////
+    AudioBus();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// Sound sources and buses routed into this bus are routed
+    /// straight to the playback device afterwards.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~AudioBus();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    AudioBus(const AudioBus&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    AudioBus& operator=(const AudioBus&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Append an effect to the end of the effect chain
+    ///
+    /// The effect is prepared for the format of the bus before
+    /// this function returns. An effect instance keeps state
+    /// between blocks and must only be added to a single bus.
+    ///
+    /// \param effect Effect to append
+    ///
+    /// \see `removeEffect`, `clearEffects`
+    ///
+    ////////////////////////////////////////////////////////////
+    void addEffect(std::shared_ptr<AudioEffect> effect);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove an effect from the effect chain
+    ///
+    /// \param effect Effect to remove
+    ///
+    /// \see `addEffect`, `clearEffects`
+    ///
+    ////////////////////////////////////////////////////////////
+    void removeEffect(const AudioEffect& effect);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove all effects from the effect chain
+    ///
+    /// \see `addEffect`, `removeEffect`
+    ///
+    ////////////////////////////////////////////////////////////
+    void clearEffects();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of effects in the effect chain
+    ///
+    /// \return Number of effects
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getEffectCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Route the output of the bus into another bus
+    ///
+    /// Routing a bus into itself, directly or through other
+    /// buses, is an error and leaves the routing unchanged.
+    ///
+    /// \param output Bus to feed, `nullptr` for the playback device
+    ///
+    /// \see `getOutput`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setOutput(AudioBus* output);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the bus the output of this bus is routed into
+    ///
+    /// \return Bus this bus feeds, `nullptr` for the playback device
+    ///
+    /// \see `setOutput`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] AudioBus* getOutput() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the volume of the bus output
+    ///
+    /// \param volume Volume of the bus, in the range [0, 100]
+    ///
+    /// \see `getVolume`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setVolume(float volume);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the volume of the bus output
+    ///
+    /// \return Volume of the bus, in the range [0, 100]
+    ///
+    /// \see `setVolume`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] float getVolume() const;
+
+private:
+    friend class SoundSource;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    const std::unique_ptr<priv::MixBus> m_mixBus; //!< Implementation details
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::AudioBus
+/// \ingroup audio
+///
+/// By default every sound source is mixed straight into the
+/// playback device. Routing sources into an `sf::AudioBus`
+/// mixes them together first, then runs the mix through the
+/// effect chain of the bus. An effect on a bus therefore costs
+/// the same whether one or fifty sources feed the bus.
+///
+/// Buses can feed other buses, for example a "sfx" and a
+/// "music" bus can both feed a "master" bus ending with an
+/// `sf::LimiterEffect`.
+///
+/// Effects process the mix in blocks of deinterleaved samples,
+/// see `sf::AudioBlock`. The effect chain may be edited while
+/// audio is playing. The audio thread never waits for such an
+/// edit to complete: it lets the affected blocks through
+/// unprocessed instead.
+///
+/// Usage example:
+/// \code
+/// sf::AudioBus master;
+/// master.addEffect(std::make_shared<sf::LimiterEffect>(0.9f));
+///
+/// sf::AudioBus sfx;
+/// sfx.setOutput(&master);
+/// sfx.addEffect(std::make_shared<sf::ReverbEffect>());
+///
+/// sf::Sound explosion(explosionBuffer);
+/// explosion.setBus(&sfx);
+/// explosion.play();
+/// \endcode
+///
+/// \see `sf::AudioEffect`, `sf::SoundSource`
+///
+////////////////////////////////////////////////////////////
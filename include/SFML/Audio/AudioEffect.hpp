@@ -0,0 +1,116 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/Export.hpp>
+
+
+namespace sf
+{
+class AudioBlock;
+
+////////////////////////////////////////////////////////////
+/// \brief Abstract base class for audio effects
+///
+////////////////////////////////////////////////////////////
+class SFML_AUDIO_API AudioEffect
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Virtual destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual ~AudioEffect() = default;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Prepare the effect for processing
+    ///
+    /// This function is called before the effect processes its
+    /// first block and whenever the format of the audio it
+    /// processes changes, e.g. because the playback device was
+    /// changed. It is never called concurrently with `process`,
+    /// so it is the right place to (re)allocate internal state.
+    ///
+    /// \param sampleRate   Sample rate of the audio, in samples per second
+    /// \param channelCount Number of channels of the audio
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void prepare(unsigned int sampleRate, unsigned int channelCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Process a block of audio in place
+    ///
+    /// This function is called from the audio thread. It must
+    /// not block and should not allocate memory.
+    ///
+    /// \param block Block of audio to process
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void process(AudioBlock& block) = 0;
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::AudioEffect
+/// \ingroup audio
+///
+/// `sf::AudioEffect` is the base class of all the processing
+/// nodes that can be inserted into an `sf::AudioBus`. SFML
+/// provides gain, biquad filter, delay, reverb and limiter
+/// effects, custom effects only have to override `process`
+/// and, if they keep state that depends on the sample rate
+/// or the channel count, `prepare`.
+///
+/// Parameters of an effect may be changed from any thread
+/// while the effect is processing audio. An effect instance
+/// keeps state between blocks and must therefore only be
+/// inserted into a single bus.
+///
+/// Usage example:
+/// \code
+/// class Distortion : public sf::AudioEffect
+/// {
+/// public:
+///     void process(sf::AudioBlock& block) override
+///     {
+///         for (unsigned int channel = 0; channel < block.getChannelCount(); ++channel)
+///         {
+///             float* samples = block.getChannel(channel);
+///             for (std::size_t i = 0; i < block.getFrameCount(); ++i)
+///                 samples[i] = std::clamp(samples[i] * 4.f, -1.f, 1.f);
+///         }
+///     }
+/// };
+/// \endcode
+///
+/// \see `sf::AudioBus`, `sf::AudioBlock`
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,238 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/Export.hpp>
+
+#include <SFML/Audio/AudioEffect.hpp>
+
+#include <atomic>
+#include <vector>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Second order IIR filter
+///
+////////////////////////////////////////////////////////////
+class SFML_AUDIO_API BiquadFilter : public AudioEffect
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Response of the filter
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class Type
+    {
+        LowPass,  //!< Attenuate frequencies above the cutoff frequency
+        HighPass, //!< Attenuate frequencies below the cutoff frequency
+        BandPass, //!< Only keep frequencies around the center frequency
+        Notch,    //!< Remove frequencies around the center frequency
+        Peak,     //!< Boost or cut frequencies around the center frequency
+        LowShelf, //!< Boost or cut frequencies below the corner frequency
+        HighShelf //!< Boost or cut frequencies above the corner frequency
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the filter
+    ///
+    /// \param type      Response of the filter
+    /// \param frequency Cutoff, center or corner frequency, in Hz
+    /// \param quality   Quality factor
+    /// \param gain      Boost or cut of peak and shelf filters, in dB
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit BiquadFilter(Type type = Type::LowPass, float frequency = 1000.f, float quality = 0.7071f, float gain = 0.f);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the response of the filter
+    ///
+    /// \param type Response of the filter
+    ///
+    /// \see `getType`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setType(Type type);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the response of the filter
+    ///
+    /// \return Response of the filter
+    ///
+    /// \see `setType`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Type getType() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the cutoff, center or corner frequency
+    ///
+    /// The frequency is clamped below the Nyquist frequency
+    /// when the coefficients are computed.
+    ///
+    /// \param frequency Frequency, in Hz
+    ///
+    /// \see `getFrequency`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setFrequency(float frequency);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the cutoff, center or corner frequency
+    ///
+    /// \return Frequency, in Hz
+    ///
+    /// \see `setFrequency`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] float getFrequency() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the quality factor
+    ///
+    /// Higher values make the filter more resonant or, for
+    /// band filters, narrower. The default of 0.7071 gives a
+    /// maximally flat pass band.
+    ///
+    /// \param quality Quality factor, must be greater than 0
+    ///
+    /// \see `getQuality`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setQuality(float quality);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the quality factor
+    ///
+    /// \return Quality factor
+    ///
+    /// \see `setQuality`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] float getQuality() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the gain of peak and shelf filters
+    ///
+    /// The gain has no effect on the other filter types.
+    ///
+    /// \param gain Boost (positive) or cut (negative), in dB
+    ///
+    /// \see `getGain`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setGain(float gain);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the gain of peak and shelf filters
+    ///
+    /// \return Boost or cut, in dB
+    ///
+    /// \see `setGain`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] float getGain() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Prepare the filter for processing
+    ///
+    /// \param sampleRate   Sample rate of the audio, in samples per second
+    /// \param channelCount Number of channels of the audio
+    ///
+    ////////////////////////////////////////////////////////////
+    void prepare(unsigned int sampleRate, unsigned int channelCount) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Process a block of audio in place
+    ///
+    /// \param block Block of audio to process
+    ///
+    ////////////////////////////////////////////////////////////
+    void process(AudioBlock& block) override;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Recompute the coefficients from the parameters
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateCoefficients();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Delay line of a channel
+    ///
+    ////////////////////////////////////////////////////////////
+    struct State
+    {
+        float z1{}; //!< First state variable
+        float z2{}; //!< Second state variable
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::atomic<Type>  m_type;              //!< Response of the filter
+    std::atomic<float> m_frequency;         //!< Cutoff, center or corner frequency
+    std::atomic<float> m_quality;           //!< Quality factor
+    std::atomic<float> m_gain;              //!< Gain of peak and shelf filters
+    std::atomic<bool>  m_dirty{true};       //!< Whether the coefficients must be recomputed
+    unsigned int       m_sampleRate{44100}; //!< Sample rate of the processed audio
+    float              m_b0{1.f};           //!< Feed forward coefficient
+    float              m_b1{};              //!< Feed forward coefficient
+    float              m_b2{};              //!< Feed forward coefficient
+    float              m_a1{};              //!< Feedback coefficient
+    float              m_a2{};              //!< Feedback coefficient
+    std::vector<State> m_states;            //!< Delay lines, one per channel
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::BiquadFilter
+/// \ingroup audio
+///
+/// `sf::BiquadFilter` implements the classic second order
+/// filters described in Robert Bristow-Johnson's Audio EQ
+/// Cookbook. Several filters can be chained on a bus to build
+/// an equalizer.
+///
+/// Usage example:
+/// \code
+/// // Muffle everything routed through the bus, e.g. while underwater
+/// auto muffle = std::make_shared<sf::BiquadFilter>(sf::BiquadFilter::Type::LowPass, 800.f);
+/// bus.addEffect(muffle);
+///
+/// // Later, from any thread
+/// muffle->setFrequency(20000.f);
+/// \endcode
+///
+/// \see `sf::AudioEffect`, `sf::AudioBus`
+///
+////////////////////////////////////////////////////////////
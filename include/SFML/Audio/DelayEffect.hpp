@@ -0,0 +1,170 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/Export.hpp>
+
+#include <SFML/Audio/AudioEffect.hpp>
+
+#include <SFML/System/Time.hpp>
+
+#include <atomic>
+#include <vector>
+
+#include <cstddef>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Echo effect feeding a delayed copy of the audio
+///        back into itself
+///
+////////////////////////////////////////////////////////////
+class SFML_AUDIO_API DelayEffect : public AudioEffect
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the effect
+    ///
+    /// \param maxDelay Longest delay the effect can be set to
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit DelayEffect(Time maxDelay = seconds(1.f));
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the delay between the audio and its echo
+    ///
+    /// \param delay Delay, clamped to the maximum delay given at construction
+    ///
+    /// \see `getDelay`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setDelay(Time delay);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the delay between the audio and its echo
+    ///
+    /// \return Delay
+    ///
+    /// \see `setDelay`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Time getDelay() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the amount of the echo that is fed back
+    ///
+    /// \param feedback Feedback gain [0, 1), 0 produces a single echo
+    ///
+    /// \see `getFeedback`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setFeedback(float feedback);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the amount of the echo that is fed back
+    ///
+    /// \return Feedback gain
+    ///
+    /// \see `setFeedback`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] float getFeedback() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the balance between the original audio and the echo
+    ///
+    /// \param mix Proportion of the echo in the output [0, 1]
+    ///
+    /// \see `getMix`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setMix(float mix);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the balance between the original audio and the echo
+    ///
+    /// \return Proportion of the echo in the output
+    ///
+    /// \see `setMix`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] float getMix() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Prepare the effect for processing
+    ///
+    /// \param sampleRate   Sample rate of the audio, in samples per second
+    /// \param channelCount Number of channels of the audio
+    ///
+    ////////////////////////////////////////////////////////////
+    void prepare(unsigned int sampleRate, unsigned int channelCount) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Process a block of audio in place
+    ///
+    /// \param block Block of audio to process
+    ///
+    ////////////////////////////////////////////////////////////
+    void process(AudioBlock& block) override;
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    Time                            m_maxDelay;        //!< Longest supported delay
+    std::atomic<float>              m_delay;           //!< Delay, in seconds
+    std::atomic<float>              m_feedback{0.5f};  //!< Feedback gain
+    std::atomic<float>              m_mix{0.5f};       //!< Proportion of the echo in the output
+    unsigned int                    m_sampleRate{};    //!< Sample rate of the processed audio
+    std::vector<std::vector<float>> m_lines;           //!< Circular delay lines, one per channel
+    std::size_t                     m_writePosition{}; //!< Write position in the delay lines
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::DelayEffect
+/// \ingroup audio
+///
+/// `sf::DelayEffect` repeats the audio after a configurable
+/// delay. With a non-zero feedback, every echo is fed back
+/// into the delay line and produces a decaying series of
+/// echoes.
+///
+/// The memory required by the delay lines is allocated when
+/// the effect is prepared, based on the maximum delay given
+/// at construction, so that changing the delay while audio
+/// is playing never allocates.
+///
+/// \see `sf::AudioEffect`, `sf::AudioBus`
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,107 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/Export.hpp>
+
+#include <SFML/Audio/AudioEffect.hpp>
+
+#include <atomic>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Effect that scales the amplitude of the audio
+///
+////////////////////////////////////////////////////////////
+class SFML_AUDIO_API GainEffect : public AudioEffect
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the effect
+    ///
+    /// \param gain Linear gain to apply
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit GainEffect(float gain = 1.f);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the gain
+    ///
+    /// The change is ramped over the next processed block to
+    /// avoid audible clicks.
+    ///
+    /// \param gain Linear gain to apply, 1 leaves the audio unchanged
+    ///
+    /// \see `getGain`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setGain(float gain);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the gain
+    ///
+    /// \return Linear gain applied by the effect
+    ///
+    /// \see `setGain`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] float getGain() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Process a block of audio in place
+    ///
+    /// \param block Block of audio to process
+    ///
+    ////////////////////////////////////////////////////////////
+    void process(AudioBlock& block) override;
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::atomic<float> m_gain;        //!< Requested gain
+    float              m_currentGain; //!< Gain applied at the end of the last block
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::GainEffect
+/// \ingroup audio
+///
+/// `sf::GainEffect` multiplies every sample by a gain factor.
+/// It is typically used to control the level of an
+/// `sf::AudioBus` at a specific point of its effect chain.
+///
+/// \see `sf::AudioEffect`, `sf::AudioBus`
+///
+////////////////////////////////////////////////////////////
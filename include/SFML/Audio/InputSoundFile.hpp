@@ -29,10 +29,12 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Audio/Export.hpp>
 
+#include <SFML/Audio/SeekIndex.hpp>
 #include <SFML/Audio/SoundFileReader.hpp>
 
 #include <filesystem>
 #include <memory>
+#include <optional>
 #include <vector>
 
 #include <cstddef>
@@ -258,6 +260,39 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] std::uint64_t read(std::int16_t* samples, std::uint64_t maxCount);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Provide the seek index to use for the next file opened
+    ///
+    /// The index is given to the reader by the next call to one
+    /// of the `openFrom*` functions, and then forgotten. Readers
+    /// ignore indices that were built from another file.
+    ///
+    /// For MP3 files, this avoids scanning the whole file when
+    /// opening it. For OGG/Vorbis files, seeking jumps directly
+    /// to the right page instead of bisecting the file.
+    ///
+    /// \param seekIndex Seek index, usually loaded with `sf::SeekIndex::loadFromFile`
+    ///
+    /// \see `getSeekIndex`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setSeekIndex(const SeekIndex& seekIndex);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the seek index built for the open file
+    ///
+    /// MP3 files are fully indexed when opened (or by this
+    /// function if they have a VBR header). OGG/Vorbis files
+    /// are indexed progressively while they are read. Other
+    /// formats don't need an index.
+    ///
+    /// \return Seek index of the open file, `std::nullopt` if the format doesn't provide one
+    ///
+    /// \see `setSeekIndex`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<SeekIndex> getSeekIndex() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Close the current file
     ///
@@ -291,6 +326,7 @@ private:
     std::uint64_t             m_sampleCount{};                            //!< Total number of samples in the file
     unsigned int              m_sampleRate{};                             //!< Number of samples per second
     std::vector<SoundChannel> m_channelMap; //!< The map of position in sample frame to sound channel
+    std::optional<SeekIndex>  m_seekIndex;  //!< Seek index given to the reader on the next open
 };
 
 } // namespace sf
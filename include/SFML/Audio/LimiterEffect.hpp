@@ -0,0 +1,154 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/Export.hpp>
+
+#include <SFML/Audio/AudioEffect.hpp>
+
+#include <SFML/System/Time.hpp>
+
+#include <atomic>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Effect that keeps the peak level of the audio
+///        below a threshold
+///
+////////////////////////////////////////////////////////////
+class SFML_AUDIO_API LimiterEffect : public AudioEffect
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the effect
+    ///
+    /// \param threshold Highest absolute sample value let through
+    /// \param release   Time the gain takes to recover after a peak
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit LimiterEffect(float threshold = 1.f, Time release = milliseconds(100));
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the threshold
+    ///
+    /// \param threshold Highest absolute sample value let through
+    ///
+    /// \see `getThreshold`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setThreshold(float threshold);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the threshold
+    ///
+    /// \return Highest absolute sample value let through
+    ///
+    /// \see `setThreshold`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] float getThreshold() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the release time
+    ///
+    /// \param release Time the gain takes to recover after a peak
+    ///
+    /// \see `getRelease`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setRelease(Time release);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the release time
+    ///
+    /// \return Time the gain takes to recover after a peak
+    ///
+    /// \see `setRelease`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Time getRelease() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the gain currently applied by the limiter
+    ///
+    /// \return Gain reduction, 1 when the limiter is idle
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] float getCurrentGain() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Prepare the effect for processing
+    ///
+    /// \param sampleRate   Sample rate of the audio, in samples per second
+    /// \param channelCount Number of channels of the audio
+    ///
+    ////////////////////////////////////////////////////////////
+    void prepare(unsigned int sampleRate, unsigned int channelCount) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Process a block of audio in place
+    ///
+    /// \param block Block of audio to process
+    ///
+    ////////////////////////////////////////////////////////////
+    void process(AudioBlock& block) override;
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::atomic<float> m_threshold;    //!< Highest absolute sample value let through
+    std::atomic<float> m_release;      //!< Release time, in seconds
+    std::atomic<float> m_gain{1.f};    //!< Gain applied at the end of the last block
+    unsigned int       m_sampleRate{}; //!< Sample rate of the processed audio
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::LimiterEffect
+/// \ingroup audio
+///
+/// `sf::LimiterEffect` is a peak limiter with instantaneous
+/// attack: as soon as a sample of any channel exceeds the
+/// threshold, the gain of all channels is lowered just enough
+/// to bring it back to the threshold. The gain then recovers
+/// exponentially over the release time. Since all channels
+/// share the same gain, the stereo image is preserved.
+///
+/// A limiter is usually the last effect of the bus that all
+/// other buses feed into, where it prevents clipping when
+/// many loud sounds play at once.
+///
+/// \see `sf::AudioEffect`, `sf::AudioBus`
+///
+////////////////////////////////////////////////////////////
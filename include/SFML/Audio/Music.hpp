@@ -29,6 +29,7 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Audio/Export.hpp>
 
+#include <SFML/Audio/SeekIndex.hpp>
 #include <SFML/Audio/SoundStream.hpp>
 
 #include <filesystem>
@@ -269,6 +270,33 @@ public:
     ////////////////////////////////////////////////////////////
     void setLoopPoints(TimeSpan timePoints);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Provide the seek index to use for the next file opened
+    ///
+    /// The index is used by the next call to one of the
+    /// `openFrom*` functions, and makes `setPlayingOffset`
+    /// jump directly to the right place in compressed files.
+    ///
+    /// \param seekIndex Seek index, usually loaded with `sf::SeekIndex::loadFromFile`
+    ///
+    /// \see `getSeekIndex`, `sf::InputSoundFile::setSeekIndex`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setSeekIndex(const SeekIndex& seekIndex);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the seek index built for the open file
+    ///
+    /// The index can be saved next to the music file and given
+    /// back to `setSeekIndex` the next time the file is opened.
+    ///
+    /// \return Seek index of the open file, `std::nullopt` if the format doesn't provide one
+    ///
+    /// \see `setSeekIndex`, `sf::InputSoundFile::getSeekIndex`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<SeekIndex> getSeekIndex() const;
+
 protected:
     ////////////////////////////////////////////////////////////
     /// \brief Request a new chunk of audio samples from the stream source
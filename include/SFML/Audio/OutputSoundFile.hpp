@@ -34,6 +34,7 @@
 
 #include <filesystem>
 #include <memory>
+#include <optional>
 #include <vector>
 
 #include <cstdint>
@@ -102,6 +103,22 @@ public:
     ////////////////////////////////////////////////////////////
     void write(const std::int16_t* samples, std::uint64_t count);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the quality of the encoder
+    ///
+    /// The quality applies to the files opened after this call.
+    /// It is in range [0, 1]: for lossy formats (OGG/Vorbis) it
+    /// trades file size for sound quality, for lossless formats
+    /// (FLAC) it trades encoding time for file size. Formats that
+    /// are not compressed (WAV) ignore it.
+    ///
+    /// By default, each format uses the default of its encoder.
+    ///
+    /// \param quality Encoder quality, in range [0, 1]
+    ///
+    ////////////////////////////////////////////////////////////
+    void setQuality(float quality);
+
     ////////////////////////////////////////////////////////////
     /// \brief Close the current file
     ///
@@ -112,7 +129,8 @@ private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    std::unique_ptr<SoundFileWriter> m_writer; //!< Writer that handles I/O on the file's format
+    std::unique_ptr<SoundFileWriter> m_writer;  //!< Writer that handles I/O on the file's format
+    std::optional<float>             m_quality; //!< Encoder quality, format default if not set
 };
 
 } // namespace sf
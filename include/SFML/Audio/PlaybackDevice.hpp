@@ -29,6 +29,8 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Audio/Export.hpp>
 
+#include <SFML/System/Time.hpp>
+
 #include <functional>
 #include <optional>
 #include <string>
@@ -37,6 +39,11 @@
 #include <cstdint>
 
 
+namespace sf
+{
+class OutputSoundFile;
+} // namespace sf
+
 namespace sf::PlaybackDevice
 {
 ////////////////////////////////////////////////////////////
@@ -164,11 +171,88 @@ namespace sf::PlaybackDevice
 ///
 /// \return `true`, if it was able to set the audio playback device to the null device
 ///
-/// \see `getAvailableDevices`, `getDefaultDevice`, `setDevice`, `setDeviceToDefault`
+/// \see `getAvailableDevices`, `getDefaultDevice`, `setDevice`, `setDeviceToDefault`, `setDeviceToOffline`
 ///
 ////////////////////////////////////////////////////////////
 [[nodiscard]] SFML_AUDIO_API bool setDeviceToNull();
 
+////////////////////////////////////////////////////////////
+/// \brief Switch to offline rendering
+///
+/// In offline mode no audio hardware is used and no audio
+/// thread mixes the playing sounds and music. Instead, the
+/// mix of all playing sources is produced on demand by
+/// `render`, as fast as the CPU allows. This is useful to
+/// render audio to a file, e.g. for a video, or to compare
+/// the output of automated tests with a reference.
+///
+/// Offline rendering is deterministic: given the same
+/// sources and the same sequence of calls, the rendered
+/// samples are identical from one run to the next.
+///
+/// Like the other device selection functions, this can be
+/// called while sounds are playing. Selecting any other
+/// device leaves offline mode.
+///
+/// \param channelCount Number of channels of the rendered mix
+/// \param sampleRate   Sample rate of the rendered mix, in samples per second
+///
+/// \return `true`, if it was able to switch to offline rendering
+///
+/// \see `render`, `isOffline`, `setDeviceToNull`
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] SFML_AUDIO_API bool setDeviceToOffline(unsigned int channelCount = 2, unsigned int sampleRate = 44100);
+
+////////////////////////////////////////////////////////////
+/// \brief Check if offline rendering is enabled
+///
+/// \return `true`, if offline rendering was selected with `setDeviceToOffline`
+///
+/// \see `setDeviceToOffline`
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] SFML_AUDIO_API bool isOffline();
+
+////////////////////////////////////////////////////////////
+/// \brief Render the next frames of the mix into a buffer
+///
+/// Advances all playing sources by `frameCount` frames and
+/// writes the resulting 16-bit interleaved mix to `samples`,
+/// which must have room for `frameCount * getDeviceChannelCount()`
+/// samples. Sound and music parameter changes made since the
+/// previous call are applied first.
+///
+/// This function is only available in offline mode.
+///
+/// \param samples    Buffer receiving the rendered samples
+/// \param frameCount Number of frames to render
+///
+/// \return `true` on success, `false` if offline rendering is not enabled or mixing failed
+///
+/// \see `setDeviceToOffline`
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] SFML_AUDIO_API bool render(std::int16_t* samples, std::uint64_t frameCount);
+
+////////////////////////////////////////////////////////////
+/// \brief Render the next part of the mix into a sound file
+///
+/// The file must have been opened with the channel count
+/// and sample rate passed to `setDeviceToOffline`.
+///
+/// This function is only available in offline mode.
+///
+/// \param file     Sound file receiving the rendered samples
+/// \param duration Duration of audio to render
+///
+/// \return `true` on success, `false` if offline rendering is not enabled or mixing failed
+///
+/// \see `setDeviceToOffline`
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] SFML_AUDIO_API bool render(OutputSoundFile& file, Time duration);
+
 ////////////////////////////////////////////////////////////
 /// \brief Get the name of the current audio playback device
 ///
@@ -185,6 +269,14 @@ namespace sf::PlaybackDevice
 ////////////////////////////////////////////////////////////
 [[nodiscard]] SFML_AUDIO_API std::optional<std::uint32_t> getDeviceSampleRate();
 
+////////////////////////////////////////////////////////////
+/// \brief Get the channel count of the current audio playback device
+///
+/// \return The channel count of the current audio playback device or `std::nullopt` if there is none
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] SFML_AUDIO_API std::optional<std::uint32_t> getDeviceChannelCount();
+
 ////////////////////////////////////////////////////////////
 /// \brief Check if the current playback device is the default device
 ///
@@ -0,0 +1,202 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/Export.hpp>
+
+#include <SFML/Audio/AudioEffect.hpp>
+
+#include <array>
+#include <atomic>
+#include <vector>
+
+#include <cstddef>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Algorithmic reverberation effect
+///
+////////////////////////////////////////////////////////////
+class SFML_AUDIO_API ReverbEffect : public AudioEffect
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the size of the simulated room
+    ///
+    /// Larger rooms produce longer reverberation tails.
+    ///
+    /// \param roomSize Size of the room [0, 1]
+    ///
+    /// \see `getRoomSize`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setRoomSize(float roomSize);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the simulated room
+    ///
+    /// \return Size of the room
+    ///
+    /// \see `setRoomSize`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] float getRoomSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set how quickly high frequencies die out
+    ///
+    /// \param damping Damping of high frequencies [0, 1]
+    ///
+    /// \see `getDamping`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setDamping(float damping);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get how quickly high frequencies die out
+    ///
+    /// \return Damping of high frequencies
+    ///
+    /// \see `setDamping`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] float getDamping() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the balance between the original audio and the reverberation
+    ///
+    /// \param mix Proportion of the reverberation in the output [0, 1]
+    ///
+    /// \see `getMix`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setMix(float mix);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the balance between the original audio and the reverberation
+    ///
+    /// \return Proportion of the reverberation in the output
+    ///
+    /// \see `setMix`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] float getMix() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Prepare the effect for processing
+    ///
+    /// \param sampleRate   Sample rate of the audio, in samples per second
+    /// \param channelCount Number of channels of the audio
+    ///
+    ////////////////////////////////////////////////////////////
+    void prepare(unsigned int sampleRate, unsigned int channelCount) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Process a block of audio in place
+    ///
+    /// \param block Block of audio to process
+    ///
+    ////////////////////////////////////////////////////////////
+    void process(AudioBlock& block) override;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Feedback comb filter with a damped feedback path
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Comb
+    {
+        std::vector<float> buffer;     //!< Delay line
+        std::size_t        position{}; //!< Current position in the delay line
+        float              filtered{}; //!< State of the damping low pass filter
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Schroeder all-pass filter
+    ///
+    ////////////////////////////////////////////////////////////
+    struct AllPass
+    {
+        std::vector<float> buffer;     //!< Delay line
+        std::size_t        position{}; //!< Current position in the delay line
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Filters processing a single channel
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Channel
+    {
+        std::array<Comb, 8>    combs;     //!< Parallel comb filters
+        std::array<AllPass, 4> allPasses; //!< Serial all-pass filters
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::atomic<float>   m_roomSize{0.5f}; //!< Size of the room
+    std::atomic<float>   m_damping{0.5f};  //!< Damping of high frequencies
+    std::atomic<float>   m_mix{0.3f};      //!< Proportion of the reverberation in the output
+    std::vector<Channel> m_channels;       //!< Filters, one set per channel
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::ReverbEffect
+/// \ingroup audio
+///
+/// `sf::ReverbEffect` simulates the reflections of a room
+/// using the well-known Freeverb topology: eight damped comb
+/// filters in parallel followed by four all-pass filters in
+/// series, with slightly different tunings for each channel
+/// to widen the stereo image.
+///
+/// Reverberation is comparatively expensive. Rather than
+/// giving every sound its own reverb, route all the sounds
+/// that share an acoustic space into one `sf::AudioBus` and
+/// insert a single reverb there.
+///
+/// Usage example:
+/// \code
+/// sf::AudioBus cave;
+/// auto reverb = std::make_shared<sf::ReverbEffect>();
+/// reverb->setRoomSize(0.9f);
+/// cave.addEffect(reverb);
+///
+/// for (auto& sound : caveSounds)
+///     sound.setBus(&cave);
+/// \endcode
+///
+/// \see `sf::AudioEffect`, `sf::AudioBus`
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,181 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/Export.hpp>
+
+#include <filesystem>
+#include <vector>
+
+#include <cstdint>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Table mapping sample offsets to byte offsets in
+///        a compressed sound file
+///
+////////////////////////////////////////////////////////////
+class SFML_AUDIO_API SeekIndex
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Entry of the index
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Point
+    {
+        std::uint64_t sampleOffset{}; //!< Offset of the first sample decoded from this point, channels included
+        std::uint64_t byteOffset{};   //!< Offset of the point in the encoded stream, in bytes
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Construct an empty index.
+    ///
+    ////////////////////////////////////////////////////////////
+    SeekIndex() = default;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct an index from its points
+    ///
+    /// \param streamSize  Size of the encoded stream the index was built from, in bytes
+    /// \param sampleCount Total number of samples of the stream, channels included
+    /// \param points      Points of the index, sorted by increasing sample offset
+    ///
+    ////////////////////////////////////////////////////////////
+    SeekIndex(std::uint64_t streamSize, std::uint64_t sampleCount, std::vector<Point> points);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Load an index previously saved with `saveToFile`
+    ///
+    /// \param filename Path of the index file to load
+    ///
+    /// \return `true` if loading succeeded, `false` if it failed
+    ///
+    /// \see `saveToFile`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool loadFromFile(const std::filesystem::path& filename);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Save the index to a file
+    ///
+    /// A good place for the index is next to the sound file
+    /// it was built from, for example `music.mp3.idx`.
+    ///
+    /// \param filename Path of the index file to write
+    ///
+    /// \return `true` if saving succeeded, `false` if it failed
+    ///
+    /// \see `loadFromFile`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool saveToFile(const std::filesystem::path& filename) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the encoded stream the index was built from
+    ///
+    /// Readers use it to reject indices built from another file.
+    ///
+    /// \return Size of the stream, in bytes
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::uint64_t getStreamSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the total number of samples of the stream
+    ///
+    /// \return Number of samples, channels included
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::uint64_t getSampleCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the points of the index
+    ///
+    /// \return Points sorted by increasing sample offset
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const std::vector<Point>& getPoints() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::uint64_t      m_streamSize{};  //!< Size of the indexed stream, in bytes
+    std::uint64_t      m_sampleCount{}; //!< Total number of samples of the indexed stream
+    std::vector<Point> m_points;        //!< Points sorted by sample offset
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::SeekIndex
+/// \ingroup audio
+///
+/// Seeking in compressed formats such as MP3 and OGG/Vorbis
+/// needs to know where the frame holding a given sample starts
+/// in the file. Without that knowledge the readers have to scan
+/// or bisect the file, which gets slow for long streams.
+///
+/// The MP3 reader indexes every frame when the file is opened
+/// (or on the first seek if the file has a VBR header), while
+/// the OGG/Vorbis reader records a point about every second
+/// while the file is being read. The resulting table can be
+/// retrieved with `sf::InputSoundFile::getSeekIndex` or
+/// `sf::Music::getSeekIndex`, saved next to the sound file
+/// and handed back the next time the file is opened, so that
+/// the work doesn't have to be done again.
+///
+/// Usage example:
+/// \code
+/// sf::Music music;
+///
+/// // Reuse the index saved during a previous run, if any
+/// sf::SeekIndex index;
+/// if (index.loadFromFile("music.mp3.idx"))
+///     music.setSeekIndex(index);
+///
+/// if (!music.openFromFile("music.mp3"))
+///     return -1;
+///
+/// // ...
+///
+/// // Save the index for the next run
+/// if (const std::optional<sf::SeekIndex> newIndex = music.getSeekIndex())
+///     (void)newIndex->saveToFile("music.mp3.idx");
+/// \endcode
+///
+/// \see `sf::InputSoundFile`, `sf::Music`, `sf::SoundFileReader`
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,234 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/Export.hpp>
+
+#include <SFML/System/Vector3.hpp>
+
+#include <memory>
+
+#include <cstddef>
+
+
+namespace sf
+{
+class SoundSource;
+
+////////////////////////////////////////////////////////////
+/// \brief Records changes to sound source properties and
+///        hands them to the audio thread in one batch
+///
+////////////////////////////////////////////////////////////
+class SFML_AUDIO_API SoundCommandBuffer
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    SoundCommandBuffer();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// Commands that have not been submitted are discarded.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~SoundCommandBuffer();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    SoundCommandBuffer(const SoundCommandBuffer&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    SoundCommandBuffer& operator=(const SoundCommandBuffer&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    SoundCommandBuffer(SoundCommandBuffer&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    SoundCommandBuffer& operator=(SoundCommandBuffer&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Record a change of the pitch of a sound source
+    ///
+    /// \param source Sound source to change
+    /// \param pitch  New pitch to apply to the source
+    ///
+    /// \see `SoundSource::setPitch`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setPitch(SoundSource& source, float pitch);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Record a change of the pan of a sound source
+    ///
+    /// \param source Sound source to change
+    /// \param pan    New pan to apply to the source [-1, +1]
+    ///
+    /// \see `SoundSource::setPan`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setPan(SoundSource& source, float pan);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Record a change of the volume of a sound source
+    ///
+    /// \param source Sound source to change
+    /// \param volume Volume of the source [0, 100]
+    ///
+    /// \see `SoundSource::setVolume`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setVolume(SoundSource& source, float volume);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Record a change of the 3D position of a sound source
+    ///
+    /// \param source   Sound source to change
+    /// \param position Position of the source in the scene
+    ///
+    /// \see `SoundSource::setPosition`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setPosition(SoundSource& source, const Vector3f& position);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Record a change of the 3D direction of a sound source
+    ///
+    /// \param source    Sound source to change
+    /// \param direction Direction of the source in the scene
+    ///
+    /// \see `SoundSource::setDirection`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setDirection(SoundSource& source, const Vector3f& direction);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Record a change of the 3D velocity of a sound source
+    ///
+    /// \param source   Sound source to change
+    /// \param velocity Velocity of the source in the scene
+    ///
+    /// \see `SoundSource::setVelocity`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setVelocity(SoundSource& source, const Vector3f& velocity);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Hand the recorded commands over to the audio thread
+    ///
+    /// All commands of a submitted batch are applied together,
+    /// in the order they were recorded, at the start of the next
+    /// audio callback. This function never waits for the audio
+    /// thread. The buffer is empty afterwards and can be reused
+    /// to record the next batch.
+    ///
+    /// Every source referenced by the batch must stay alive
+    /// until the batch has been submitted. Destroying a source
+    /// after submission is safe.
+    ///
+    ////////////////////////////////////////////////////////////
+    void submit();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Discard all recorded commands without submitting them
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of recorded commands
+    ///
+    /// \return Number of commands waiting to be submitted
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getCommandCount() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    struct Impl;
+    std::unique_ptr<Impl> m_impl; //!< Implementation details
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::SoundCommandBuffer
+/// \ingroup audio
+///
+/// Every setter of `sf::SoundSource` changes the underlying
+/// sound immediately, while the audio thread may be in the
+/// middle of mixing it. When many sources are updated every
+/// frame, changes made to different sources (or to different
+/// properties of the same source) can therefore end up in
+/// different audio callbacks.
+///
+/// `sf::SoundCommandBuffer` records property changes instead
+/// and submits them as a single batch. The audio thread picks
+/// up the batch without taking any lock and applies all of its
+/// commands at the start of its next callback, so the mix
+/// never contains a partially applied update. Storage of
+/// applied batches is recycled, so recording and submitting
+/// do not allocate once the buffer has warmed up.
+///
+/// The getters of `sf::SoundSource` keep returning the previous
+/// values until the batch has been applied.
+///
+/// Usage example:
+/// \code
+/// sf::SoundCommandBuffer commands;
+///
+/// // Once per frame
+/// for (auto& [sound, entity] : emitters)
+/// {
+///     commands.setPosition(sound, entity.getPosition());
+///     commands.setVelocity(sound, entity.getVelocity());
+/// }
+/// commands.submit();
+/// \endcode
+///
+/// \see `sf::SoundSource`
+///
+////////////////////////////////////////////////////////////
@@ -29,6 +29,7 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Audio/Export.hpp>
 
+#include <SFML/Audio/SeekIndex.hpp>
 #include <SFML/Audio/SoundChannel.hpp>
 
 #include <optional>
@@ -105,6 +106,38 @@ public:
     ///
     ////////////////////////////////////////////////////////////
     [[nodiscard]] virtual std::uint64_t read(std::int16_t* samples, std::uint64_t maxCount) = 0;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Provide a seek index built during a previous session
+    ///
+    /// This function is called before `open`. Readers of compressed
+    /// formats can use the index to avoid scanning the stream when
+    /// opening it or when seeking. Readers must ignore an index
+    /// that doesn't match the stream they open.
+    ///
+    /// The default implementation ignores the index.
+    ///
+    /// \param seekIndex Seek index to use
+    ///
+    /// \see `getSeekIndex`
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void setSeekIndex(const SeekIndex& seekIndex);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the seek index built by the reader
+    ///
+    /// The index can be saved and given back to `setSeekIndex`
+    /// the next time the same stream is opened.
+    ///
+    /// The default implementation returns `std::nullopt`.
+    ///
+    /// \return Seek index of the open stream, `std::nullopt` if the reader doesn't build one
+    ///
+    /// \see `setSeekIndex`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] virtual std::optional<SeekIndex> getSeekIndex();
 };
 
 } // namespace sf
@@ -0,0 +1,245 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/Export.hpp>
+
+#include <SFML/System/Time.hpp>
+
+#include <filesystem>
+#include <functional>
+#include <optional>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Convert batches of sound files in parallel
+///
+////////////////////////////////////////////////////////////
+class SFML_AUDIO_API SoundFileTranscoder
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Conversion of one sound file to another
+    ///
+    /// The formats of the input and output files are deduced
+    /// from their content and extension respectively, like
+    /// `sf::InputSoundFile` and `sf::OutputSoundFile` do.
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Job
+    {
+        std::filesystem::path input;  //!< Path of the sound file to read
+        std::filesystem::path output; //!< Path of the sound file to write
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Status of a job
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class Status
+    {
+        Running,   //!< The job is being converted
+        Succeeded, //!< The output file was written entirely
+        Failed     //!< The job failed, its output file was removed
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Progress of a job
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Progress
+    {
+        std::size_t   jobIndex{};         //!< Index of the job in the batch
+        std::uint64_t processedSamples{}; //!< Number of samples written to the output file so far
+        std::uint64_t sampleCount{};      //!< Total number of samples of the input file
+        Status        status{};           //!< Status of the job
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Callback type notified of the progress of jobs
+    ///
+    ////////////////////////////////////////////////////////////
+    using ProgressCallback = std::function<void(const Progress& progress)>;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the number of threads converting files
+    ///
+    /// The thread calling `run` is one of them. The default
+    /// value of 0 uses one thread per hardware thread.
+    ///
+    /// \param threadCount Number of threads, 0 to match the hardware
+    ///
+    /// \see `getThreadCount`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setThreadCount(unsigned int threadCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of threads converting files
+    ///
+    /// \return Number of threads, 0 to match the hardware
+    ///
+    /// \see `setThreadCount`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getThreadCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the quality of the encoders
+    ///
+    /// \param quality Encoder quality, in range [0, 1]
+    ///
+    /// \see `getQuality`, `sf::OutputSoundFile::setQuality`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setQuality(float quality);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the quality of the encoders
+    ///
+    /// \return Encoder quality, `std::nullopt` if each format uses its default
+    ///
+    /// \see `setQuality`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<float> getQuality() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the duration of the chunks large files are split into
+    ///
+    /// Input files longer than two chunks are decoded by several
+    /// threads at once, one chunk each, while the output file is
+    /// encoded sequentially as the chunks complete. This speeds up
+    /// conversions from formats that are expensive to decode.
+    /// Setting a duration of zero disables splitting.
+    ///
+    /// The default duration is 10 seconds.
+    ///
+    /// \param duration Duration of a chunk
+    ///
+    /// \see `getChunkDuration`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setChunkDuration(Time duration);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the duration of the chunks large files are split into
+    ///
+    /// \return Duration of a chunk
+    ///
+    /// \see `setChunkDuration`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Time getChunkDuration() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the function notified of the progress of jobs
+    ///
+    /// The callback is invoked from the converting threads, but
+    /// never concurrently. It is notified once when a job starts,
+    /// after each block of samples written, and once when the
+    /// job succeeds or fails.
+    ///
+    /// \param callback Progress callback, or an empty function to disable notifications
+    ///
+    ////////////////////////////////////////////////////////////
+    void setProgressCallback(ProgressCallback callback);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Convert a batch of sound files
+    ///
+    /// This function blocks until all the jobs are finished.
+    /// Jobs are independent: a failed job doesn't stop the
+    /// others.
+    ///
+    /// \param jobs Files to convert
+    ///
+    /// \return `true` if all the jobs succeeded
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool run(const std::vector<Job>& jobs) const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    unsigned int         m_threadCount{};              //!< Number of threads, 0 to match the hardware
+    std::optional<float> m_quality;                    //!< Encoder quality, format default if not set
+    Time                 m_chunkDuration{seconds(10)}; //!< Duration of the chunks large files are split into
+    ProgressCallback     m_progressCallback;           //!< Function notified of the progress of jobs
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::SoundFileTranscoder
+/// \ingroup audio
+///
+/// `sf::SoundFileTranscoder` converts many sound files at once,
+/// for example to turn the WAV files of an asset pipeline into
+/// OGG/Vorbis or FLAC files. Files are read and written with the
+/// readers and writers registered in `sf::SoundFileFactory`, so
+/// any format supported by `sf::InputSoundFile` and
+/// `sf::OutputSoundFile` can be used.
+///
+/// Jobs are spread over a pool of threads. Long input files are
+/// additionally split into chunks decoded in parallel.
+///
+/// Usage example:
+/// \code
+/// std::vector<sf::SoundFileTranscoder::Job> jobs;
+/// for (const auto& entry : std::filesystem::directory_iterator("sounds"))
+/// {
+///     if (entry.path().extension() == ".wav")
+///         jobs.push_back({entry.path(), std::filesystem::path(entry.path()).replace_extension(".ogg")});
+/// }
+///
+/// sf::SoundFileTranscoder transcoder;
+/// transcoder.setQuality(0.6f);
+/// transcoder.setProgressCallback(
+///     [&](const sf::SoundFileTranscoder::Progress& progress)
+///     {
+///         if (progress.status == sf::SoundFileTranscoder::Status::Failed)
+///             std::cerr << "Failed to convert " << jobs[progress.jobIndex].input << std::endl;
+///     });
+///
+/// if (!transcoder.run(jobs))
+///     return EXIT_FAILURE;
+/// \endcode
+///
+/// \see `sf::InputSoundFile`, `sf::OutputSoundFile`, `sf::SoundFileFactory`
+///
+////////////////////////////////////////////////////////////
@@ -76,6 +76,20 @@ public:
     ///
     ////////////////////////////////////////////////////////////
     virtual void write(const std::int16_t* samples, std::uint64_t count) = 0;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the quality of the encoder
+    ///
+    /// This function is called before `open`. The quality is in
+    /// range [0, 1]: lossy formats trade file size for sound
+    /// quality, lossless formats trade encoding time for file size.
+    ///
+    /// The default implementation ignores the quality.
+    ///
+    /// \param quality Encoder quality, in range [0, 1]
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void setQuality(float quality);
 };
 
 } // namespace sf
@@ -31,6 +31,8 @@
 
 #include <SFML/Audio/SoundChannel.hpp>
 
+#include <SFML/System/Time.hpp>
+
 #include <memory>
 #include <string>
 #include <vector>
@@ -185,6 +187,66 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] const std::vector<SoundChannel>& getChannelMap() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the interval between two calls to `onProcessSamples`
+    ///
+    /// The capture device writes its samples into an internal
+    /// buffer, which is handed over to `onProcessSamples` at
+    /// this interval. Shorter intervals reduce latency, longer
+    /// ones reduce the overhead of processing small chunks.
+    /// The internal buffer is large enough to hold several
+    /// intervals (and at least one second) of audio.
+    ///
+    /// The new interval is applied the next time the capture starts.
+    /// The default interval is 100 milliseconds.
+    ///
+    /// \param interval Processing interval
+    ///
+    /// \see `getProcessingInterval`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setProcessingInterval(Time interval);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the interval between two calls to `onProcessSamples`
+    ///
+    /// \return Processing interval
+    ///
+    /// \see `setProcessingInterval`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Time getProcessingInterval() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of overruns of the current capture
+    ///
+    /// An overrun happens when `onProcessSamples` doesn't keep
+    /// up with the capture device and the internal buffer is
+    /// full; the samples that don't fit are discarded. The
+    /// counter is reset when the capture starts.
+    ///
+    /// This function can be called from any thread.
+    ///
+    /// \return Number of overruns
+    ///
+    /// \see `getDroppedSampleCount`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::uint64_t getOverrunCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of samples discarded by overruns
+    ///
+    /// The counter is reset when the capture starts.
+    /// This function can be called from any thread.
+    ///
+    /// \return Number of discarded samples
+    ///
+    /// \see `getOverrunCount`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::uint64_t getDroppedSampleCount() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Check if the system supports audio capture
     ///
@@ -223,8 +285,9 @@ protected:
     ////////////////////////////////////////////////////////////
     /// \brief Process a new chunk of recorded samples
     ///
-    /// This virtual function is called every time a new chunk of
-    /// recorded data is available. The derived class can then do
+    /// This virtual function is called with the data recorded
+    /// during the last processing interval (see
+    /// `setProcessingInterval`). The derived class can then do
     /// whatever it wants with it (storing it, playing it, sending
     /// it over the network, etc.).
     ///
@@ -298,9 +361,12 @@ private:
 ///
 /// It is important to note that the audio capture happens in a
 /// separate thread, so that it doesn't block the rest of the
-/// program. In particular, the `onProcessSamples` virtual function
-/// (but not `onStart` and not `onStop`) will be called
-/// from this separate thread. It is important to keep this in
+/// program. The captured samples are buffered without
+/// allocating or locking on the audio thread, and handed over
+/// to a dedicated processing thread at a regular interval
+/// (see `setProcessingInterval`). The `onProcessSamples` virtual
+/// function (but not `onStart` and not `onStop`) will be called
+/// from this processing thread. It is important to keep this in
 /// mind, because you may have to take care of synchronization
 /// issues if you share data between threads.
 /// Another thing to bear in mind is that you must call `stop()`
@@ -39,6 +39,8 @@
 
 namespace sf
 {
+class AudioBus;
+
 // NOLINTBEGIN(readability-make-member-function-const)
 ////////////////////////////////////////////////////////////
 /// \brief Base class defining a sound's properties
@@ -421,6 +423,40 @@ public:
     ////////////////////////////////////////////////////////////
     void setAttenuation(float attenuation);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the priority of the sound
+    ///
+    /// When more sounds are playing than there are voices
+    /// available (see `sf::VoiceManager::setMaxVoices`), the
+    /// sounds with the lowest priority are the first to be made
+    /// virtual. Among sounds of equal priority, the quietest
+    /// ones are made virtual first.
+    /// The default value for the priority is 0.
+    ///
+    /// \param priority New priority of the sound
+    ///
+    /// \see `getPriority`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setPriority(int priority);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Route the sound into a bus
+    ///
+    /// The sound is mixed into the bus, together with all other
+    /// sources routed there, before the effects of the bus are
+    /// applied. The bus must outlive its use by the sound, or
+    /// the sound is routed back to the playback device when the
+    /// bus is destroyed.
+    /// By default, sounds are routed to the playback device.
+    ///
+    /// \param bus Bus to feed, `nullptr` for the playback device
+    ///
+    /// \see `getBus`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setBus(AudioBus* bus);
+
     ////////////////////////////////////////////////////////////
     /// \brief Set the effect processor to be applied to the sound
     ///
@@ -593,6 +629,41 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] float getAttenuation() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the priority of the sound
+    ///
+    /// \return Priority of the sound
+    ///
+    /// \see `setPriority`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] int getPriority() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the bus the sound is routed into
+    ///
+    /// \return Bus the sound feeds, `nullptr` for the playback device
+    ///
+    /// \see `setBus`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] AudioBus* getBus() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the sound is virtual
+    ///
+    /// A virtual sound is still playing and keeps advancing
+    /// its playing position, but it is not mixed into the
+    /// output because it lost its voice to a more important
+    /// sound or was culled by the `sf::VoiceManager`.
+    ///
+    /// \return `true` if the sound is virtual, `false` otherwise
+    ///
+    /// \see `sf::VoiceManager`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isVirtual() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Overload of assignment operator
     ///
@@ -656,6 +727,8 @@ protected:
     SoundSource() = default;
 
 private:
+    friend class SoundCommandBuffer;
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the sound object
     ///
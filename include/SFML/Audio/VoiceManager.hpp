@@ -0,0 +1,169 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/Export.hpp>
+
+
+////////////////////////////////////////////////////////////
+/// \brief Limits how many sounds are mixed at the same time
+///
+////////////////////////////////////////////////////////////
+namespace sf::VoiceManager
+{
+////////////////////////////////////////////////////////////
+/// \brief Set the maximum number of voices that are mixed at the same time
+///
+/// Every playing sound or music occupies a voice. When a
+/// sound starts playing while all voices are taken, the
+/// weakest playing sound is made virtual to free its voice,
+/// provided it ranks below the new sound. Otherwise the new
+/// sound starts out virtual. Sounds rank by priority first
+/// and by their estimated loudness at the listener second.
+///
+/// Virtual sounds keep their playing status and their
+/// playing position advances, but they are not mixed.
+///
+/// The default value is 0, meaning that the number of
+/// voices is unlimited.
+///
+/// \param maxVoices Maximum number of voices, 0 for no limit
+///
+/// \see `getMaxVoices`, `sf::SoundSource::setPriority`
+///
+////////////////////////////////////////////////////////////
+SFML_AUDIO_API void setMaxVoices(unsigned int maxVoices);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the maximum number of voices that are mixed at the same time
+///
+/// \return Maximum number of voices, 0 if there is no limit
+///
+/// \see `setMaxVoices`
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] SFML_AUDIO_API unsigned int getMaxVoices();
+
+////////////////////////////////////////////////////////////
+/// \brief Set the distance beyond which spatialized sounds are culled
+///
+/// Spatialized sounds that are further away from the
+/// listener than this distance are made virtual regardless
+/// of their priority. Once a voice limit or a cull distance
+/// is set, sounds whose volume or attenuation makes them
+/// inaudible are culled as well. Until then, every sound is
+/// mixed.
+///
+/// The default cull distance is the largest float value,
+/// i.e. sounds are never culled because of their distance.
+///
+/// \param distance Cull distance
+///
+/// \see `getCullDistance`
+///
+////////////////////////////////////////////////////////////
+SFML_AUDIO_API void setCullDistance(float distance);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the distance beyond which spatialized sounds are culled
+///
+/// \return Cull distance
+///
+/// \see `setCullDistance`
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] SFML_AUDIO_API float getCullDistance();
+
+////////////////////////////////////////////////////////////
+/// \brief Re-evaluate which playing sounds get a voice
+///
+/// Sounds move, change their volume and stop playing over
+/// time. Call this function regularly (e.g. once per frame)
+/// to hand the available voices to the most important
+/// sounds, cull sounds that went out of range and stop
+/// virtual sounds that would have finished playing by now.
+///
+/// Changing the volume, priority, position or attenuation
+/// of a virtual sound gives it a voice again right away if
+/// it deserves one. Other changes, such as the listener
+/// moving, are only taken into account by this function.
+///
+////////////////////////////////////////////////////////////
+SFML_AUDIO_API void update();
+
+////////////////////////////////////////////////////////////
+/// \brief Get the number of playing sounds that are being mixed
+///
+/// \return Number of active voices
+///
+/// \see `getVirtualVoiceCount`
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] SFML_AUDIO_API unsigned int getActiveVoiceCount();
+
+////////////////////////////////////////////////////////////
+/// \brief Get the number of playing sounds that are virtual
+///
+/// \return Number of virtual voices
+///
+/// \see `getActiveVoiceCount`
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] SFML_AUDIO_API unsigned int getVirtualVoiceCount();
+
+} // namespace sf::VoiceManager
+
+
+////////////////////////////////////////////////////////////
+/// \namespace sf::VoiceManager
+/// \ingroup audio
+///
+/// Mixing every playing sound gets expensive when hundreds
+/// of them overlap. `sf::VoiceManager` caps the number of
+/// sounds that are actually mixed. Sounds that don't get a
+/// voice become virtual: they keep playing silently and
+/// are brought back at the position they would have reached
+/// once a voice frees up.
+///
+/// Usage example:
+/// \code
+/// // Mix at most 32 sounds at once, cull sounds further away than 200 units
+/// sf::VoiceManager::setMaxVoices(32);
+/// sf::VoiceManager::setCullDistance(200);
+///
+/// // Make sure the voice lines are never stolen by explosions
+/// dialogue.setPriority(10);
+///
+/// // In the game loop
+/// sf::VoiceManager::update();
+/// \endcode
+///
+/// \see `sf::SoundSource::setPriority`, `sf::SoundSource::isVirtual`
+///
+////////////////////////////////////////////////////////////
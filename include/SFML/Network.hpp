@@ -28,15 +28,19 @@
 // Headers
 ////////////////////////////////////////////////////////////
 
+#include <SFML/Network/CompressedPacket.hpp>
+#include <SFML/Network/Dns.hpp>
 #include <SFML/Network/Ftp.hpp>
 #include <SFML/Network/Http.hpp>
 #include <SFML/Network/IpAddress.hpp>
 #include <SFML/Network/Packet.hpp>
+#include <SFML/Network/PacketBufferPool.hpp>
 #include <SFML/Network/Socket.hpp>
 #include <SFML/Network/SocketHandle.hpp>
 #include <SFML/Network/SocketSelector.hpp>
 #include <SFML/Network/TcpListener.hpp>
 #include <SFML/Network/TcpSocket.hpp>
+#include <SFML/Network/UdpConnection.hpp>
 #include <SFML/Network/UdpSocket.hpp>
 
 #include <SFML/System.hpp>
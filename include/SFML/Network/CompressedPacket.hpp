@@ -0,0 +1,204 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Network/Export.hpp>
+
+#include <SFML/Network/Packet.hpp>
+
+#include <vector>
+
+#include <cstddef>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Packet compressed on the wire, optionally as a
+///        delta against a baseline
+///
+////////////////////////////////////////////////////////////
+class SFML_NETWORK_API CompressedPacket : public Packet
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates an empty packet.
+    ///
+    ////////////////////////////////////////////////////////////
+    CompressedPacket() = default;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the size below which packets are sent uncompressed
+    ///
+    /// Compressing a handful of bytes costs more than it saves.
+    /// Data which doesn't shrink is always sent uncompressed.
+    /// The default threshold is 64 bytes.
+    ///
+    /// \param size Minimum size of the data to compress, in bytes
+    ///
+    /// \see `getCompressionThreshold`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setCompressionThreshold(std::size_t size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size below which packets are sent uncompressed
+    ///
+    /// \return Minimum size of the data to compress, in bytes
+    ///
+    /// \see `setCompressionThreshold`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getCompressionThreshold() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the largest size a received packet may decompress to
+    ///
+    /// Received packets claiming to be larger are rejected,
+    /// which protects against decompression bombs.
+    /// The default limit is 16 MiB.
+    ///
+    /// \param size Maximum size of the decompressed data, in bytes
+    ///
+    ////////////////////////////////////////////////////////////
+    void setMaxDecompressedSize(std::size_t size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Encode the packet as a delta against a baseline
+    ///
+    /// Once a baseline is set, only the bytes differing from
+    /// it are sent, which is very effective for successive
+    /// snapshots of a mostly unchanged state. The baseline
+    /// data is copied.
+    ///
+    /// Both ends must use the same baseline: typically the
+    /// last snapshot the receiver acknowledged. A received
+    /// delta is decoded against the receiving packet's baseline.
+    ///
+    /// \param baseline Packet whose data serves as baseline
+    ///
+    /// \see `clearBaseline`, `hasBaseline`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setBaseline(const Packet& baseline);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Stop encoding the packet as a delta
+    ///
+    /// \see `setBaseline`
+    ///
+    ////////////////////////////////////////////////////////////
+    void clearBaseline();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the packet is encoded as a delta
+    ///
+    /// \return `true` if a baseline is set
+    ///
+    /// \see `setBaseline`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool hasBaseline() const;
+
+protected:
+    ////////////////////////////////////////////////////////////
+    /// \brief Delta-encode and compress the packet data
+    ///
+    /// \param size Variable to fill with the size of data to send
+    ///
+    /// \return Pointer to the array of bytes to send
+    ///
+    ////////////////////////////////////////////////////////////
+    const void* onSend(std::size_t& size) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Decompress and delta-decode received data
+    ///
+    /// Invalid data leaves the packet empty and invalid.
+    ///
+    /// \param data Pointer to the received bytes
+    /// \param size Number of bytes
+    ///
+    ////////////////////////////////////////////////////////////
+    void onReceive(const void* data, std::size_t size) override;
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::size_t            m_compressionThreshold{64};              //!< Minimum size of the data to compress
+    std::size_t            m_maxDecompressedSize{16 * 1024 * 1024}; //!< Maximum size of received data once decompressed
+    std::vector<std::byte> m_baseline;                              //!< Data the packet is a delta against
+    bool                   m_hasBaseline{};                         //!< Whether the packet is encoded as a delta
+    std::vector<std::byte> m_scratchBuffer;                         //!< Intermediate delta or decompressed data
+    std::vector<std::byte> m_sendBuffer;                            //!< Data returned by onSend
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::CompressedPacket
+/// \ingroup network
+///
+/// `sf::CompressedPacket` is a drop-in replacement for `sf::Packet`
+/// which compresses its data when it is sent and decompresses
+/// it when it is received, through the `onSend` and `onReceive`
+/// hooks. Both ends must use it.
+///
+/// Compression uses the LZ4 block format, which is very fast
+/// and works well on the repetitive data typical of game
+/// messages. Packets smaller than the compression threshold,
+/// or which don't shrink, are sent as they are with a single
+/// byte of overhead.
+///
+/// For state replication, a packet can additionally be encoded
+/// as a delta against a baseline, usually the last snapshot
+/// acknowledged by the receiver. Only the ranges of bytes which
+/// changed are then sent, before being compressed.
+///
+/// Usage example:
+/// \code
+/// // Sender
+/// sf::CompressedPacket packet;
+/// packet.setBaseline(lastAcknowledgedSnapshot);
+/// packet << world;
+/// socket.send(packet);
+///
+/// // Receiver
+/// sf::CompressedPacket packet;
+/// packet.setBaseline(lastAcknowledgedSnapshot);
+/// socket.receive(packet);
+/// packet >> world;
+/// \endcode
+///
+/// \see `sf::Packet`
+///
+////////////////////////////////////////////////////////////
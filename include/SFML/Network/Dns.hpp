@@ -0,0 +1,215 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Network/Export.hpp>
+
+#include <SFML/Network/IpAddress.hpp>
+
+#include <SFML/System/Time.hpp>
+
+#include <functional>
+#include <future>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Resolve host names asynchronously, and cache the results
+///
+////////////////////////////////////////////////////////////
+namespace Dns
+{
+////////////////////////////////////////////////////////////
+/// \brief Host name currently held by the cache
+///
+////////////////////////////////////////////////////////////
+struct CacheEntry
+{
+    std::string name;       //!< Host name, in lower case
+    IpAddress   address;    //!< Address the name resolved to
+    Time        timeToLive; //!< Time left before the entry expires
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Callback type notified of the result of an asynchronous resolution
+///
+////////////////////////////////////////////////////////////
+using ResolveCallback = std::function<void(std::optional<IpAddress> address)>;
+
+////////////////////////////////////////////////////////////
+/// \brief Resolve an address without blocking the calling thread
+///
+/// This function accepts the same strings as `IpAddress::resolve`.
+/// Host names are looked up by a small pool of background
+/// threads; concurrent requests for the same name share a
+/// single lookup.
+///
+/// \param address IP address or network name
+///
+/// \return Future holding the address if it could be resolved, otherwise `std::nullopt`
+///
+/// \see `IpAddress::resolve`
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] SFML_NETWORK_API std::future<std::optional<IpAddress>> resolveAsync(std::string_view address);
+
+////////////////////////////////////////////////////////////
+/// \brief Resolve an address without blocking the calling thread, and call a function with the result
+///
+/// The callback is called from a resolver thread once the
+/// lookup is over. When the address can be resolved without a
+/// lookup (literal address, host entry or cached name), it is
+/// called directly from this function instead.
+///
+/// \param address  IP address or network name
+/// \param callback Function to call with the result
+///
+/// \see `IpAddress::resolve`
+///
+////////////////////////////////////////////////////////////
+SFML_NETWORK_API void resolveAsync(std::string_view address, ResolveCallback callback);
+
+////////////////////////////////////////////////////////////
+/// \brief Set how long resolved host names are kept in the cache
+///
+/// The system resolver doesn't report the time to live of the
+/// DNS records, so the same duration is used for every name.
+/// Names that couldn't be resolved are never cached. A
+/// duration of `Time::Zero` disables the cache. The default
+/// duration is 60 seconds.
+///
+/// \param timeToLive Time during which a resolved name is reused
+///
+/// \see `getCacheTimeToLive`, `clearCache`
+///
+////////////////////////////////////////////////////////////
+SFML_NETWORK_API void setCacheTimeToLive(Time timeToLive);
+
+////////////////////////////////////////////////////////////
+/// \brief Get how long resolved host names are kept in the cache
+///
+/// \return Time during which a resolved name is reused
+///
+/// \see `setCacheTimeToLive`
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] SFML_NETWORK_API Time getCacheTimeToLive();
+
+////////////////////////////////////////////////////////////
+/// \brief Remove all the host names from the cache
+///
+/// Host entries added with `addHostEntry` are not affected.
+///
+/// \see `getCacheEntries`
+///
+////////////////////////////////////////////////////////////
+SFML_NETWORK_API void clearCache();
+
+////////////////////////////////////////////////////////////
+/// \brief Get the host names currently held by the cache
+///
+/// Expired entries are not returned.
+///
+/// \return Cached host names, sorted by name
+///
+/// \see `clearCache`
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] SFML_NETWORK_API std::vector<CacheEntry> getCacheEntries();
+
+////////////////////////////////////////////////////////////
+/// \brief Map a host name to a fixed address
+///
+/// Host entries play the role of the system's hosts file: they
+/// take precedence over the cache and the system resolver,
+/// and never expire. Host names are case insensitive.
+///
+/// \param name    Host name
+/// \param address Address to return for this name
+///
+/// \see `clearHostEntries`
+///
+////////////////////////////////////////////////////////////
+SFML_NETWORK_API void addHostEntry(std::string_view name, IpAddress address);
+
+////////////////////////////////////////////////////////////
+/// \brief Remove all the host entries
+///
+/// \see `addHostEntry`
+///
+////////////////////////////////////////////////////////////
+SFML_NETWORK_API void clearHostEntries();
+} // namespace Dns
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \namespace sf::Dns
+/// \ingroup network
+///
+/// `sf::Dns` keeps the host names resolved by
+/// `sf::IpAddress::resolve` in an in-process cache, so that
+/// connecting to the same server again doesn't wait for
+/// the DNS servers. It also provides asynchronous versions
+/// of `sf::IpAddress::resolve`, which run the lookups on a
+/// small pool of background threads, so that a slow DNS
+/// server doesn't freeze the calling thread.
+///
+/// Usage example:
+/// \code
+/// // Start the lookup, and keep updating the application meanwhile
+/// std::future<std::optional<sf::IpAddress>> address = sf::Dns::resolveAsync("www.sfml-dev.org");
+///
+/// while (address.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+///     update();
+///
+/// if (const std::optional<sf::IpAddress> result = address.get())
+///     socket.connect(*result, 80);
+///
+/// // Or get the result in a callback
+/// sf::Dns::resolveAsync("www.sfml-dev.org",
+///                       [](std::optional<sf::IpAddress> result)
+///                       {
+///                           if (result)
+///                               std::cout << "Resolved to " << *result << std::endl;
+///                       });
+///
+/// // Point a name to a test server, like the hosts file would
+/// sf::Dns::addHostEntry("game.example.com", sf::IpAddress::LocalHost);
+/// \endcode
+///
+/// \see `sf::IpAddress`
+///
+////////////////////////////////////////////////////////////
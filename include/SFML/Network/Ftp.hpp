@@ -34,9 +34,13 @@
 #include <SFML/System/Time.hpp>
 
 #include <filesystem>
+#include <functional>
 #include <string>
 #include <vector>
 
+#include <cstddef>
+#include <cstdint>
+
 
 namespace sf
 {
@@ -60,6 +64,24 @@ public:
         Ebcdic  //!< Text mode using EBCDIC encoding
     };
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Progress of a data transfer
+    ///
+    ////////////////////////////////////////////////////////////
+    struct TransferProgress
+    {
+        std::uint64_t transferredBytes{}; //!< Number of bytes transferred so far
+        std::uint64_t totalBytes{};       //!< Total number of bytes to transfer, 0 if unknown
+        Time          elapsedTime;        //!< Time elapsed since the transfer started
+        float         bytesPerSecond{};   //!< Average throughput since the transfer started
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Callback type notified of the progress of data transfers
+    ///
+    ////////////////////////////////////////////////////////////
+    using ProgressCallback = std::function<void(const TransferProgress& progress)>;
+
     ////////////////////////////////////////////////////////////
     /// \brief FTP response
     ///
@@ -457,6 +479,46 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] Response deleteFile(const std::filesystem::path& name);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the size of the buffer used by data transfers
+    ///
+    /// Larger buffers move the same amount of data with fewer
+    /// system calls, which matters for large files. The default
+    /// size is 256 KiB. The progress callback is called once per
+    /// buffer transferred.
+    ///
+    /// \param size Size of the buffer, in bytes
+    ///
+    /// \see `getTransferBufferSize`, `setProgressCallback`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTransferBufferSize(std::size_t size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the buffer used by data transfers
+    ///
+    /// \return Size of the buffer, in bytes
+    ///
+    /// \see `setTransferBufferSize`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getTransferBufferSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the function notified of the progress of data transfers
+    ///
+    /// The callback is called from the thread running the
+    /// transfer, each time a buffer of data was transferred (or
+    /// once for an empty file). It applies to downloads and
+    /// uploads; directory listings are not reported.
+    ///
+    /// \param callback Function to call, or an empty function to disable progress reports
+    ///
+    /// \see `setTransferBufferSize`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setProgressCallback(ProgressCallback callback);
+
     ////////////////////////////////////////////////////////////
     /// \brief Download a file from the server
     ///
@@ -468,6 +530,10 @@ public:
     /// already exists in the local destination path, it will
     /// be overwritten.
     ///
+    /// The data is written straight to the file, without going
+    /// through a C++ stream, using buffers of the size given to
+    /// `setTransferBufferSize`.
+    ///
     /// \param remoteFile File name of the distant file to download
     /// \param localPath  The directory in which to put the file on the local computer
     /// \param mode       Transfer mode
@@ -492,6 +558,11 @@ public:
     /// The append parameter controls whether the remote file is
     /// appended to or overwritten if it already exists.
     ///
+    /// On Linux, the file is sent with `sendfile`, which copies
+    /// it from the disk to the network without going through
+    /// the application. Other systems read it using buffers of
+    /// the size given to `setTransferBufferSize`.
+    ///
     /// \param localFile  Path of the local file to upload
     /// \param remotePath The directory in which to put the file on the server
     /// \param mode       Transfer mode
@@ -549,8 +620,10 @@ private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    TcpSocket   m_commandSocket; //!< Socket holding the control connection with the server
-    std::string m_receiveBuffer; //!< Received command data that is yet to be processed
+    TcpSocket        m_commandSocket;                  //!< Socket holding the control connection with the server
+    std::string      m_receiveBuffer;                  //!< Received command data that is yet to be processed
+    std::size_t      m_transferBufferSize{256 * 1024}; //!< Size of the buffer used by data transfers
+    ProgressCallback m_progressCallback;               //!< Function notified of the progress of data transfers
 };
 
 } // namespace sf
@@ -34,10 +34,17 @@
 
 #include <SFML/System/Time.hpp>
 
+#include <functional>
+#include <future>
 #include <iosfwd>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
+#include <vector>
+
+#include <cstddef>
 
 
 namespace sf
@@ -335,11 +342,33 @@ public:
         std::string  m_body;                             //!< Body of the response
     };
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Function called with the header of a streamed response
+    ///
+    /// Returning `false` stops the transfer.
+    ///
+    ////////////////////////////////////////////////////////////
+    using HeaderCallback = std::function<bool(const Response& response)>;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Function called with each part of the body of a streamed response
+    ///
+    /// Returning `false` stops the transfer.
+    ///
+    ////////////////////////////////////////////////////////////
+    using BodyCallback = std::function<bool(const void* data, std::size_t size)>;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Function called with the response to an asynchronous request
+    ///
+    ////////////////////////////////////////////////////////////
+    using CompletionCallback = std::function<void(Response response)>;
+
     ////////////////////////////////////////////////////////////
     /// \brief Default constructor
     ///
     ////////////////////////////////////////////////////////////
-    Http() = default;
+    Http();
 
     ////////////////////////////////////////////////////////////
     /// \brief Construct the HTTP client with the target host
@@ -357,6 +386,14 @@ public:
     ////////////////////////////////////////////////////////////
     Http(const std::string& host, unsigned short port = 0);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// Closes the connections kept alive.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~Http();
+
     ////////////////////////////////////////////////////////////
     /// \brief Deleted copy constructor
     ///
@@ -389,6 +426,66 @@ public:
     ////////////////////////////////////////////////////////////
     bool setHost(const std::string& host, unsigned short port = 0);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable persistent connections
+    ///
+    /// When keep-alive is enabled, connections to the host are
+    /// kept open after a request completes and reused by the
+    /// following requests, saving the TCP (and TLS) setup of
+    /// each new connection. Requests which don't set the
+    /// "Connection" field ask the server to keep the connection
+    /// alive. Connections the server closes in the meantime are
+    /// transparently replaced.
+    ///
+    /// Keep-alive is disabled by default. Disabling it closes
+    /// the connections currently kept alive.
+    ///
+    /// \param keepAlive `true` to keep connections alive, `false` to close them after each request
+    ///
+    /// \see `isKeepAliveEnabled`, `setMaxIdleConnections`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setKeepAlive(bool keepAlive);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether persistent connections are enabled
+    ///
+    /// \return `true` if connections are kept alive between requests
+    ///
+    /// \see `setKeepAlive`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isKeepAliveEnabled() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the maximum number of idle connections kept alive
+    ///
+    /// Each thread sending a request at the same time uses its
+    /// own connection. Once the requests complete, at most this
+    /// many connections are kept for the next requests, the
+    /// others are closed. The default is 4.
+    ///
+    /// \param count Maximum number of idle connections
+    ///
+    /// \see `setKeepAlive`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setMaxIdleConnections(std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the maximum number of connections used at the same time by asynchronous requests
+    ///
+    /// Asynchronous requests beyond this limit wait for one of
+    /// the connections to be done. The default is 6, at least
+    /// one connection is always allowed.
+    ///
+    /// \param count Maximum number of concurrent connections
+    ///
+    /// \see `sendRequestAsync`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setMaxConnections(std::size_t count);
+
     ////////////////////////////////////////////////////////////
     /// \brief Send a HTTP request and return the server's response.
     ///
@@ -410,14 +507,226 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] Response sendRequest(const Request& request, Time timeout = Time::Zero, bool verifyServer = true) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Send a HTTP request and stream the server's response
+    ///
+    /// Instead of accumulating the whole response in memory,
+    /// the header is passed to `onHeader` as soon as it is
+    /// received, then the body is passed to `onBody` piece by
+    /// piece as it arrives. Chunked bodies are decoded on the
+    /// fly, so `onBody` only ever receives the actual content.
+    /// The memory used doesn't depend on the size of the body,
+    /// which makes this function suitable for downloading
+    /// large files.
+    ///
+    /// Either callback can return `false` to stop the transfer,
+    /// in which case the connection is closed. Either can also
+    /// be empty.
+    ///
+    /// The returned response has an empty body. Its fields
+    /// include the trailer fields which may follow a chunked
+    /// body. If the connection is lost before the body is
+    /// complete, the transfer ends with what was received.
+    ///
+    /// \param request      Request to send
+    /// \param onHeader     Function called with the response once its header is received
+    /// \param onBody       Function called with each part of the body
+    /// \param timeout      Maximum time to wait
+    /// \param verifyServer Verify the server if using HTTPS
+    ///
+    /// \return Server's response, without its body
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Response sendRequest(const Request&        request,
+                                       const HeaderCallback& onHeader,
+                                       const BodyCallback&   onBody,
+                                       Time                  timeout      = Time::Zero,
+                                       bool                  verifyServer = true) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Send a HTTP request and write the body of the server's response to a stream
+    ///
+    /// This is a shortcut for streaming the body of the
+    /// response to `body`, such as a `std::ofstream`, as it
+    /// arrives. The body is written whatever the status of the
+    /// response, so check it before relying on what was
+    /// written. The transfer stops if writing to `body` fails.
+    ///
+    /// \param request      Request to send
+    /// \param body         Stream receiving the body of the response
+    /// \param timeout      Maximum time to wait
+    /// \param verifyServer Verify the server if using HTTPS
+    ///
+    /// \return Server's response, without its body
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Response sendRequest(const Request& request,
+                                       std::ostream&  body,
+                                       Time           timeout      = Time::Zero,
+                                       bool           verifyServer = true) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Send several HTTP requests at once and return the server's responses
+    ///
+    /// The requests are pipelined: they are all written to a
+    /// single connection before the first response is read,
+    /// which saves a round trip per request. Responses are
+    /// returned in the order of the requests. If the server
+    /// closes the connection before answering all of them,
+    /// the remaining requests are sent again on a new
+    /// connection.
+    ///
+    /// As with `sendRequest`, missing mandatory header fields
+    /// are added to the requests. Since pipelining relies on
+    /// persistent connections, the requests ask the server to
+    /// keep the connection alive, except for the last one
+    /// if keep-alive is disabled.
+    ///
+    /// Only pipeline requests which the server may safely
+    /// receive again, such as GET requests.
+    ///
+    /// \param requests     Requests to send
+    /// \param timeout      Maximum time to wait
+    /// \param verifyServer Verify the server if using HTTPS
+    ///
+    /// \return Server's responses, one per request
+    ///
+    /// \see `sendRequest`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::vector<Response> sendRequests(const std::vector<Request>& requests,
+                                                     Time                        timeout      = Time::Zero,
+                                                     bool                        verifyServer = true) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Send a HTTP request without waiting for the server's response
+    ///
+    /// The request is sent in the background and the returned
+    /// future receives the response once it has arrived. Many
+    /// requests can be in flight at once: they are all driven
+    /// by a single thread using non-blocking sockets, with up
+    /// to `setMaxConnections` connections to the host at the
+    /// same time. Connections kept alive are shared with the
+    /// blocking functions.
+    ///
+    /// Unlike with `sendRequest`, `timeout` limits the whole
+    /// request, from the moment it is sent until its response
+    /// is complete. A request which runs out of time completes
+    /// with the `Response::Status::ConnectionFailed` status.
+    ///
+    /// The host must not be changed while asynchronous requests
+    /// are pending. Destroying the `sf::Http` instance completes
+    /// the pending requests with the
+    /// `Response::Status::ConnectionFailed` status.
+    ///
+    /// \param request      Request to send
+    /// \param timeout      Maximum time the request may take, `Time::Zero` for no limit
+    /// \param verifyServer Verify the server if using HTTPS
+    ///
+    /// \return Future receiving the server's response
+    ///
+    /// \see `setMaxConnections`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::future<Response> sendRequestAsync(const Request& request,
+                                                         Time           timeout      = Time::Zero,
+                                                         bool           verifyServer = true) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Send a HTTP request and call a function with the server's response
+    ///
+    /// This works like the overload returning a future, except
+    /// that `onComplete` is called with the response once it
+    /// has arrived. It is called from the thread driving the
+    /// asynchronous requests, so it should return quickly. It
+    /// may send other requests, but must not destroy the
+    /// `sf::Http` instance.
+    ///
+    /// \param request      Request to send
+    /// \param onComplete   Function called with the server's response
+    /// \param timeout      Maximum time the request may take, `Time::Zero` for no limit
+    /// \param verifyServer Verify the server if using HTTPS
+    ///
+    /// \see `setMaxConnections`
+    ///
+    ////////////////////////////////////////////////////////////
+    void sendRequestAsync(const Request&     request,
+                          CompletionCallback onComplete,
+                          Time               timeout      = Time::Zero,
+                          bool               verifyServer = true) const;
+
 private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Connection to the host
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Connection;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Event loop driving the asynchronous requests
+    ///
+    ////////////////////////////////////////////////////////////
+    struct AsyncLoop;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add the missing mandatory fields to a request
+    ///
+    /// \param request   Request to complete
+    /// \param keepAlive `true` to ask the server to keep the connection alive
+    ///
+    /// \return Request ready to be sent
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Request completeRequest(const Request& request, bool keepAlive) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get an idle connection to the host, or open a new one
+    ///
+    /// \param timeout      Maximum time to wait for a new connection
+    /// \param verifyServer Verify the server if using HTTPS
+    ///
+    /// \return Connection to the host, or a null pointer if connecting failed
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::unique_ptr<Connection> acquireConnection(Time timeout, bool verifyServer) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get an idle connection to the host
+    ///
+    /// \param verifyServer Whether the connection must be to a verified server
+    ///
+    /// \return Idle connection, or a null pointer if none is available
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::unique_ptr<Connection> takeIdleConnection(bool verifyServer) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Keep a connection for the next requests
+    ///
+    /// \param connection Connection whose last response is complete
+    ///
+    ////////////////////////////////////////////////////////////
+    void releaseConnection(std::unique_ptr<Connection> connection) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Close all the idle connections
+    ///
+    ////////////////////////////////////////////////////////////
+    void closeIdleConnections();
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    std::optional<IpAddress> m_host;     //!< Web host address
-    std::string              m_hostName; //!< Web host name
-    unsigned short           m_port{};   //!< Port used for connection with host
-    bool                     m_https{};  //!< Use HTTPS
+    std::optional<IpAddress>                         m_host;                  //!< Web host address
+    std::string                                      m_hostName;              //!< Web host name
+    unsigned short                                   m_port{};                //!< Port used for connection with host
+    bool                                             m_https{};               //!< Use HTTPS
+    bool                                             m_keepAlive{};           //!< Keep connections alive
+    std::size_t                                      m_maxIdleConnections{4}; //!< Maximum number of idle connections
+    std::size_t                                      m_maxConnections{6};     //!< Maximum number of async connections
+    mutable std::mutex                               m_connectionMutex;       //!< Protects the connections
+    mutable std::vector<std::unique_ptr<Connection>> m_idleConnections;       //!< Connections waiting for a request
+    mutable std::unique_ptr<AsyncLoop>               m_asyncLoop;             //!< Drives the asynchronous requests
 };
 
 } // namespace sf
@@ -455,6 +764,21 @@ private:
 /// `sf::Http::Request` and return the corresponding `sf::Http::Response`
 /// from the server.
 ///
+/// When many requests are sent to the same host, enabling
+/// keep-alive with `setKeepAlive` reuses connections instead
+/// of opening a new one per request, and `sendRequests`
+/// pipelines several requests on a single connection.
+/// `sendRequestAsync` sends requests in the background, many of
+/// them being able to wait for their response at the same time.
+///
+/// Large resources can be downloaded without holding them in
+/// memory, by streaming the body of the response to a callback
+/// or a `std::ostream` as it arrives:
+/// \code
+/// std::ofstream file("patch.bin", std::ios::binary);
+/// sf::Http::Response response = http.sendRequest(sf::Http::Request("/patch.bin"), file);
+/// \endcode
+///
 /// Usage example:
 /// \code
 /// // Create a new HTTP client
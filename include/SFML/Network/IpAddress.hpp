@@ -31,6 +31,7 @@
 
 #include <SFML/System/Time.hpp>
 
+#include <array>
 #include <iosfwd>
 #include <optional>
 #include <string>
@@ -42,22 +43,46 @@
 namespace sf
 {
 ////////////////////////////////////////////////////////////
-/// \brief Encapsulate an IPv4 network address
+/// \brief Encapsulate an IPv4 or IPv6 network address
 ///
 ////////////////////////////////////////////////////////////
 class SFML_NETWORK_API IpAddress
 {
 public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Family of an address
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class Type
+    {
+        IpV4, //!< 32-bit IPv4 address
+        IpV6  //!< 128-bit IPv6 address
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Construct the address from a null-terminated string view
     ///
     /// Here \a address can be either a decimal address
-    /// (ex: "192.168.1.56") or a network name (ex: "localhost").
+    /// (ex: "192.168.1.56"), an IPv6 address with or without
+    /// brackets (ex: "::1" or "[2001:db8::1]") or a network name
+    /// (ex: "localhost").
+    ///
+    /// When a network name has both IPv4 and IPv6 addresses, the
+    /// IPv4 address is returned. IPv6 addresses are returned for
+    /// names that only have IPv6 addresses, and on computers that
+    /// only have IPv6 connectivity.
+    ///
+    /// Network names are looked up in the host entries and the
+    /// cache of `sf::Dns` first. Otherwise this function blocks
+    /// until the system resolver answers; use
+    /// `sf::Dns::resolveAsync` to avoid freezing the calling thread.
     ///
     /// \param address IP address or network name
     ///
     /// \return Address if provided argument was valid, otherwise `std::nullopt`
     ///
+    /// \see `sf::Dns::resolveAsync`
+    ///
     ////////////////////////////////////////////////////////////
     [[nodiscard]] static std::optional<IpAddress> resolve(std::string_view address);
 
@@ -91,12 +116,35 @@ public:
     ////////////////////////////////////////////////////////////
     explicit IpAddress(std::uint32_t address);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct an IPv6 address from its 16 bytes
+    ///
+    /// The bytes are given in network order, the first byte
+    /// being the most significant one. IPv4-mapped addresses
+    /// (::ffff:a.b.c.d) are kept as IPv6 addresses.
+    ///
+    /// \param bytes 16 bytes of the address
+    ///
+    /// \see `toBytes`
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit IpAddress(const std::array<std::uint8_t, 16>& bytes);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the family of the address
+    ///
+    /// \return `Type::IpV4` or `Type::IpV6`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Type getType() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Get a string representation of the address
     ///
     /// The returned string is the decimal representation of the
     /// IP address (like "192.168.1.56"), even if it was constructed
-    /// from a host name.
+    /// from a host name. IPv6 addresses use their shortest text
+    /// representation, without brackets (like "2001:db8::1").
     ///
     /// \return String representation of the address
     ///
@@ -114,13 +162,29 @@ public:
     /// The integer produced by this function can then be converted
     /// back to a `sf::IpAddress` with the proper constructor.
     ///
-    /// \return 32-bits unsigned integer representation of the address
+    /// IPv6 addresses don't fit in 32 bits: use `toBytes` for them.
+    ///
+    /// \return 32-bits unsigned integer representation of the address, or 0 for an IPv6 address
     ///
-    /// \see `toString`
+    /// \see `toString`, `toBytes`
     ///
     ////////////////////////////////////////////////////////////
     [[nodiscard]] std::uint32_t toInteger() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the 16 bytes of the IPv6 representation of the address
+    ///
+    /// IPv4 addresses are returned as IPv4-mapped IPv6
+    /// addresses (::ffff:a.b.c.d), which is how they are seen
+    /// by dual-stack sockets.
+    ///
+    /// \return Bytes of the address, in network order
+    ///
+    /// \see `toInteger`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::array<std::uint8_t, 16> toBytes() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the computer's local address
     ///
@@ -165,9 +229,11 @@ public:
     // Static member data
     ////////////////////////////////////////////////////////////
     // NOLINTBEGIN(readability-identifier-naming)
-    static const IpAddress Any;       //!< Value representing any address (0.0.0.0)
-    static const IpAddress LocalHost; //!< The "localhost" address (for connecting a computer to itself locally)
-    static const IpAddress Broadcast; //!< The "broadcast" address (for sending UDP messages to everyone on a local network)
+    static const IpAddress Any;         //!< Value representing any address (0.0.0.0)
+    static const IpAddress LocalHost;   //!< The "localhost" address (for connecting a computer to itself locally)
+    static const IpAddress Broadcast;   //!< The "broadcast" address (for sending UDP messages to everyone on a local network)
+    static const IpAddress AnyV6;       //!< Value representing any IPv6 address (::), which also accepts IPv4 peers
+    static const IpAddress LocalHostV6; //!< The IPv6 "localhost" address (::1)
     // NOLINTEND(readability-identifier-naming)
 
 private:
@@ -176,7 +242,9 @@ private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    std::uint32_t m_address; //!< Address stored as an unsigned 32 bit integer
+    std::uint32_t                m_address{};        //!< IPv4 address stored as an unsigned 32 bit integer
+    std::array<std::uint8_t, 16> m_bytes{};          //!< IPv6 address stored in network order
+    Type                         m_type{Type::IpV4}; //!< Family of the address
 };
 
 ////////////////////////////////////////////////////////////
@@ -289,9 +357,12 @@ SFML_NETWORK_API std::ostream& operator<<(std::ostream& stream, IpAddress addres
 /// auto a7 = sf::IpAddress::resolve("www.google.com"); // a distant address created from a network name
 /// auto a8 = sf::IpAddress::getLocalAddress();         // my address on the local network
 /// auto a9 = sf::IpAddress::getPublicAddress();        // my address on the internet
+/// auto a10 = sf::IpAddress::resolve("::1");           // the IPv6 local host address
 /// \endcode
 ///
-/// Note that `sf::IpAddress` currently doesn't support IPv6
-/// nor other types of network addresses.
+/// IPv4 and IPv6 addresses are both supported, see `getType`.
+/// Sockets bound to `sf::IpAddress::AnyV6` are dual-stack:
+/// they also communicate with IPv4 peers, whose addresses are
+/// reported as IPv4 addresses.
 ///
 ////////////////////////////////////////////////////////////
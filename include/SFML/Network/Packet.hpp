@@ -29,6 +29,7 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Network/Export.hpp>
 
+#include <array>
 #include <string>
 #include <vector>
 
@@ -38,6 +39,7 @@
 
 namespace sf
 {
+class PacketBufferPool;
 class String;
 
 ////////////////////////////////////////////////////////////
@@ -48,6 +50,16 @@ class String;
 class SFML_NETWORK_API Packet
 {
 public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Encodings used by the stream operators
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class Encoding
+    {
+        Fixed,  //!< Fixed-size big-endian integers, one byte per `bool` (default)
+        Compact //!< LEB128 integers (zig-zag for signed ones), one bit per `bool`
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Default constructor
     ///
@@ -56,6 +68,19 @@ public:
     ////////////////////////////////////////////////////////////
     Packet() = default;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct an empty packet using a buffer pool
+    ///
+    /// When its data outgrows the inline storage, the packet
+    /// takes its buffer from \a pool instead of allocating it,
+    /// and gives it back when it is destroyed.
+    /// The pool must outlive the packet and all its copies.
+    ///
+    /// \param pool Pool providing the packet's buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit Packet(PacketBufferPool& pool);
+
     ////////////////////////////////////////////////////////////
     /// \brief Virtual destructor
     ///
@@ -98,6 +123,20 @@ public:
     ////////////////////////////////////////////////////////////
     void append(const void* data, std::size_t sizeInBytes);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Reserve memory for the data of the packet
+    ///
+    /// Packets keep up to 64 bytes of data inline, without
+    /// allocating anything. Reserving room for larger packets
+    /// up front avoids reallocating while the data is appended.
+    ///
+    /// \param sizeInBytes Number of bytes the packet should be able to hold
+    ///
+    /// \see `append`
+    ///
+    ////////////////////////////////////////////////////////////
+    void reserve(std::size_t sizeInBytes);
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the current reading position in the packet
     ///
@@ -198,6 +237,136 @@ public:
     ////////////////////////////////////////////////////////////
     explicit operator bool() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the encoding used by the stream operators
+    ///
+    /// With `Encoding::Compact`, 16, 32 and 64-bit integers
+    /// (including string lengths and wide characters) are
+    /// written as LEB128 varints, signed ones being zig-zag
+    /// encoded first so that small negative values stay short.
+    /// Booleans are packed 8 per byte the same way as `writeBits`.
+    /// 8-bit integers and floating point numbers are unchanged.
+    ///
+    /// The encoding isn't transmitted: the receiving packet
+    /// must be set to the same encoding as the sending one.
+    /// It is kept when the packet is cleared.
+    ///
+    /// \param encoding New encoding
+    ///
+    /// \see `getEncoding`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setEncoding(Encoding encoding);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the encoding used by the stream operators
+    ///
+    /// \return Current encoding
+    ///
+    /// \see `setEncoding`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Encoding getEncoding() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Read from external memory without copying it
+    ///
+    /// The packet is cleared, then extraction operators read
+    /// directly from \a data, which must stay valid and
+    /// unchanged while the packet uses it. Appending data or
+    /// clearing the packet copies it or detaches it first.
+    ///
+    /// \param data        Pointer to the bytes to read
+    /// \param sizeInBytes Number of bytes to read
+    ///
+    /// \see `writeInto`
+    ///
+    ////////////////////////////////////////////////////////////
+    void readFrom(const void* data, std::size_t sizeInBytes);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write into external memory
+    ///
+    /// The packet is cleared, then appended data is written
+    /// directly into \a buffer (which `getData` then returns)
+    /// as long as it fits in \a capacity bytes. When it doesn't,
+    /// the data written so far is moved to the packet's own storage.
+    /// Clearing the packet detaches it from the buffer.
+    ///
+    /// \param buffer   Memory to write to
+    /// \param capacity Size of \a buffer, in bytes
+    ///
+    /// \see `readFrom`
+    ///
+    ////////////////////////////////////////////////////////////
+    void writeInto(void* buffer, std::size_t capacity);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write the low bits of an integer
+    ///
+    /// Bits are packed into shared bytes: the first write
+    /// appends a byte to the packet, and the following ones fill
+    /// it up before another byte is appended, regardless of
+    /// the data written in between. They must be read back with
+    /// `readBits` in the same order, and with the same counts.
+    ///
+    /// \param value    Value whose bits are written
+    /// \param bitCount Number of low bits to write (1 to 32)
+    ///
+    /// \return Reference to the packet
+    ///
+    /// \see `readBits`
+    ///
+    ////////////////////////////////////////////////////////////
+    Packet& writeBits(std::uint32_t value, unsigned int bitCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Read bits written by `writeBits`
+    ///
+    /// \param value    Variable to fill with the bits read
+    /// \param bitCount Number of bits to read (1 to 32)
+    ///
+    /// \return Reference to the packet
+    ///
+    /// \see `writeBits`
+    ///
+    ////////////////////////////////////////////////////////////
+    Packet& readBits(std::uint32_t& value, unsigned int bitCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write a floating point number quantized to a number of bits
+    ///
+    /// The value is clamped to [\a min, \a max] and mapped to
+    /// one of the 2^bitCount evenly spaced values of that range,
+    /// then written with `writeBits`.
+    ///
+    /// \param value    Value to write
+    /// \param min      Lowest value of the range
+    /// \param max      Highest value of the range
+    /// \param bitCount Number of bits to write (1 to 32)
+    ///
+    /// \return Reference to the packet
+    ///
+    /// \see `readQuantized`
+    ///
+    ////////////////////////////////////////////////////////////
+    Packet& writeQuantized(float value, float min, float max, unsigned int bitCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Read a floating point number written by `writeQuantized`
+    ///
+    /// \param value    Variable to fill with the value read
+    /// \param min      Lowest value of the range
+    /// \param max      Highest value of the range
+    /// \param bitCount Number of bits to read (1 to 32)
+    ///
+    /// \return Reference to the packet
+    ///
+    /// \see `writeQuantized`
+    ///
+    ////////////////////////////////////////////////////////////
+    Packet& readQuantized(float& value, float min, float max, unsigned int bitCount);
+
     ////////////////////////////////////////////////////////////
     /// Overload of `operator>>` to read data from the packet
     ///
@@ -362,6 +531,7 @@ public:
 
 protected:
     friend class TcpSocket;
+    friend class UdpConnection;
     friend class UdpSocket;
 
     ////////////////////////////////////////////////////////////
@@ -393,7 +563,9 @@ protected:
     /// The function receives a pointer to the received data,
     /// and must fill the packet with the transformed bytes.
     /// The default implementation fills the packet directly
-    /// without transforming the data.
+    /// without transforming the data; when called by
+    /// `sf::TcpSocket`, it takes over the socket's receive
+    /// buffer instead of copying it.
     ///
     /// \param data Pointer to the received bytes
     /// \param size Number of bytes
@@ -403,6 +575,19 @@ protected:
     ////////////////////////////////////////////////////////////
     virtual void onReceive(const void* data, std::size_t size);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Mark the packet as invalid
+    ///
+    /// Derived classes can call this function from `onReceive`
+    /// when the received data can't be decoded, so that the
+    /// packet tests as `false` and every extraction fails.
+    /// The packet becomes valid again when it is cleared.
+    ///
+    /// \see `onReceive`
+    ///
+    ////////////////////////////////////////////////////////////
+    void invalidate();
+
 private:
     ////////////////////////////////////////////////////////////
     /// \brief Check if the packet can extract a given number of bytes
@@ -416,13 +601,114 @@ private:
     ////////////////////////////////////////////////////////////
     bool checkSize(std::size_t size);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Fill the packet with the content of a receive buffer
+    ///
+    /// Calls `onReceive` with the buffer's data. If it isn't
+    /// overridden and the data doesn't fit inline, the packet
+    /// takes ownership of the buffer and leaves its previous
+    /// storage in exchange; otherwise the buffer is unchanged.
+    ///
+    /// \param buffer Buffer holding exactly the received bytes
+    ///
+    ////////////////////////////////////////////////////////////
+    void receiveBuffer(std::vector<std::byte>& buffer);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Append an unsigned integer as a LEB128 varint
+    ///
+    /// \param value Value to append
+    ///
+    ////////////////////////////////////////////////////////////
+    void writeVarint(std::uint64_t value);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Extract an unsigned LEB128 varint
+    ///
+    /// The packet becomes invalid if the varint is truncated,
+    /// overlong or greater than \a maxValue.
+    ///
+    /// \param value    Variable to fill with the value read
+    /// \param maxValue Highest value accepted
+    ///
+    /// \return `true` if the value was extracted successfully
+    ///
+    ////////////////////////////////////////////////////////////
+    bool readVarint(std::uint64_t& value, std::uint64_t maxValue);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Position of the byte currently receiving or providing bits
+    ///
+    ////////////////////////////////////////////////////////////
+    struct BitCursor
+    {
+        std::size_t  position{}; //!< Index of the byte in the packet data
+        unsigned int count{8};   //!< Number of bits of the byte already used (8: a new byte is needed)
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Byte storage keeping small packets inline
+    ///
+    /// Data is stored in a fixed-size inline array until it
+    /// outgrows it, then in a heap buffer which is optionally
+    /// taken from and returned to a `PacketBufferPool`.
+    ///
+    ////////////////////////////////////////////////////////////
+    class Storage
+    {
+    public:
+        static constexpr std::size_t inlineCapacity{64}; //!< Number of bytes stored without allocating
+
+        Storage() = default;
+        explicit Storage(PacketBufferPool* pool);
+        ~Storage();
+        Storage(const Storage& other);
+        Storage& operator=(const Storage& other);
+        Storage(Storage&&) noexcept = default;
+        Storage& operator=(Storage&& other) noexcept;
+
+        [[nodiscard]] std::byte*       data();
+        [[nodiscard]] const std::byte* data() const;
+        [[nodiscard]] std::size_t      size() const;
+        [[nodiscard]] bool             empty() const;
+
+        void append(const std::byte* data, std::size_t size);
+        void reserve(std::size_t capacity);
+        void clear();
+        void swap(std::vector<std::byte>& buffer);
+        void attach(std::byte* data, std::size_t size, std::size_t capacity);
+
+    private:
+        enum class Location
+        {
+            Inline,  //!< Data lives in the inline array
+            Heap,    //!< Data lives in the heap buffer
+            External //!< Data lives in memory owned by the caller
+        };
+
+        void moveToHeap(std::size_t capacity);
+        void releaseHeap();
+
+        std::array<std::byte, inlineCapacity> m_inline{};                   //!< Inline storage for small packets
+        std::size_t                           m_size{};                     //!< Bytes used in inline/external storage
+        std::vector<std::byte>                m_heap;                       //!< Heap storage for larger packets
+        std::byte*                            m_external{};                 //!< Caller's memory (readFrom, writeInto)
+        std::size_t                           m_externalCapacity{};         //!< Size of the external storage
+        Location                              m_location{Location::Inline}; //!< Storage currently holding the data
+        PacketBufferPool*                     m_pool{};                     //!< Pool providing the heap storage
+    };
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    std::vector<std::byte> m_data;          //!< Data stored in the packet
-    std::size_t            m_readPos{};     //!< Current reading position in the packet
-    std::size_t            m_sendPos{};     //!< Current send position in the packet (for handling partial sends)
-    bool                   m_isValid{true}; //!< Reading state of the packet
+    Storage                 m_data;            //!< Data stored in the packet
+    std::size_t             m_readPos{};       //!< Current reading position in the packet
+    std::size_t             m_sendPos{};       //!< Current send position in the packet (for handling partial sends)
+    bool                    m_isValid{true};   //!< Reading state of the packet
+    Encoding                m_encoding{};      //!< Encoding used by the stream operators
+    BitCursor               m_writeBits;       //!< Byte being filled by `writeBits`
+    BitCursor               m_readBits;        //!< Byte being consumed by `readBits`
+    std::vector<std::byte>* m_receiveBuffer{}; //!< Buffer being passed to onReceive, which may be taken over
 };
 
 } // namespace sf
@@ -486,6 +772,12 @@ private:
 /// \li floating point numbers (`float`, `double`)
 /// \li string types (`char*`, `wchar_t*`, `std::string`, `std::wstring`, `sf::String`)
 ///
+/// By default, integers are written with their full size.
+/// Setting `sf::Packet::Encoding::Compact` with `setEncoding` on both
+/// ends writes them as variable-length integers instead, and packs
+/// booleans into bits, which is much smaller for typical game state.
+/// `writeBits` and `writeQuantized` can pack values even more tightly.
+///
 /// Like standard streams, it is also possible to define your own
 /// overloads of operators >> and << in order to handle your
 /// custom types.
@@ -543,6 +835,6 @@ private:
 /// ...
 /// \endcode
 ///
-/// \see `sf::TcpSocket`, `sf::UdpSocket`
+/// \see `sf::TcpSocket`, `sf::UdpSocket`, `sf::PacketBufferPool`
 ///
 ////////////////////////////////////////////////////////////
@@ -0,0 +1,142 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Network/Export.hpp>
+
+#include <mutex>
+#include <vector>
+
+#include <cstddef>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Thread-safe pool of reusable packet buffers
+///
+////////////////////////////////////////////////////////////
+class SFML_NETWORK_API PacketBufferPool
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct an empty pool
+    ///
+    /// \param maxBufferCount Maximum number of released buffers kept for reuse
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit PacketBufferPool(std::size_t maxBufferCount = 256);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    PacketBufferPool(const PacketBufferPool&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    PacketBufferPool& operator=(const PacketBufferPool&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get an empty buffer, reusing a released one if possible
+    ///
+    /// \param capacity Minimum capacity of the buffer, in bytes
+    ///
+    /// \return Empty buffer with at least \a capacity bytes of capacity
+    ///
+    /// \see `release`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::vector<std::byte> acquire(std::size_t capacity);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Give a buffer back to the pool
+    ///
+    /// The buffer is cleared and kept for a later call to
+    /// `acquire`, unless the pool is already full in which
+    /// case it is simply destroyed.
+    ///
+    /// \param buffer Buffer to release
+    ///
+    /// \see `acquire`
+    ///
+    ////////////////////////////////////////////////////////////
+    void release(std::vector<std::byte>&& buffer);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of buffers waiting to be reused
+    ///
+    /// \return Number of buffers currently held by the pool
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getBufferCount() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    mutable std::mutex                  m_mutex;          //!< Mutex protecting the buffers
+    std::vector<std::vector<std::byte>> m_buffers;        //!< Released buffers waiting to be reused
+    std::size_t                         m_maxBufferCount; //!< Maximum number of buffers kept in the pool
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::PacketBufferPool
+/// \ingroup network
+///
+/// Every `sf::Packet` whose data outgrows its small inline
+/// storage allocates a heap buffer, and frees it when it is
+/// destroyed. When thousands of short-lived packets are built
+/// every frame, these allocations can become a bottleneck.
+///
+/// Packets constructed with a pool take their heap buffer
+/// from it and give it back when they are destroyed, so the
+/// memory is reused instead of going back to the allocator.
+/// The pool can be shared by packets living in different
+/// threads, and must outlive all of them.
+///
+/// Usage example:
+/// \code
+/// sf::PacketBufferPool pool;
+///
+/// for (auto& client : clients)
+/// {
+///     sf::Packet packet(pool);
+///     packet << client.state;
+///     client.socket.send(packet);
+/// } // The packet buffer returns to the pool here
+/// \endcode
+///
+/// \see `sf::Packet`
+///
+////////////////////////////////////////////////////////////
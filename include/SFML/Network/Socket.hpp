@@ -29,8 +29,17 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Network/Export.hpp>
 
+#include <SFML/Network/IpAddress.hpp>
 #include <SFML/Network/SocketHandle.hpp>
 
+#include <SFML/System/Time.hpp>
+
+#include <array>
+#include <optional>
+
+#include <cstddef>
+#include <cstdint>
+
 
 namespace sf
 {
@@ -61,6 +70,48 @@ public:
     // NOLINTNEXTLINE(readability-identifier-naming)
     static constexpr unsigned short AnyPort{0}; //!< Special value that tells the system to pick any available port
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Parameters of the TCP keep-alive probes
+    ///
+    /// The defaults detect a silent peer after about 15 seconds,
+    /// which is much sooner than the system defaults (usually
+    /// more than 2 hours) and suits interactive applications.
+    ///
+    ////////////////////////////////////////////////////////////
+    struct KeepAlive
+    {
+        Time         idle{seconds(10)};    //!< Time without any traffic before the first probe is sent
+        Time         interval{seconds(1)}; //!< Time between two unanswered probes
+        unsigned int probeCount{5};        //!< Number of unanswered probes after which the connection is dropped
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Traffic handled by a socket, or by all the sockets
+    ///
+    /// Byte counts are the bytes exchanged with the system, so
+    /// they include the size prefix of TCP packets and the TLS
+    /// overhead. Messages are packets on TCP sockets and
+    /// datagrams on UDP sockets.
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Statistics
+    {
+        std::uint64_t bytesSent{};            //!< Bytes handed to the system
+        std::uint64_t bytesReceived{};        //!< Bytes read from the system
+        std::uint64_t messagesSent{};         //!< Packets or datagrams completely sent
+        std::uint64_t messagesReceived{};     //!< Packets or datagrams completely received
+        std::uint64_t sendCalls{};            //!< System calls made to send data
+        std::uint64_t receiveCalls{};         //!< System calls made to receive data
+        std::uint64_t partialSends{};         //!< Sends which returned `Status::Partial`
+        std::uint64_t notReadySends{};        //!< Sends which returned `Status::NotReady`
+        std::uint64_t notReadyReceives{};     //!< Receives which found no data ready
+        std::uint64_t tlsRecordsSent{};       //!< TLS records of application data sent
+        std::uint64_t tlsRecordsReceived{};   //!< TLS records of application data received
+        std::uint64_t tlsHandshakes{};        //!< TLS handshakes completed
+        std::uint64_t tlsResumedHandshakes{}; //!< TLS handshakes which resumed a cached session (servers only)
+        Time          tlsHandshakeTime;       //!< Total time taken by the completed TLS handshakes
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Destructor
     ///
@@ -120,6 +171,133 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool isBlocking() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the size of the send buffer of the socket
+    ///
+    /// The operating system may round or clamp the size
+    /// (Linux for example doubles it to account for its own
+    /// bookkeeping). A value of 0, which is the default, leaves
+    /// the system default untouched; it doesn't restore the
+    /// system default of a socket whose size was already changed.
+    /// If the socket doesn't exist yet, the size is applied when
+    /// it is created.
+    ///
+    /// \param size Size of the send buffer, in bytes
+    ///
+    /// \see `getSendBufferSize`, `setReceiveBufferSize`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setSendBufferSize(std::size_t size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the requested size of the send buffer
+    ///
+    /// \return Size given to `setSendBufferSize`, 0 for the system default
+    ///
+    /// \see `setSendBufferSize`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getSendBufferSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the size of the receive buffer of the socket
+    ///
+    /// A larger receive buffer lets a UDP socket absorb bursts
+    /// of datagrams without dropping them, and lets a TCP
+    /// connection advertise a larger window. The same rules as
+    /// `setSendBufferSize` apply.
+    ///
+    /// \param size Size of the receive buffer, in bytes
+    ///
+    /// \see `getReceiveBufferSize`, `setSendBufferSize`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setReceiveBufferSize(std::size_t size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the requested size of the receive buffer
+    ///
+    /// \return Size given to `setReceiveBufferSize`, 0 for the system default
+    ///
+    /// \see `setReceiveBufferSize`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getReceiveBufferSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the traffic handled by the socket
+    ///
+    /// The statistics cover the whole life of the socket
+    /// object, across reconnections, until they are reset.
+    /// Collecting them only costs a few additions per system
+    /// call. Like the other functions of the socket, this one
+    /// must not be called while another thread uses the socket.
+    ///
+    /// \return Snapshot of the traffic statistics of the socket
+    ///
+    /// \see `resetStatistics`, `getGlobalStatistics`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Statistics getStatistics() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Reset the traffic statistics of the socket
+    ///
+    /// \see `getStatistics`
+    ///
+    ////////////////////////////////////////////////////////////
+    void resetStatistics();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable the global traffic statistics
+    ///
+    /// When enabled, the traffic of all the sockets is also
+    /// added to program-wide counters. They are shared by all
+    /// threads, which makes collecting them a bit more costly
+    /// than the statistics of each socket, so they are disabled
+    /// by default.
+    ///
+    /// \param enabled `true` to collect the global statistics
+    ///
+    /// \see `isGlobalStatisticsEnabled`, `getGlobalStatistics`
+    ///
+    ////////////////////////////////////////////////////////////
+    static void setGlobalStatisticsEnabled(bool enabled);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the global traffic statistics are collected
+    ///
+    /// \return `true` if the global statistics are enabled
+    ///
+    /// \see `setGlobalStatisticsEnabled`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool isGlobalStatisticsEnabled();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the traffic handled by all the sockets
+    ///
+    /// Only the traffic which happened while the global
+    /// statistics were enabled is counted. This function can
+    /// be called from any thread; while other threads keep
+    /// using their sockets, the counters are read one by one,
+    /// so they may not be exactly consistent with each other.
+    ///
+    /// \return Snapshot of the global traffic statistics
+    ///
+    /// \see `setGlobalStatisticsEnabled`, `resetGlobalStatistics`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static Statistics getGlobalStatistics();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Reset the global traffic statistics
+    ///
+    /// \see `getGlobalStatistics`
+    ///
+    ////////////////////////////////////////////////////////////
+    static void resetGlobalStatistics();
+
 protected:
     ////////////////////////////////////////////////////////////
     /// \brief Types of protocols that the socket can use
@@ -153,13 +331,27 @@ protected:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] SocketHandle getNativeHandle() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Return the family of the addresses used by the socket
+    ///
+    /// This function can only be accessed by derived classes.
+    ///
+    /// \return Address family given when the socket was created
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] IpAddress::Type getAddressType() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Create the internal representation of the socket
     ///
+    /// IPv6 sockets are dual-stack: they can also communicate
+    /// with IPv4 peers through IPv4-mapped addresses.
     /// This function can only be accessed by derived classes.
     ///
+    /// \param addressType Family of the addresses used by the socket
+    ///
     ////////////////////////////////////////////////////////////
-    void create();
+    void create(IpAddress::Type addressType = IpAddress::Type::IpV4);
 
     ////////////////////////////////////////////////////////////
     /// \brief Create the internal representation of the socket
@@ -167,10 +359,12 @@ protected:
     ///
     /// This function can only be accessed by derived classes.
     ///
-    /// \param handle OS-specific handle of the socket to wrap
+    /// \param handle      OS-specific handle of the socket to wrap
+    /// \param addressType Family of the addresses used by the socket
+    /// \param blockingSet `true` if the handle is already in the blocking state of the socket
     ///
     ////////////////////////////////////////////////////////////
-    void create(SocketHandle handle);
+    void create(SocketHandle handle, IpAddress::Type addressType = IpAddress::Type::IpV4, bool blockingSet = false);
 
     ////////////////////////////////////////////////////////////
     /// \brief Close the socket gracefully
@@ -180,15 +374,270 @@ protected:
     ////////////////////////////////////////////////////////////
     void close();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether data was already read from the
+    ///        operating system but not received yet
+    ///
+    /// Such data, e.g. the rest of a decrypted TLS record, can
+    /// be received even though the operating system doesn't
+    /// report the socket as ready. `sf::SocketSelector` reports
+    /// sockets with buffered data as ready. Closing the socket
+    /// clears the flag.
+    /// This function can only be accessed by derived classes.
+    ///
+    /// \param buffered `true` if data is buffered
+    ///
+    ////////////////////////////////////////////////////////////
+    void setBufferedData(bool buffered);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable the Nagle algorithm (TCP only)
+    ///
+    /// With no-delay enabled, small writes are sent right away
+    /// instead of being coalesced, which minimizes latency at
+    /// the cost of more packets on the wire.
+    /// It is enabled by default.
+    /// This function is made public by `sf::TcpSocket`.
+    ///
+    /// \param noDelay `true` to send small writes immediately
+    ///
+    /// \see `isNoDelay`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setNoDelay(bool noDelay);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the Nagle algorithm is disabled
+    ///
+    /// \return `true` if small writes are sent immediately
+    ///
+    /// \see `setNoDelay`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isNoDelay() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Allow several sockets to bind the same port
+    ///
+    /// With port reuse enabled on all of them, several sockets
+    /// (usually one per thread) can listen on or bind the same
+    /// address and port; the system then spreads the incoming
+    /// connections or datagrams between them.
+    /// It must be enabled before the socket is bound, and is
+    /// only supported on systems providing `SO_REUSEPORT` (not
+    /// Windows). It is disabled by default.
+    /// This function is made public by `sf::TcpListener` and
+    /// `sf::UdpSocket`.
+    ///
+    /// \param reusePort `true` to allow other sockets to bind the same port
+    ///
+    /// \see `isReusePort`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setReusePort(bool reusePort);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether port reuse is enabled
+    ///
+    /// \return `true` if other sockets can bind the same port
+    ///
+    /// \see `setReusePort`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isReusePort() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set how the socket behaves when closed with unsent data (TCP only)
+    ///
+    /// `std::nullopt`, the default, lets the system send the
+    /// remaining data in the background after the socket is
+    /// closed. A positive time makes closing the socket block
+    /// until the data is sent or the time elapses (rounded up
+    /// to the second). `Time::Zero` drops the data and resets
+    /// the connection right away.
+    /// This function is made public by `sf::TcpSocket`.
+    ///
+    /// \param linger Time to wait for unsent data, or `std::nullopt` for the system behavior
+    ///
+    /// \see `getLinger`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setLinger(std::optional<Time> linger);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get how the socket behaves when closed with unsent data
+    ///
+    /// \return Time to wait for unsent data, or `std::nullopt` for the system behavior
+    ///
+    /// \see `setLinger`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<Time> getLinger() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable TCP keep-alive probes
+    ///
+    /// Keep-alive probes detect peers that vanished without
+    /// closing the connection (crash, cable unplugged, NAT
+    /// timeout). Times are rounded up to the second; on systems
+    /// which don't support tuning the probes, only the system
+    /// defaults are enabled. Keep-alive is disabled by default.
+    /// This function is made public by `sf::TcpSocket`.
+    ///
+    /// \param keepAlive Parameters of the probes, or `std::nullopt` to disable them
+    ///
+    /// \see `getKeepAlive`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setKeepAlive(std::optional<KeepAlive> keepAlive);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the parameters of the TCP keep-alive probes
+    ///
+    /// \return Parameters of the probes, or `std::nullopt` if they are disabled
+    ///
+    /// \see `setKeepAlive`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<KeepAlive> getKeepAlive() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the time spent busy polling the device when receiving
+    ///
+    /// When no data is available, a blocking receive spins on
+    /// the network device queue for up to this time before
+    /// sleeping, trading CPU time for lower receive latency.
+    /// It is only supported on Linux, where raising it above
+    /// the `net.core.busy_poll` setting requires privileges.
+    /// `Time::Zero`, the default, disables busy polling.
+    /// This function is made public by `sf::TcpSocket` and
+    /// `sf::UdpSocket`.
+    ///
+    /// \param busyPoll Time to spin before sleeping (microsecond precision)
+    ///
+    /// \see `getBusyPoll`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setBusyPoll(Time busyPoll);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the time spent busy polling the device when receiving
+    ///
+    /// \return Time to spin before sleeping, `Time::Zero` if disabled
+    ///
+    /// \see `setBusyPoll`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Time getBusyPoll() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Traffic counter of the socket
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class Counter
+    {
+        BytesSent,            //!< `Statistics::bytesSent`
+        BytesReceived,        //!< `Statistics::bytesReceived`
+        MessagesSent,         //!< `Statistics::messagesSent`
+        MessagesReceived,     //!< `Statistics::messagesReceived`
+        SendCalls,            //!< `Statistics::sendCalls`
+        ReceiveCalls,         //!< `Statistics::receiveCalls`
+        PartialSends,         //!< `Statistics::partialSends`
+        NotReadySends,        //!< `Statistics::notReadySends`
+        NotReadyReceives,     //!< `Statistics::notReadyReceives`
+        TlsRecordsSent,       //!< `Statistics::tlsRecordsSent`
+        TlsRecordsReceived,   //!< `Statistics::tlsRecordsReceived`
+        TlsHandshakes,        //!< `Statistics::tlsHandshakes`
+        TlsResumedHandshakes, //!< `Statistics::tlsResumedHandshakes`
+        TlsHandshakeTime      //!< `Statistics::tlsHandshakeTime`, in microseconds
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add to a traffic counter of the socket
+    ///
+    /// The global counter is increased as well if the global
+    /// statistics are enabled.
+    /// This function can only be accessed by derived classes.
+    ///
+    /// \param counter Counter to increase
+    /// \param value   Value to add to the counter
+    ///
+    ////////////////////////////////////////////////////////////
+    void countTraffic(Counter counter, std::uint64_t value = 1);
+
 private:
     friend class SocketSelector;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Options applied to the socket when it is created
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Options
+    {
+        std::size_t              sendBufferSize{};    //!< Size of the send buffer, 0 for the system default
+        std::size_t              receiveBufferSize{}; //!< Size of the receive buffer, 0 for the system default
+        bool                     noDelay{true};       //!< Disable the Nagle algorithm (TCP only)
+        bool                     reusePort{};         //!< Allow other sockets to bind the same port
+        std::optional<Time>      linger;              //!< Time to wait for unsent data when closing (TCP only)
+        std::optional<KeepAlive> keepAlive;           //!< Parameters of the keep-alive probes (TCP only)
+        Time                     busyPoll;            //!< Time to busy poll the device when receiving
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Option of the socket
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class Option
+    {
+        SendBufferSize,    //!< `SO_SNDBUF`
+        ReceiveBufferSize, //!< `SO_RCVBUF`
+        NoDelay,           //!< `TCP_NODELAY`
+        ReusePort,         //!< `SO_REUSEPORT`
+        Linger,            //!< `SO_LINGER`
+        KeepAlive,         //!< `SO_KEEPALIVE` and the probe parameters
+        BusyPoll           //!< `SO_BUSY_POLL`
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Apply an option to the socket, if it exists
+    ///
+    /// \param option Option to apply
+    ///
+    ////////////////////////////////////////////////////////////
+    void applyOption(Option option) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Number of traffic counters
+    ///
+    ////////////////////////////////////////////////////////////
+    static constexpr std::size_t counterCount{static_cast<std::size_t>(Counter::TlsHandshakeTime) + 1};
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Values of the traffic counters, indexed by `Counter`
+    ///
+    ////////////////////////////////////////////////////////////
+    using Counters = std::array<std::uint64_t, counterCount>;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Convert values of the traffic counters to statistics
+    ///
+    /// \param counters Values of the traffic counters
+    ///
+    /// \return Traffic statistics
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static Statistics toStatistics(const Counters& counters);
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    Type         m_type;             //!< Type of the socket (TCP or UDP)
-    SocketHandle m_socket;           //!< Socket descriptor
-    bool         m_isBlocking{true}; //!< Current blocking mode of the socket
+    Type            m_type;                               //!< Type of the socket (TCP or UDP)
+    SocketHandle    m_socket;                             //!< Socket descriptor
+    bool            m_isBlocking{true};                   //!< Current blocking mode of the socket
+    IpAddress::Type m_addressType{IpAddress::Type::IpV4}; //!< Family of the addresses used by the socket
+    Options         m_options;                            //!< Options applied to the socket when it is created
+    Counters        m_counters{};                         //!< Traffic counters of the socket
+    bool            m_hasBufferedData{};                  //!< Whether the socket holds buffered data
 };
 
 } // namespace sf
@@ -202,9 +651,17 @@ private:
 /// derived classes.
 ///
 /// The only public features that it defines, and which
-/// is therefore common to all the socket classes, is the
-/// blocking state. All sockets can be set as blocking or
-/// non-blocking.
+/// are therefore common to all the socket classes, are the
+/// blocking state and the sizes of the system buffers. All
+/// sockets can be set as blocking or non-blocking.
+///
+/// The other options (no-delay, port reuse, linger, keep-alive
+/// and busy polling) are made public by the socket classes
+/// they apply to. Like the blocking state, all options can be
+/// set before the socket exists and are applied when it is
+/// created. The defaults favor latency: the Nagle algorithm
+/// is disabled on TCP sockets, and everything else is left
+/// to the system.
 ///
 /// In blocking mode, socket functions will hang until
 /// the operation completes, which means that the entire
@@ -32,6 +32,7 @@
 #include <SFML/System/Time.hpp>
 
 #include <memory>
+#include <vector>
 
 
 namespace sf
@@ -95,6 +96,9 @@ public:
     /// while it is stored in the selector.
     /// This function does nothing if the socket is not valid.
     ///
+    /// There is no limit on the number or the handle values
+    /// of the sockets stored in a selector.
+    ///
     /// \param socket Reference to the socket to add
     ///
     /// \see `remove`, `clear`
@@ -132,9 +136,11 @@ public:
     ///
     /// This function returns as soon as at least one socket has
     /// some data available to be received. To know which sockets are
-    /// ready, use the `isReady` function.
+    /// ready, use the `isReady` or `getReadySockets` function.
     /// If you use a timeout and no socket is ready before the timeout
     /// is over, the function returns `false`.
+    /// TLS sockets which already hold decrypted data are ready
+    /// without waiting.
     ///
     /// \param timeout Maximum time to wait, (use Time::Zero for infinity)
     ///
@@ -164,6 +170,57 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool isReady(Socket& socket) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the sockets that are ready to receive data
+    ///
+    /// This function returns the sockets found ready by the last
+    /// call to `wait`, without having to test every socket
+    /// with `isReady`. The pointers are the addresses of the
+    /// sockets that were passed to `add`, so sockets must not
+    /// be moved while they are in the selector when using
+    /// this function.
+    ///
+    /// \return Sockets that are ready to receive data
+    ///
+    /// \see `wait`, `isReady`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const std::vector<Socket*>& getReadySockets() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable edge-triggered readiness
+    ///
+    /// By default, `wait` reports a socket as ready as long as
+    /// it has data available (level-triggered). In edge-triggered
+    /// mode, a socket is only reported again once new data has
+    /// arrived, which avoids returning the same sockets over and
+    /// over when the application doesn't read everything at once.
+    /// When using this mode, receive from each ready socket until
+    /// it returns `sf::Socket::Status::NotReady` (this requires
+    /// non-blocking sockets).
+    ///
+    /// Edge-triggered mode is supported on Linux and Android,
+    /// other platforms keep using level-triggered readiness,
+    /// with which code written for edge-triggered mode works
+    /// unchanged.
+    ///
+    /// \param edgeTriggered `true` to enable edge-triggered mode, `false` to disable it
+    ///
+    /// \see `isEdgeTriggered`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setEdgeTriggered(bool edgeTriggered);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether edge-triggered readiness is enabled
+    ///
+    /// \return `true` if edge-triggered mode is enabled, `false` otherwise
+    ///
+    /// \see `setEdgeTriggered`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isEdgeTriggered() const;
+
 private:
     struct SocketSelectorImpl;
 
@@ -193,6 +250,10 @@ private:
 /// \li `sf::TcpSocket`
 /// \li `sf::UdpSocket`
 ///
+/// Selectors are built on epoll on Linux and Android and on
+/// poll on other platforms, so they scale to many thousands
+/// of sockets.
+///
 /// A selector doesn't store its own copies of the sockets
 /// (socket classes are not copyable anyway), it simply keeps
 /// a reference to the original sockets that you pass to the
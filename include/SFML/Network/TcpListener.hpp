@@ -32,6 +32,10 @@
 #include <SFML/Network/IpAddress.hpp>
 #include <SFML/Network/Socket.hpp>
 
+#include <vector>
+
+#include <cstddef>
+
 
 namespace sf
 {
@@ -44,6 +48,21 @@ class TcpSocket;
 class SFML_NETWORK_API TcpListener : public Socket
 {
 public:
+    ////////////////////////////////////////////////////////////
+    // Constants
+    ////////////////////////////////////////////////////////////
+    // NOLINTNEXTLINE(readability-identifier-naming)
+    static constexpr int MaxBacklog{0x7FFFFFFF}; //!< Special value that tells the system to use its largest backlog
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Options of TCP listeners
+    ///
+    /// \see `sf::Socket::setReusePort`
+    ///
+    ////////////////////////////////////////////////////////////
+    using Socket::isReusePort;
+    using Socket::setReusePort;
+
     ////////////////////////////////////////////////////////////
     /// \brief Default constructor
     ///
@@ -77,15 +96,58 @@ public:
     /// will request an available port from the system.
     /// The chosen port can be retrieved by calling `getLocalPort()`.
     ///
+    /// The backlog is the number of connections which the system
+    /// queues until they are accepted; further connection attempts
+    /// are refused or retried by the client. The system caps it
+    /// (on Linux, to the `net.core.somaxconn` setting), so the
+    /// default of `MaxBacklog` gives the largest queue allowed.
+    ///
     /// \param port    Port to listen on for incoming connection attempts
     /// \param address Address of the interface to listen on
+    /// \param backlog Maximum number of connections waiting to be accepted
     ///
     /// \return Status code
     ///
-    /// \see `accept`, `close`
+    /// \see `accept`, `close`, `createShards`
     ///
     ////////////////////////////////////////////////////////////
-    [[nodiscard]] Status listen(unsigned short port, IpAddress address = IpAddress::Any);
+    [[nodiscard]] Status listen(unsigned short port, IpAddress address = IpAddress::Any, int backlog = MaxBacklog);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create several listeners sharing the same port
+    ///
+    /// All the listeners have port reuse enabled and listen on
+    /// the same address and port, so that each of them can be
+    /// served by its own thread or event loop. The system then
+    /// spreads the incoming connections between the listeners,
+    /// which removes the single accept queue as a bottleneck
+    /// when many clients connect at once (for example after a
+    /// server restart).
+    ///
+    /// Connections are only balanced on Linux. On other systems
+    /// providing port reuse, the listeners are created but the
+    /// system may hand all the connections to one of them; on
+    /// systems without port reuse (Windows), a single listener
+    /// is returned.
+    ///
+    /// When providing `sf::Socket::AnyPort` as port, the first
+    /// listener requests an available port from the system and
+    /// the other ones listen on the same port.
+    ///
+    /// \param count   Number of listeners to create
+    /// \param port    Port to listen on for incoming connection attempts
+    /// \param address Address of the interface to listen on
+    /// \param backlog Maximum number of connections waiting to be accepted by each listener
+    ///
+    /// \return Listeners, or an empty vector if one of them failed to listen
+    ///
+    /// \see `listen`, `setReusePort`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::vector<TcpListener> createShards(std::size_t    count,
+                                                               unsigned short port,
+                                                               IpAddress      address = IpAddress::Any,
+                                                               int            backlog = MaxBacklog);
 
     ////////////////////////////////////////////////////////////
     /// \brief Stop listening and close the socket
@@ -104,6 +166,9 @@ public:
     /// If the socket is in blocking mode, this function will
     /// not return until a connection is actually received.
     ///
+    /// The new connection is created in the blocking mode of
+    /// `socket`, and with the options set on it beforehand.
+    ///
     /// \param socket Socket that will hold the new connection
     ///
     /// \return Status code
@@ -161,6 +226,29 @@ public:
 /// }
 /// \endcode
 ///
+/// Servers which accept many connections at once can spread
+/// them over several threads with `createShards()`. Each thread
+/// serves its own listener, and the accepted sockets can be
+/// moved to other threads, as long as a socket is only used by
+/// one thread at a time:
+/// \code
+/// std::vector<sf::TcpListener> listeners = sf::TcpListener::createShards(4, 55001);
+///
+/// std::vector<std::thread> threads;
+/// for (sf::TcpListener& shard : listeners)
+/// {
+///     threads.emplace_back([&shard]
+///     {
+///         while (running)
+///         {
+///             sf::TcpSocket client;
+///             if (shard.accept(client) == sf::Socket::Status::Done)
+///                 clients.push(std::move(client)); // Thread-safe queue consumed by the worker threads
+///         }
+///     });
+/// }
+/// \endcode
+///
 /// \see `sf::TcpSocket`, `sf::Socket`
 ///
 ////////////////////////////////////////////////////////////
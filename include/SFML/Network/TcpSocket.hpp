@@ -69,6 +69,22 @@ public:
         Error              //!< An unexpected error happened
     };
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Options of TCP connections
+    ///
+    /// \see `sf::Socket::setNoDelay`, `sf::Socket::setLinger`,
+    ///      `sf::Socket::setKeepAlive`, `sf::Socket::setBusyPoll`
+    ///
+    ////////////////////////////////////////////////////////////
+    using Socket::getBusyPoll;
+    using Socket::getKeepAlive;
+    using Socket::getLinger;
+    using Socket::isNoDelay;
+    using Socket::setBusyPoll;
+    using Socket::setKeepAlive;
+    using Socket::setLinger;
+    using Socket::setNoDelay;
+
     ////////////////////////////////////////////////////////////
     /// \brief Default constructor
     ///
@@ -194,16 +210,25 @@ public:
     /// `TlsStatus::HandshakeComplete` is returned. If this socket
     /// is blocking, `TlsStatus::HandshakeComplete` should be
     /// returned within the same function call if TLS setup was
-    /// successful.
+    /// successful. A non-blocking socket can be added to an
+    /// `sf::SocketSelector` to wait until the handshake can make
+    /// progress before calling this function again.
     ///
     /// If `TlsStatus::Error` is returned, something went wrong
     /// with TLS setup and the connection must be reconnected and
     /// TLS setup reattempted after it is connected again.
     ///
+    /// Once the handshake is complete, the TLS session is
+    /// remembered. Setting up TLS again to the same hostname
+    /// and port with the same verification settings resumes
+    /// it, which skips most of the handshake.
+    ///
     /// If verification is enabled, this function verifies the peer
-    /// using the system provided certificate store. If the peer
-    /// does not have a certificate that was signed by a certificate
-    /// authority i.e. a self-signed certificate, the entire certificate
+    /// using the system provided certificate store. The store is
+    /// loaded once, by the first socket which needs it, and shared
+    /// by all sockets afterwards. If the peer does not have a
+    /// certificate that was signed by a certificate authority
+    /// i.e. a self-signed certificate, the entire certificate
     /// chain can be provided using the alternative overload.
     ///
     /// Servers that host multiple services under different names
@@ -248,12 +273,23 @@ public:
     /// `TlsStatus::HandshakeComplete` is returned. If this socket
     /// is blocking, `TlsStatus::HandshakeComplete` should be
     /// returned within the same function call if TLS setup was
-    /// successful.
+    /// successful. A non-blocking socket can be added to an
+    /// `sf::SocketSelector` to wait until the handshake can make
+    /// progress before calling this function again.
     ///
     /// If `TlsStatus::Error` is returned, something went wrong
     /// with TLS setup and the connection must be reconnected and
     /// TLS setup reattempted after it is connected again.
     ///
+    /// Once the handshake is complete, the TLS session is
+    /// remembered. Setting up TLS again to the same hostname
+    /// and port with the same verification settings resumes
+    /// it, which skips most of the handshake.
+    ///
+    /// The certificate chain is only parsed by the first socket
+    /// which trusts it, and then shared along with the system
+    /// certificate store by all sockets trusting the same chain.
+    ///
     /// Servers that host multiple services under different names
     /// need to know which of those services we want to connect
     /// to in order to reply with the correct certificate chain.
@@ -306,12 +342,23 @@ public:
     /// `TlsStatus::HandshakeComplete` is returned. If this socket
     /// is blocking, `TlsStatus::HandshakeComplete` should be
     /// returned within the same function call if TLS setup was
-    /// successful.
+    /// successful. A non-blocking socket can be added to an
+    /// `sf::SocketSelector` to wait until the handshake can make
+    /// progress before calling this function again.
     ///
     /// If `TlsStatus::Error` is returned, something went wrong
     /// with TLS setup and the connection must be reconnected and
     /// TLS setup reattempted after it is connected again.
     ///
+    /// Once the handshake is complete, the TLS session is
+    /// remembered. Setting up TLS again to the same hostname
+    /// and port with the same verification settings resumes
+    /// it, which skips most of the handshake.
+    ///
+    /// The certificate chain is only parsed by the first socket
+    /// which trusts it, and then shared along with the system
+    /// certificate store by all sockets trusting the same chain.
+    ///
     /// Servers that host multiple services under different names
     /// need to know which of those services we want to connect
     /// to in order to reply with the correct certificate chain.
@@ -361,12 +408,23 @@ public:
     /// `TlsStatus::HandshakeComplete` is returned. If this socket
     /// is blocking, `TlsStatus::HandshakeComplete` should be
     /// returned within the same function call if TLS setup was
-    /// successful.
+    /// successful. A non-blocking socket can be added to an
+    /// `sf::SocketSelector` to wait until the handshake can make
+    /// progress before calling this function again.
     ///
     /// If `TlsStatus::Error` is returned, something went wrong
     /// with TLS setup and the connection must be reconnected and
     /// TLS setup reattempted after it is connected again.
     ///
+    /// Once the handshake is complete, the TLS session is
+    /// remembered. Setting up TLS again to the same hostname
+    /// and port with the same verification settings resumes
+    /// it, which skips most of the handshake.
+    ///
+    /// The certificate chain is only parsed by the first socket
+    /// which trusts it, and then shared along with the system
+    /// certificate store by all sockets trusting the same chain.
+    ///
     /// Servers that host multiple services under different names
     /// need to know which of those services we want to connect
     /// to in order to reply with the correct certificate chain.
@@ -415,7 +473,9 @@ public:
     /// `TlsStatus::HandshakeComplete` is returned. If this socket
     /// is blocking, `TlsStatus::HandshakeComplete` should be
     /// returned within the same function call if TLS setup was
-    /// successful.
+    /// successful. A non-blocking socket can be added to an
+    /// `sf::SocketSelector` to wait until the handshake can make
+    /// progress before calling this function again.
     ///
     /// If `TlsStatus::Error` is returned, something went wrong
     /// with TLS setup and the connection must be disconnected.
@@ -424,6 +484,13 @@ public:
     /// As a server, a certificate chain as well as a private key
     /// must be provided.
     ///
+    /// Sessions are cached and session tickets are issued, so that
+    /// clients reconnecting to any server socket of this process
+    /// can resume their session instead of performing a full
+    /// handshake.
+    /// Such handshakes are counted in
+    /// `Statistics::tlsResumedHandshakes`.
+    ///
     /// The certificate and private key data can be provided in
     /// PEM or DER format.
     ///
@@ -469,7 +536,9 @@ public:
     /// `TlsStatus::HandshakeComplete` is returned. If this socket
     /// is blocking, `TlsStatus::HandshakeComplete` should be
     /// returned within the same function call if TLS setup was
-    /// successful.
+    /// successful. A non-blocking socket can be added to an
+    /// `sf::SocketSelector` to wait until the handshake can make
+    /// progress before calling this function again.
     ///
     /// If `TlsStatus::Error` is returned, something went wrong
     /// with TLS setup and the connection must be disconnected.
@@ -478,6 +547,13 @@ public:
     /// As a server, a certificate chain as well as a private key
     /// must be provided.
     ///
+    /// Sessions are cached and session tickets are issued, so that
+    /// clients reconnecting to any server socket of this process
+    /// can resume their session instead of performing a full
+    /// handshake.
+    /// Such handshakes are counted in
+    /// `Statistics::tlsResumedHandshakes`.
+    ///
     /// The certificate and private key data should be provided in
     /// PEM format.
     ///
@@ -577,6 +653,46 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] Status send(Packet& packet);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Queue a formatted packet to be sent by the next call to `flush`
+    ///
+    /// Sending many small packets one by one costs one system
+    /// call (and with TLS, one encrypted record) per packet.
+    /// Queuing them and calling `flush` once hands all of them
+    /// to the operating system in as few calls as possible.
+    ///
+    /// The packet data is \em not copied: the packet must stay
+    /// alive and unmodified until `flush` has returned anything
+    /// other than `sf::Socket::Status::Partial` or
+    /// `sf::Socket::Status::NotReady`. The same packet may be
+    /// queued on several sockets, as long as its `onSend` keeps
+    /// returning the same data.
+    ///
+    /// \param packet Packet to queue
+    ///
+    /// \see `flush`
+    ///
+    ////////////////////////////////////////////////////////////
+    void queue(Packet& packet);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Send all the packets queued with `queue`
+    ///
+    /// In non-blocking mode, if this function returns
+    /// `sf::Socket::Status::Partial` or `sf::Socket::Status::NotReady`,
+    /// the remaining packets stay queued and are sent by the next
+    /// call to `flush`. On any other status the queue is emptied.
+    /// Packets queued in the meantime are sent after the
+    /// remaining ones.
+    /// This function will fail if the socket is not connected.
+    ///
+    /// \return Status code
+    ///
+    /// \see `queue`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Status flush();
+
     ////////////////////////////////////////////////////////////
     /// \brief Receive a formatted packet of data from the remote peer
     ///
@@ -596,6 +712,16 @@ public:
 private:
     friend class TcpListener;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Count the traffic of a gathering send
+    ///
+    /// \param status Status returned by the send
+    /// \param calls  Number of system calls made
+    /// \param bytes  Number of bytes sent
+    ///
+    ////////////////////////////////////////////////////////////
+    void countGathered(Status status, std::uint64_t calls, std::uint64_t bytes);
+
     ////////////////////////////////////////////////////////////
     /// \brief Structure holding the data of a pending packet
     ///
@@ -605,6 +731,7 @@ private:
         std::uint32_t          size{};         //!< Data of packet size
         std::size_t            sizeReceived{}; //!< Number of size bytes received so far
         std::vector<std::byte> data;           //!< Data of the packet
+        std::size_t            dataReceived{}; //!< Number of data bytes received so far
     };
 
     ////////////////////////////////////////////////////////////
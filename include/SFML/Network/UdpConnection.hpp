@@ -0,0 +1,431 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Network/Export.hpp>
+
+#include <SFML/Network/IpAddress.hpp>
+#include <SFML/Network/Socket.hpp>
+
+#include <SFML/System/Time.hpp>
+
+#include <memory>
+#include <optional>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+class Packet;
+class UdpSocket;
+
+////////////////////////////////////////////////////////////
+/// \brief Connection to a single peer adding reliability,
+///        ordering and fragmentation to UDP
+///
+////////////////////////////////////////////////////////////
+class SFML_NETWORK_API UdpConnection
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Delivery guarantees of a message
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class Channel
+    {
+        Unreliable,        //!< The message may be lost, duplicated or delivered out of order
+        ReliableUnordered, //!< The message is delivered exactly once, as soon as it is complete
+        ReliableOrdered    //!< The message is delivered exactly once, after the previous ordered messages
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief State of the connection
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class State
+    {
+        Disconnected, //!< No peer, or the peer disconnected or timed out
+        Listening,    //!< Waiting for a peer to connect
+        Connecting,   //!< Waiting for the peer to accept the connection
+        Connected     //!< Messages can be exchanged with the peer
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Counters describing the traffic of a connection
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Statistics
+    {
+        std::uint64_t messagesSent{};           //!< Messages accepted by `send`
+        std::uint64_t messagesReceived{};       //!< Messages delivered by `receive`
+        std::uint64_t fragmentsSent{};          //!< Fragments transmitted, including retransmissions
+        std::uint64_t fragmentsRetransmitted{}; //!< Reliable fragments transmitted again because no ack arrived
+        std::uint64_t datagramsSent{};          //!< Datagrams handed to the socket
+        std::uint64_t datagramsReceived{};      //!< Datagrams received from the peer
+        std::uint64_t datagramsDropped{};       //!< Outgoing datagrams discarded by the simulated loss
+        Time          roundTripTime;            //!< Smoothed round-trip time measured from the acks
+    };
+
+    // Constants
+    // NOLINTBEGIN(readability-identifier-naming)
+    static constexpr std::size_t FragmentSize{1024};                    //!< Maximum message bytes in a fragment
+    static constexpr std::size_t MaxMessageSize{FragmentSize * 0xFFFF}; //!< Maximum size of a message
+    // NOLINTEND(readability-identifier-naming)
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    UdpConnection();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// The peer isn't notified, call `disconnect` first
+    /// to close the connection gracefully.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~UdpConnection();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    UdpConnection(const UdpConnection&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    UdpConnection& operator=(const UdpConnection&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    UdpConnection(UdpConnection&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    UdpConnection& operator=(UdpConnection&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Wait for a peer to connect on a port
+    ///
+    /// The socket is bound to \a port and the first peer which
+    /// connects to it is accepted when `update` processes its
+    /// request. Any previous connection is dropped.
+    ///
+    /// \param port    Port to listen on
+    /// \param address Address of the interface to listen on
+    ///
+    /// \return Status code
+    ///
+    /// \see `connect`, `getState`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Socket::Status listen(unsigned short port, IpAddress address = IpAddress::Any);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start connecting to a listening peer
+    ///
+    /// The socket is bound to a free port, then `update` sends
+    /// connection requests until the peer accepts or the timeout
+    /// expires. Messages sent while connecting are transmitted
+    /// once the connection is established.
+    /// Any previous connection is dropped.
+    ///
+    /// \param remoteAddress Address of the peer
+    /// \param remotePort    Port of the peer
+    ///
+    /// \return Status code
+    ///
+    /// \see `listen`, `getState`, `setTimeout`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Socket::Status connect(IpAddress remoteAddress, unsigned short remotePort);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Close the connection
+    ///
+    /// The peer is notified on a best-effort basis, and messages
+    /// not yet acknowledged are discarded. Messages already
+    /// received can still be read with `receive`.
+    ///
+    ////////////////////////////////////////////////////////////
+    void disconnect();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Exchange datagrams with the peer
+    ///
+    /// This function never blocks. It reads every datagram
+    /// available on the socket, then sends the queued messages,
+    /// the acks and the retransmissions which are due. It also
+    /// detects when the peer times out.
+    /// It must be called regularly, typically once per frame.
+    ///
+    ////////////////////////////////////////////////////////////
+    void update();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Queue a message for the peer
+    ///
+    /// The message is split into fragments of at most
+    /// `FragmentSize` bytes, which the next call to `update`
+    /// transmits. Small messages are packed together.
+    ///
+    /// \param packet  Packet holding the message
+    /// \param channel Delivery guarantees of the message
+    ///
+    /// \return `Status::Done` if the message was queued,
+    ///         `Status::Disconnected` if there is no connection
+    ///         and `Status::Error` if the message is too large
+    ///
+    /// \see `receive`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Socket::Status send(Packet& packet, Channel channel);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the next message received from the peer
+    ///
+    /// This function never blocks: messages are read from the
+    /// socket by `update`.
+    ///
+    /// \param packet Packet to fill with the message
+    ///
+    /// \return `Status::Done` if a message was received,
+    ///         `Status::NotReady` if none is available yet and
+    ///         `Status::Disconnected` if none will arrive anymore
+    ///
+    /// \see `send`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Socket::Status receive(Packet& packet);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the next message received from the peer,
+    ///        and the channel it was sent on
+    ///
+    /// \param packet  Packet to fill with the message
+    /// \param channel Variable to fill with the channel of the message
+    ///
+    /// \return Status code, see `receive(Packet&)`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Socket::Status receive(Packet& packet, Channel& channel);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the state of the connection
+    ///
+    /// \return Current state
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] State getState() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the port to which the connection is bound locally
+    ///
+    /// \return Port, or 0 if the connection isn't bound
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned short getLocalPort() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the address of the peer
+    ///
+    /// \return Address of the peer, or `std::nullopt` if there is none
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<IpAddress> getRemoteAddress() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the port of the peer
+    ///
+    /// \return Port of the peer, or 0 if there is none
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned short getRemotePort() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set how long the peer may stay silent
+    ///
+    /// The connection is closed when nothing was received from
+    /// the peer for longer than \a timeout, or when a connection
+    /// request isn't accepted within \a timeout.
+    /// The default timeout is 10 seconds.
+    ///
+    /// \param timeout Timeout
+    ///
+    /// \see `getTimeout`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTimeout(Time timeout);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get how long the peer may stay silent
+    ///
+    /// \return Timeout
+    ///
+    /// \see `setTimeout`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Time getTimeout() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Discard a proportion of the outgoing datagrams
+    ///
+    /// This simulates a lossy network, for testing. Every
+    /// datagram, including the handshake and the acks, is
+    /// dropped with the given probability instead of being sent.
+    ///
+    /// \param probability Probability to drop a datagram, between 0 and 1
+    ///
+    /// \see `getSimulatedLoss`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setSimulatedLoss(float probability);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the proportion of outgoing datagrams discarded
+    ///
+    /// \return Probability to drop a datagram, between 0 and 1
+    ///
+    /// \see `setSimulatedLoss`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] float getSimulatedLoss() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the traffic counters of the connection
+    ///
+    /// The counters are reset by `listen` and `connect`.
+    ///
+    /// \return Counters
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Statistics getStatistics() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Access the underlying socket
+    ///
+    /// The socket can be added to a `sf::SocketSelector` to
+    /// wait for incoming datagrams, or have its options tuned.
+    /// It must not be used to send or receive data directly.
+    ///
+    /// \return Socket used by the connection
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] UdpSocket& getSocket();
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    struct Impl;
+    std::unique_ptr<Impl> m_impl; //!< Implementation details
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::UdpConnection
+/// \ingroup network
+///
+/// `sf::UdpSocket` sends raw datagrams: they may be lost,
+/// duplicated or reordered, and are limited in size.
+/// `sf::TcpSocket` is reliable, but a single lost segment
+/// delays everything sent after it, which is a problem for
+/// real-time traffic like game state updates.
+///
+/// `sf::UdpConnection` sits in between. It connects two
+/// peers over UDP with a handshake, and lets each message
+/// choose its guarantees through a channel:
+/// \li `Channel::Unreliable` messages are sent once, for data
+///     which is quickly outdated (positions, inputs)
+/// \li `Channel::ReliableUnordered` messages are retransmitted
+///     until acknowledged and delivered as soon as they arrive
+/// \li `Channel::ReliableOrdered` messages are also delivered
+///     in the order they were sent, like a TCP stream
+///
+/// Only the reliable ordered channel waits for missing
+/// messages, so a lost datagram never delays the other channels.
+///
+/// Reliable fragments have sequence numbers, and every
+/// datagram acknowledges the fragments received so far,
+/// so only the missing ones are retransmitted. Messages
+/// larger than `FragmentSize` are split into fragments and
+/// reassembled by the receiver; an unreliable message is
+/// dropped if one of its fragments is lost.
+///
+/// A connection talks to a single peer through its own
+/// socket. The peers must call `update` regularly: it does
+/// all the network I/O, so `send` and `receive` only access
+/// queues and never block.
+///
+/// Usage example:
+/// \code
+/// // ----- The server -----
+///
+/// sf::UdpConnection server;
+/// if (server.listen(55002) != sf::Socket::Status::Done)
+/// {
+///     // error...
+/// }
+///
+/// // ----- The client -----
+///
+/// sf::UdpConnection client;
+/// if (client.connect(sf::IpAddress(192, 168, 1, 50), 55002) != sf::Socket::Status::Done)
+/// {
+///     // error...
+/// }
+///
+/// sf::Packet hello;
+/// hello << "Hi, I'm a client";
+/// client.send(hello, sf::UdpConnection::Channel::ReliableOrdered);
+///
+/// // ----- Both, every frame -----
+///
+/// connection.update();
+///
+/// sf::Packet packet;
+/// while (connection.receive(packet) == sf::Socket::Status::Done)
+/// {
+///     // handle the message...
+/// }
+/// \endcode
+///
+/// \see `sf::UdpSocket`, `sf::Packet`
+///
+////////////////////////////////////////////////////////////
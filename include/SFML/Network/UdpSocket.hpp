@@ -55,6 +55,29 @@ public:
     // NOLINTNEXTLINE(readability-identifier-naming)
     static constexpr std::size_t MaxDatagramSize{65507}; //!< The maximum number of bytes that can be sent in a single UDP datagram
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Datagram sent or received by the batch functions
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Datagram
+    {
+        const std::byte* data{};                        //!< Payload of the datagram
+        std::size_t      size{};                        //!< Size of the payload, in bytes
+        IpAddress        remoteAddress{IpAddress::Any}; //!< Address of the receiver (send) or of the sender (receive)
+        unsigned short   remotePort{};                  //!< Port of the receiver (send) or of the sender (receive)
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Options of UDP sockets
+    ///
+    /// \see `sf::Socket::setReusePort`, `sf::Socket::setBusyPoll`
+    ///
+    ////////////////////////////////////////////////////////////
+    using Socket::getBusyPoll;
+    using Socket::isReusePort;
+    using Socket::setBusyPoll;
+    using Socket::setReusePort;
+
     ////////////////////////////////////////////////////////////
     /// \brief Default constructor
     ///
@@ -194,6 +217,62 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] Status receive(Packet& packet, std::optional<IpAddress>& remoteAddress, unsigned short& remotePort);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Send several datagrams at once
+    ///
+    /// Each datagram is sent to its own remote address and port.
+    /// On Linux the whole batch is handed to the system with as
+    /// few `sendmmsg` calls as possible, other platforms send
+    /// the datagrams one by one.
+    ///
+    /// If any datagram is greater than `UdpSocket::MaxDatagramSize`,
+    /// this function fails and no data is sent.
+    /// In non-blocking mode, if this function returns
+    /// `sf::Socket::Status::Partial`, only the first `sent`
+    /// datagrams were sent and the rest should be retried later.
+    ///
+    /// \param datagrams Datagrams to send
+    /// \param count     Number of datagrams to send
+    /// \param sent      The number of datagrams sent will be written here
+    ///
+    /// \return Status code
+    ///
+    /// \see `receive`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Status send(const Datagram* datagrams, std::size_t count, std::size_t& sent);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Receive several datagrams at once
+    ///
+    /// The arena is split into `count` slots of equal size, each
+    /// one receiving at most one datagram, so that nothing is
+    /// allocated per datagram: the `data` member of each received
+    /// datagram points inside the arena. A datagram which doesn't
+    /// fit in its slot is dropped and doesn't count in `received`.
+    ///
+    /// In blocking mode, this function waits until at least one
+    /// datagram has been accepted, then returns every datagram
+    /// which is already waiting, up to `count`. On Linux this only
+    /// takes a single `recvmmsg` call per 64 datagrams.
+    ///
+    /// \param arena     Memory receiving the datagrams' payloads
+    /// \param arenaSize Size of the arena, in bytes
+    /// \param datagrams Array to fill with the received datagrams
+    /// \param count     Maximum number of datagrams to receive
+    /// \param received  The number of datagrams received will be written here
+    ///
+    /// \return Status code
+    ///
+    /// \see `send`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Status receive(void*        arena,
+                                 std::size_t  arenaSize,
+                                 Datagram*    datagrams,
+                                 std::size_t  count,
+                                 std::size_t& received);
+
 private:
     ////////////////////////////////////////////////////////////
     // Member data
@@ -0,0 +1,67 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/AudioBlock.hpp>
+
+#include <cassert>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+AudioBlock::AudioBlock(float* const* channels, unsigned int channelCount, std::size_t frameCount) :
+    m_channels(channels),
+    m_channelCount(channelCount),
+    m_frameCount(frameCount)
+{
+    assert(frameCount <= MaxFrameCount && "AudioBlock::AudioBlock() Frame count exceeds the maximum block size");
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int AudioBlock::getChannelCount() const
+{
+    return m_channelCount;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t AudioBlock::getFrameCount() const
+{
+    return m_frameCount;
+}
+
+
+////////////////////////////////////////////////////////////
+float* AudioBlock::getChannel(unsigned int channel) const
+{
+    assert(channel < m_channelCount && "AudioBlock::getChannel() Channel index out of range");
+    return m_channels[channel];
+}
+
+} // namespace sf
@@ -0,0 +1,104 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/AudioBus.hpp>
+#include <SFML/Audio/AudioEffect.hpp>
+#include <SFML/Audio/MixBus.hpp>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+AudioBus::AudioBus() : m_mixBus(std::make_unique<priv::MixBus>(*this))
+{
+}
+
+
+////////////////////////////////////////////////////////////
+AudioBus::~AudioBus() = default;
+
+
+////////////////////////////////////////////////////////////
+void AudioBus::addEffect(std::shared_ptr<AudioEffect> effect)
+{
+    m_mixBus->addEffect(std::move(effect));
+}
+
+
+////////////////////////////////////////////////////////////
+void AudioBus::removeEffect(const AudioEffect& effect)
+{
+    m_mixBus->removeEffect(effect);
+}
+
+
+////////////////////////////////////////////////////////////
+void AudioBus::clearEffects()
+{
+    m_mixBus->clearEffects();
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t AudioBus::getEffectCount() const
+{
+    return m_mixBus->getEffectCount();
+}
+
+
+////////////////////////////////////////////////////////////
+void AudioBus::setOutput(AudioBus* output)
+{
+    m_mixBus->setOutput(output ? output->m_mixBus.get() : nullptr);
+}
+
+
+////////////////////////////////////////////////////////////
+AudioBus* AudioBus::getOutput() const
+{
+    if (const auto* output = m_mixBus->getOutput())
+        return &output->getOwner();
+
+    return nullptr;
+}
+
+
+////////////////////////////////////////////////////////////
+void AudioBus::setVolume(float volume)
+{
+    m_mixBus->setVolume(volume * 0.01f);
+}
+
+
+////////////////////////////////////////////////////////////
+float AudioBus::getVolume() const
+{
+    return m_mixBus->getVolume() * 100.f;
+}
+
+} // namespace sf
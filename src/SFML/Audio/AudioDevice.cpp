@@ -27,6 +27,7 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Audio/AudioDevice.hpp>
 #include <SFML/Audio/PlaybackDevice.hpp>
+#include <SFML/Audio/SoundCommandQueue.hpp>
 
 #include <SFML/System/Err.hpp>
 
@@ -36,6 +37,7 @@
 #include <unordered_map>
 
 #include <cassert>
+#include <cmath>
 
 
 namespace sf::priv
@@ -48,10 +50,17 @@ namespace
 // as possible, i.e. until it is requested by someone.
 // This also avoids static initialization order races in the
 // event some other static object gets/sets the current device.
+struct OfflineFormat
+{
+    unsigned int channelCount{};
+    unsigned int sampleRate{};
+};
+
 struct CurrentDeviceSelection
 {
-    std::optional<std::string> selection;
-    bool                       useNull{};
+    std::optional<std::string>   selection;
+    bool                         useNull{};
+    std::optional<OfflineFormat> offline;
 };
 
 CurrentDeviceSelection& getCurrentDeviceSelection()
@@ -164,15 +173,24 @@ bool AudioDevice::reinitialize()
 
     // Destroy the old engine
     if (instance->m_engine)
+    {
         ma_engine_uninit(&*instance->m_engine);
+        instance->m_engine.reset();
+    }
 
     // Destroy the old playback device
     if (instance->m_playbackDevice)
+    {
         ma_device_uninit(&*instance->m_playbackDevice);
+        instance->m_playbackDevice.reset();
+    }
 
     // Destroy the old context
     if (instance->m_context)
+    {
         ma_context_uninit(&*instance->m_context);
+        instance->m_context.reset();
+    }
 
     // Create the new objects
     const auto result = instance->initialize();
@@ -303,6 +321,7 @@ bool AudioDevice::setDevice(const std::string& name)
     auto& selection     = getCurrentDeviceSelection();
     selection.useNull   = false;
     selection.selection = name;
+    selection.offline.reset();
     return reinitialize();
 }
 
@@ -313,6 +332,7 @@ bool AudioDevice::setDeviceToDefault()
     auto& selection   = getCurrentDeviceSelection();
     selection.useNull = false;
     selection.selection.reset();
+    selection.offline.reset();
     return reinitialize();
 }
 
@@ -322,10 +342,93 @@ bool AudioDevice::setDeviceToNull()
 {
     auto& selection   = getCurrentDeviceSelection();
     selection.useNull = true;
+    selection.offline.reset();
     return reinitialize();
 }
 
 
+////////////////////////////////////////////////////////////
+bool AudioDevice::setDeviceToOffline(unsigned int channelCount, unsigned int sampleRate)
+{
+    if (channelCount < 1 || channelCount > MA_MAX_CHANNELS)
+    {
+        err() << "Unsupported channel count for offline rendering: " << channelCount << std::endl;
+        return false;
+    }
+
+    if (sampleRate < ma_standard_sample_rate_min || sampleRate > ma_standard_sample_rate_max)
+    {
+        err() << "Unsupported sample rate for offline rendering: " << sampleRate << std::endl;
+        return false;
+    }
+
+    auto& selection   = getCurrentDeviceSelection();
+    selection.offline = OfflineFormat{channelCount, sampleRate};
+    return reinitialize();
+}
+
+
+////////////////////////////////////////////////////////////
+bool AudioDevice::isOffline()
+{
+    return getCurrentDeviceSelection().offline.has_value();
+}
+
+
+////////////////////////////////////////////////////////////
+bool AudioDevice::render(std::int16_t* samples, std::uint64_t frameCount)
+{
+    const auto& offline = getCurrentDeviceSelection().offline;
+
+    if (!offline)
+    {
+        err() << "Failed to render audio: offline rendering is not enabled" << std::endl;
+        return false;
+    }
+
+    auto* instance = getInstance();
+
+    // Without any audio resource there is nothing to mix
+    if (!instance || !instance->m_engine)
+    {
+        std::fill(samples, samples + frameCount * offline->channelCount, std::int16_t{0});
+        return true;
+    }
+
+    const std::lock_guard lock(instance->m_readingDataMutex);
+
+    // Apply parameter changes submitted since the last render before mixing
+    SoundCommandQueue::apply();
+
+    // The engine mixes in floating point, convert the mix in chunks
+    std::array<float, 4096> buffer{};
+    const auto              channelCount = ma_engine_get_channels(&*instance->m_engine);
+    const auto              chunkSize    = buffer.size() / channelCount;
+
+    while (frameCount > 0)
+    {
+        const auto framesToRead = std::min<std::uint64_t>(frameCount, chunkSize);
+
+        if (const auto result = ma_engine_read_pcm_frames(&*instance->m_engine, buffer.data(), framesToRead, nullptr);
+            result != MA_SUCCESS)
+        {
+            err() << "Failed to read PCM frames from audio engine: " << ma_result_description(result) << std::endl;
+            return false;
+        }
+
+        const auto sampleCount = framesToRead * channelCount;
+
+        for (std::uint64_t i = 0; i < sampleCount; ++i)
+            samples[i] = static_cast<std::int16_t>(std::lround(std::clamp(buffer[i], -1.f, 1.f) * 32767.f));
+
+        samples += sampleCount;
+        frameCount -= framesToRead;
+    }
+
+    return true;
+}
+
+
 ////////////////////////////////////////////////////////////
 std::optional<std::string> AudioDevice::getDevice()
 {
@@ -380,6 +483,9 @@ void AudioDevice::setNotificationCallback(PlaybackDevice::NotificationCallback c
 ////////////////////////////////////////////////////////////
 std::optional<std::uint32_t> AudioDevice::getDeviceSampleRate()
 {
+    if (const auto& offline = getCurrentDeviceSelection().offline)
+        return offline->sampleRate;
+
     auto* instance = getInstance();
     if (instance && instance->m_playbackDevice)
         return instance->m_playbackDevice->sampleRate;
@@ -388,6 +494,20 @@ std::optional<std::uint32_t> AudioDevice::getDeviceSampleRate()
 }
 
 
+////////////////////////////////////////////////////////////
+std::optional<std::uint32_t> AudioDevice::getDeviceChannelCount()
+{
+    if (const auto& offline = getCurrentDeviceSelection().offline)
+        return offline->channelCount;
+
+    auto* instance = getInstance();
+    if (instance && instance->m_playbackDevice)
+        return instance->m_playbackDevice->playback.channels;
+
+    return std::nullopt;
+}
+
+
 ////////////////////////////////////////////////////////////
 AudioDevice::ResourceEntryIter AudioDevice::registerResource(void*               resource,
                                                              ResourceEntry::Func deinitializeFunc,
@@ -420,6 +540,22 @@ void AudioDevice::waitForReadingComplete()
 }
 
 
+////////////////////////////////////////////////////////////
+void AudioDevice::applySoundCommands()
+{
+    auto* instance = getInstance();
+
+    if (!instance)
+    {
+        SoundCommandQueue::apply();
+        return;
+    }
+
+    const std::lock_guard lock(instance->m_readingDataMutex);
+    SoundCommandQueue::apply();
+}
+
+
 ////////////////////////////////////////////////////////////
 void AudioDevice::setGlobalVolume(float volume)
 {
@@ -431,9 +567,7 @@ void AudioDevice::setGlobalVolume(float volume)
     if (!instance || !instance->m_engine)
         return;
 
-    if (const auto result = ma_device_set_master_volume(ma_engine_get_device(&*instance->m_engine), volume * 0.01f);
-        result != MA_SUCCESS)
-        err() << "Failed to set audio device master volume: " << ma_result_description(result) << std::endl;
+    instance->applyGlobalVolume();
 }
 
 
@@ -583,6 +717,10 @@ std::optional<ma_device_id> AudioDevice::getSelectedDeviceId() const
 ////////////////////////////////////////////////////////////
 bool AudioDevice::initialize()
 {
+    // Offline rendering needs neither a context nor a playback device
+    if (const auto& offline = getCurrentDeviceSelection().offline)
+        return initializeOffline(offline->channelCount, offline->sampleRate);
+
     // Create the context
     m_context.emplace();
 
@@ -650,6 +788,10 @@ bool AudioDevice::initialize()
         if (audioDevice.m_engine)
         {
             const std::lock_guard lock(audioDevice.m_readingDataMutex);
+
+            // Apply parameter changes submitted since the last cycle before mixing
+            SoundCommandQueue::apply();
+
             if (const auto result = ma_engine_read_pcm_frames(&*audioDevice.m_engine, output, frameCount, nullptr);
                 result != MA_SUCCESS)
                 err() << "Failed to read PCM frames from audio engine: " << ma_result_description(result) << std::endl;
@@ -714,11 +856,17 @@ bool AudioDevice::initialize()
         return false;
     }
 
+    applyListenerProperties();
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void AudioDevice::applyListenerProperties()
+{
     // Set master volume, position, velocity, cone and world up vector
-    if (const auto result = ma_device_set_master_volume(ma_engine_get_device(&*m_engine),
-                                                        getListenerProperties().volume * 0.01f);
-        result != MA_SUCCESS)
-        err() << "Failed to set audio device master volume: " << ma_result_description(result) << std::endl;
+    applyGlobalVolume();
 
     ma_engine_listener_set_position(&*m_engine,
                                     0,
@@ -740,11 +888,55 @@ bool AudioDevice::initialize()
                                     getListenerProperties().upVector.x,
                                     getListenerProperties().upVector.y,
                                     getListenerProperties().upVector.z);
+}
+
+
+////////////////////////////////////////////////////////////
+bool AudioDevice::initializeOffline(unsigned int channelCount, unsigned int sampleRate)
+{
+    // Mix in fixed blocks so that the output doesn't depend on how the frames are requested
+    auto engineConfig               = ma_engine_config_init();
+    engineConfig.pLog               = &*m_log;
+    engineConfig.noDevice           = MA_TRUE;
+    engineConfig.channels           = channelCount;
+    engineConfig.sampleRate         = sampleRate;
+    engineConfig.periodSizeInFrames = 512;
+    engineConfig.listenerCount      = 1;
+
+    m_engine.emplace();
+
+    if (const auto result = ma_engine_init(&engineConfig, &*m_engine); result != MA_SUCCESS)
+    {
+        m_engine.reset();
+        err() << "Failed to initialize the offline audio engine: " << ma_result_description(result) << std::endl;
+        return false;
+    }
+
+    applyListenerProperties();
 
     return true;
 }
 
 
+////////////////////////////////////////////////////////////
+void AudioDevice::applyGlobalVolume()
+{
+    const auto volume = getListenerProperties().volume * 0.01f;
+
+    // Without a device the volume is applied at the end of the engine's node graph
+    if (!m_playbackDevice)
+    {
+        if (const auto result = ma_engine_set_volume(&*m_engine, volume); result != MA_SUCCESS)
+            err() << "Failed to set audio engine volume: " << ma_result_description(result) << std::endl;
+
+        return;
+    }
+
+    if (const auto result = ma_device_set_master_volume(&*m_playbackDevice, volume); result != MA_SUCCESS)
+        err() << "Failed to set audio device master volume: " << ma_result_description(result) << std::endl;
+}
+
+
 ////////////////////////////////////////////////////////////
 AudioDevice*& AudioDevice::getInstance()
 {
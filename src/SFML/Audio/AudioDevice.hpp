@@ -170,6 +170,49 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] static bool setDeviceToNull();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Switch to offline rendering
+    ///
+    /// The engine is recreated without a playback device. No
+    /// audio thread mixes the sources anymore, instead the mix
+    /// is produced on demand by `render`.
+    ///
+    /// \param channelCount Number of channels of the rendered mix
+    /// \param sampleRate   Sample rate of the rendered mix
+    ///
+    /// \return `true`, if it was able to switch to offline rendering
+    ///
+    /// \see render, isOffline
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool setDeviceToOffline(unsigned int channelCount, unsigned int sampleRate);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Check whether offline rendering is selected
+    ///
+    /// \return `true` if offline rendering is selected
+    ///
+    /// \see setDeviceToOffline
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool isOffline();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Mix the next frames of all playing sources
+    ///
+    /// Only available in offline mode. If no audio resource
+    /// exists yet, silence is produced.
+    ///
+    /// \param samples    Buffer receiving `frameCount * getDeviceChannelCount()` interleaved samples
+    /// \param frameCount Number of frames to mix
+    ///
+    /// \return `true` on success, `false` if offline rendering is not selected or mixing failed
+    ///
+    /// \see setDeviceToOffline
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool render(std::int16_t* samples, std::uint64_t frameCount);
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the name of the current audio playback device
     ///
@@ -186,6 +229,14 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] static std::optional<std::uint32_t> getDeviceSampleRate();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the channel count of the current audio playback device
+    ///
+    /// \return The channel count of the current audio playback device or `std::nullopt` if there is none
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::optional<std::uint32_t> getDeviceChannelCount();
+
     ////////////////////////////////////////////////////////////
     /// \brief Check if the current playback device is the default device
     ///
@@ -258,6 +309,17 @@ public:
     ////////////////////////////////////////////////////////////
     static void waitForReadingComplete();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Apply all pending sound commands right away
+    ///
+    /// Sound commands are normally applied by the audio thread
+    /// at the start of each read cycle. This is used when a sound
+    /// is about to be destroyed or when no engine is available to
+    /// run read cycles at all.
+    ///
+    ////////////////////////////////////////////////////////////
+    static void applySoundCommands();
+
     ////////////////////////////////////////////////////////////
     /// \brief Change the global volume of all the sounds and musics
     ///
@@ -420,6 +482,29 @@ private:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool initialize();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Initialize an engine that isn't driven by a playback device
+    ///
+    /// \param channelCount Number of channels of the rendered mix
+    /// \param sampleRate   Sample rate of the rendered mix
+    ///
+    /// \return `true` if initialization was successful, `false` if it failed
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool initializeOffline(unsigned int channelCount, unsigned int sampleRate);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Apply the stored listener properties to the engine
+    ///
+    ////////////////////////////////////////////////////////////
+    void applyListenerProperties();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Apply the global volume to the device or, in offline mode, the engine
+    ///
+    ////////////////////////////////////////////////////////////
+    void applyGlobalVolume();
+
     ////////////////////////////////////////////////////////////
     /// \brief This function makes sure the instance pointer is initialized before using it
     ///
@@ -0,0 +1,233 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/AudioBlock.hpp>
+#include <SFML/Audio/BiquadFilter.hpp>
+
+#include <algorithm>
+
+#include <cmath>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+BiquadFilter::BiquadFilter(Type type, float frequency, float quality, float gain) :
+    m_type(type),
+    m_frequency(frequency),
+    m_quality(quality),
+    m_gain(gain)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void BiquadFilter::setType(Type type)
+{
+    m_type  = type;
+    m_dirty = true;
+}
+
+
+////////////////////////////////////////////////////////////
+BiquadFilter::Type BiquadFilter::getType() const
+{
+    return m_type;
+}
+
+
+////////////////////////////////////////////////////////////
+void BiquadFilter::setFrequency(float frequency)
+{
+    m_frequency = frequency;
+    m_dirty     = true;
+}
+
+
+////////////////////////////////////////////////////////////
+float BiquadFilter::getFrequency() const
+{
+    return m_frequency;
+}
+
+
+////////////////////////////////////////////////////////////
+void BiquadFilter::setQuality(float quality)
+{
+    m_quality = quality;
+    m_dirty   = true;
+}
+
+
+////////////////////////////////////////////////////////////
+float BiquadFilter::getQuality() const
+{
+    return m_quality;
+}
+
+
+////////////////////////////////////////////////////////////
+void BiquadFilter::setGain(float gain)
+{
+    m_gain  = gain;
+    m_dirty = true;
+}
+
+
+////////////////////////////////////////////////////////////
+float BiquadFilter::getGain() const
+{
+    return m_gain;
+}
+
+
+////////////////////////////////////////////////////////////
+void BiquadFilter::prepare(unsigned int sampleRate, unsigned int channelCount)
+{
+    m_sampleRate = sampleRate;
+    m_states.assign(channelCount, {});
+    m_dirty = true;
+}
+
+
+////////////////////////////////////////////////////////////
+void BiquadFilter::process(AudioBlock& block)
+{
+    if (m_dirty.exchange(false))
+        updateCoefficients();
+
+    const unsigned int channelCount = std::min(block.getChannelCount(), static_cast<unsigned int>(m_states.size()));
+
+    for (unsigned int channel = 0; channel < channelCount; ++channel)
+    {
+        float* samples = block.getChannel(channel);
+        auto [z1, z2]  = m_states[channel];
+
+        // Transposed direct form II, numerically robust with single precision
+        for (std::size_t i = 0; i < block.getFrameCount(); ++i)
+        {
+            const float input  = samples[i];
+            const float output = m_b0 * input + z1;
+            z1                 = m_b1 * input - m_a1 * output + z2;
+            z2                 = m_b2 * input - m_a2 * output;
+            samples[i]         = output;
+        }
+
+        m_states[channel] = {z1, z2};
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void BiquadFilter::updateCoefficients()
+{
+    const float nyquist   = static_cast<float>(m_sampleRate) / 2.f;
+    const float frequency = std::clamp(m_frequency.load(), 1.f, nyquist * 0.99f);
+    const float quality   = std::max(m_quality.load(), 0.001f);
+    const float omega     = 2.f * 3.14159265358979f * frequency / static_cast<float>(m_sampleRate);
+    const float cosOmega  = std::cos(omega);
+    const float alpha     = std::sin(omega) / (2.f * quality);
+    const float amplitude = std::pow(10.f, m_gain / 40.f);
+    const float shelf     = 2.f * std::sqrt(amplitude) * alpha;
+
+    float b0 = 1.f;
+    float b1 = 0.f;
+    float b2 = 0.f;
+    float a0 = 1.f;
+    float a1 = 0.f;
+    float a2 = 0.f;
+
+    switch (m_type)
+    {
+        case Type::LowPass:
+            b0 = (1.f - cosOmega) / 2.f;
+            b1 = 1.f - cosOmega;
+            b2 = (1.f - cosOmega) / 2.f;
+            a0 = 1.f + alpha;
+            a1 = -2.f * cosOmega;
+            a2 = 1.f - alpha;
+            break;
+        case Type::HighPass:
+            b0 = (1.f + cosOmega) / 2.f;
+            b1 = -(1.f + cosOmega);
+            b2 = (1.f + cosOmega) / 2.f;
+            a0 = 1.f + alpha;
+            a1 = -2.f * cosOmega;
+            a2 = 1.f - alpha;
+            break;
+        case Type::BandPass:
+            b0 = alpha;
+            b1 = 0.f;
+            b2 = -alpha;
+            a0 = 1.f + alpha;
+            a1 = -2.f * cosOmega;
+            a2 = 1.f - alpha;
+            break;
+        case Type::Notch:
+            b0 = 1.f;
+            b1 = -2.f * cosOmega;
+            b2 = 1.f;
+            a0 = 1.f + alpha;
+            a1 = -2.f * cosOmega;
+            a2 = 1.f - alpha;
+            break;
+        case Type::Peak:
+            b0 = 1.f + alpha * amplitude;
+            b1 = -2.f * cosOmega;
+            b2 = 1.f - alpha * amplitude;
+            a0 = 1.f + alpha / amplitude;
+            a1 = -2.f * cosOmega;
+            a2 = 1.f - alpha / amplitude;
+            break;
+        case Type::LowShelf:
+            b0 = amplitude * ((amplitude + 1.f) - (amplitude - 1.f) * cosOmega + shelf);
+            b1 = 2.f * amplitude * ((amplitude - 1.f) - (amplitude + 1.f) * cosOmega);
+            b2 = amplitude * ((amplitude + 1.f) - (amplitude - 1.f) * cosOmega - shelf);
+            a0 = (amplitude + 1.f) + (amplitude - 1.f) * cosOmega + shelf;
+            a1 = -2.f * ((amplitude - 1.f) + (amplitude + 1.f) * cosOmega);
+            a2 = (amplitude + 1.f) + (amplitude - 1.f) * cosOmega - shelf;
+            break;
+        case Type::HighShelf:
+            b0 = amplitude * ((amplitude + 1.f) + (amplitude - 1.f) * cosOmega + shelf);
+            b1 = -2.f * amplitude * ((amplitude - 1.f) + (amplitude + 1.f) * cosOmega);
+            b2 = amplitude * ((amplitude + 1.f) + (amplitude - 1.f) * cosOmega - shelf);
+            a0 = (amplitude + 1.f) - (amplitude - 1.f) * cosOmega + shelf;
+            a1 = 2.f * ((amplitude - 1.f) - (amplitude + 1.f) * cosOmega);
+            a2 = (amplitude + 1.f) - (amplitude - 1.f) * cosOmega - shelf;
+            break;
+    }
+
+    // Normalize so that a0 is 1
+    m_b0 = b0 / a0;
+    m_b1 = b1 / a0;
+    m_b2 = b2 / a0;
+    m_a1 = a1 / a0;
+    m_a2 = a2 / a0;
+}
+
+} // namespace sf
@@ -0,0 +1,138 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/AudioBlock.hpp>
+#include <SFML/Audio/DelayEffect.hpp>
+
+#include <algorithm>
+
+#include <cmath>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+DelayEffect::DelayEffect(Time maxDelay) : m_maxDelay(std::max(maxDelay, Time::Zero)), m_delay(m_maxDelay.asSeconds() / 2.f)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void DelayEffect::setDelay(Time delay)
+{
+    m_delay = std::clamp(delay, Time::Zero, m_maxDelay).asSeconds();
+}
+
+
+////////////////////////////////////////////////////////////
+Time DelayEffect::getDelay() const
+{
+    return seconds(m_delay);
+}
+
+
+////////////////////////////////////////////////////////////
+void DelayEffect::setFeedback(float feedback)
+{
+    m_feedback = std::clamp(feedback, 0.f, 0.99f);
+}
+
+
+////////////////////////////////////////////////////////////
+float DelayEffect::getFeedback() const
+{
+    return m_feedback;
+}
+
+
+////////////////////////////////////////////////////////////
+void DelayEffect::setMix(float mix)
+{
+    m_mix = std::clamp(mix, 0.f, 1.f);
+}
+
+
+////////////////////////////////////////////////////////////
+float DelayEffect::getMix() const
+{
+    return m_mix;
+}
+
+
+////////////////////////////////////////////////////////////
+void DelayEffect::prepare(unsigned int sampleRate, unsigned int channelCount)
+{
+    // One extra frame so that the maximum delay does not read the sample being written
+    const auto length = static_cast<std::size_t>(std::ceil(m_maxDelay.asSeconds() * static_cast<float>(sampleRate))) + 1;
+
+    m_sampleRate = sampleRate;
+    m_lines.assign(channelCount, std::vector<float>(length));
+    m_writePosition = 0;
+}
+
+
+////////////////////////////////////////////////////////////
+void DelayEffect::process(AudioBlock& block)
+{
+    if (m_lines.empty())
+        return;
+
+    const std::size_t  length       = m_lines.front().size();
+    const float        delayFrames  = std::round(m_delay * static_cast<float>(m_sampleRate));
+    const std::size_t  delay        = std::min(static_cast<std::size_t>(delayFrames), length - 1);
+    const float        feedback     = m_feedback;
+    const float        wet          = m_mix;
+    const float        dry          = 1.f - wet;
+    const unsigned int channelCount = std::min(block.getChannelCount(), static_cast<unsigned int>(m_lines.size()));
+
+    for (unsigned int channel = 0; channel < channelCount; ++channel)
+    {
+        float*      samples       = block.getChannel(channel);
+        auto&       line          = m_lines[channel];
+        std::size_t writePosition = m_writePosition;
+        std::size_t readPosition  = (writePosition + length - delay) % length;
+
+        for (std::size_t i = 0; i < block.getFrameCount(); ++i)
+        {
+            const float input   = samples[i];
+            const float delayed = (delay == 0) ? input : line[readPosition];
+
+            line[writePosition] = input + delayed * feedback;
+            samples[i]          = input * dry + delayed * wet;
+
+            if (++writePosition == length)
+                writePosition = 0;
+            if (++readPosition == length)
+                readPosition = 0;
+        }
+    }
+
+    m_writePosition = (m_writePosition + block.getFrameCount()) % length;
+}
+
+} // namespace sf
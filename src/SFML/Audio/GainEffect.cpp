@@ -0,0 +1,89 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/AudioBlock.hpp>
+#include <SFML/Audio/GainEffect.hpp>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+GainEffect::GainEffect(float gain) : m_gain(gain), m_currentGain(gain)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void GainEffect::setGain(float gain)
+{
+    m_gain = gain;
+}
+
+
+////////////////////////////////////////////////////////////
+float GainEffect::getGain() const
+{
+    return m_gain;
+}
+
+
+////////////////////////////////////////////////////////////
+void GainEffect::process(AudioBlock& block)
+{
+    const float       gain       = m_gain;
+    const std::size_t frameCount = block.getFrameCount();
+
+    if (frameCount == 0)
+        return;
+
+    if (gain == m_currentGain)
+    {
+        for (unsigned int channel = 0; channel < block.getChannelCount(); ++channel)
+        {
+            float* samples = block.getChannel(channel);
+            for (std::size_t i = 0; i < frameCount; ++i)
+                samples[i] *= gain;
+        }
+
+        return;
+    }
+
+    // Ramp linearly from the previous gain to avoid zipper noise
+    const float step = (gain - m_currentGain) / static_cast<float>(frameCount);
+
+    for (unsigned int channel = 0; channel < block.getChannelCount(); ++channel)
+    {
+        float* samples = block.getChannel(channel);
+        for (std::size_t i = 0; i < frameCount; ++i)
+            samples[i] *= m_currentGain + step * static_cast<float>(i + 1);
+    }
+
+    m_currentGain = gain;
+}
+
+} // namespace sf
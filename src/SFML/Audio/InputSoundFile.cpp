@@ -94,7 +94,8 @@ InputSoundFile::InputSoundFile(InputStream& stream)
 ////////////////////////////////////////////////////////////
 bool InputSoundFile::openFromFile(const std::filesystem::path& filename)
 {
-    // If the file is already open, first close it
+    // If the file is already open, first close it (keeping the seek index meant for the new file)
+    const std::optional<SeekIndex> seekIndex = std::exchange(m_seekIndex, std::nullopt);
     close();
 
     // Find a suitable reader for the file type
@@ -115,6 +116,8 @@ bool InputSoundFile::openFromFile(const std::filesystem::path& filename)
     }
 
     // Pass the stream to the reader
+    if (seekIndex)
+        reader->setSeekIndex(*seekIndex);
     const auto info = reader->open(*file);
     if (!info)
     {
@@ -140,7 +143,8 @@ bool InputSoundFile::openFromFile(const std::filesystem::path& filename)
 ////////////////////////////////////////////////////////////
 bool InputSoundFile::openFromMemory(const void* data, std::size_t sizeInBytes)
 {
-    // If the file is already open, first close it
+    // If the file is already open, first close it (keeping the seek index meant for the new file)
+    const std::optional<SeekIndex> seekIndex = std::exchange(m_seekIndex, std::nullopt);
     close();
 
     // Find a suitable reader for the file type
@@ -155,6 +159,8 @@ bool InputSoundFile::openFromMemory(const void* data, std::size_t sizeInBytes)
     auto memory = std::make_unique<MemoryInputStream>(data, sizeInBytes);
 
     // Pass the stream to the reader
+    if (seekIndex)
+        reader->setSeekIndex(*seekIndex);
     const auto info = reader->open(*memory);
     if (!info)
     {
@@ -178,7 +184,8 @@ bool InputSoundFile::openFromMemory(const void* data, std::size_t sizeInBytes)
 ////////////////////////////////////////////////////////////
 bool InputSoundFile::openFromStream(InputStream& stream)
 {
-    // If the file is already open, first close it
+    // If the file is already open, first close it (keeping the seek index meant for the new file)
+    const std::optional<SeekIndex> seekIndex = std::exchange(m_seekIndex, std::nullopt);
     close();
 
     // Find a suitable reader for the file type
@@ -197,6 +204,8 @@ bool InputSoundFile::openFromStream(InputStream& stream)
     }
 
     // Pass the stream to the reader
+    if (seekIndex)
+        reader->setSeekIndex(*seekIndex);
     const auto info = reader->open(stream);
     if (!info)
     {
@@ -311,6 +320,23 @@ std::uint64_t InputSoundFile::read(std::int16_t* samples, std::uint64_t maxCount
 }
 
 
+////////////////////////////////////////////////////////////
+void InputSoundFile::setSeekIndex(const SeekIndex& seekIndex)
+{
+    m_seekIndex = seekIndex;
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<SeekIndex> InputSoundFile::getSeekIndex() const
+{
+    if (!m_reader)
+        return std::nullopt;
+
+    return m_reader->getSeekIndex();
+}
+
+
 ////////////////////////////////////////////////////////////
 void InputSoundFile::close()
 {
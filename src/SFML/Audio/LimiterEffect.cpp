@@ -0,0 +1,129 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/AudioBlock.hpp>
+#include <SFML/Audio/LimiterEffect.hpp>
+
+#include <algorithm>
+#include <array>
+
+#include <cmath>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+LimiterEffect::LimiterEffect(float threshold, Time release) :
+    m_threshold(std::max(threshold, 0.f)),
+    m_release(std::max(release, Time::Zero).asSeconds())
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void LimiterEffect::setThreshold(float threshold)
+{
+    m_threshold = std::max(threshold, 0.f);
+}
+
+
+////////////////////////////////////////////////////////////
+float LimiterEffect::getThreshold() const
+{
+    return m_threshold;
+}
+
+
+////////////////////////////////////////////////////////////
+void LimiterEffect::setRelease(Time release)
+{
+    m_release = std::max(release, Time::Zero).asSeconds();
+}
+
+
+////////////////////////////////////////////////////////////
+Time LimiterEffect::getRelease() const
+{
+    return seconds(m_release);
+}
+
+
+////////////////////////////////////////////////////////////
+float LimiterEffect::getCurrentGain() const
+{
+    return m_gain;
+}
+
+
+////////////////////////////////////////////////////////////
+void LimiterEffect::prepare(unsigned int sampleRate, unsigned int)
+{
+    m_sampleRate = sampleRate;
+    m_gain       = 1.f;
+}
+
+
+////////////////////////////////////////////////////////////
+void LimiterEffect::process(AudioBlock& block)
+{
+    const float       threshold     = m_threshold;
+    const float       releaseFrames = m_release * static_cast<float>(m_sampleRate);
+    const float       recovery      = releaseFrames > 0.f ? 1.f - std::exp(-1.f / releaseFrames) : 1.f;
+    const std::size_t frameCount    = block.getFrameCount();
+
+    // Find the peak of each frame across all channels
+    std::array<float, AudioBlock::MaxFrameCount> gains{};
+
+    for (unsigned int channel = 0; channel < block.getChannelCount(); ++channel)
+    {
+        const float* samples = block.getChannel(channel);
+        for (std::size_t i = 0; i < frameCount; ++i)
+            gains[i] = std::max(gains[i], std::abs(samples[i]));
+    }
+
+    // Turn the peaks into gains, attacking instantly and releasing smoothly
+    float gain = m_gain;
+
+    for (std::size_t i = 0; i < frameCount; ++i)
+    {
+        const float target = gains[i] > threshold ? threshold / gains[i] : 1.f;
+        gain               = target < gain ? target : gain + (target - gain) * recovery;
+        gains[i]           = gain;
+    }
+
+    m_gain = gain;
+
+    for (unsigned int channel = 0; channel < block.getChannelCount(); ++channel)
+    {
+        float* samples = block.getChannel(channel);
+        for (std::size_t i = 0; i < frameCount; ++i)
+            samples[i] *= gains[i];
+    }
+}
+
+} // namespace sf
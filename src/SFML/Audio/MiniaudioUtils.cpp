@@ -27,7 +27,9 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Audio/AudioDevice.hpp>
 #include <SFML/Audio/MiniaudioUtils.hpp>
+#include <SFML/Audio/MixBus.hpp>
 #include <SFML/Audio/SoundChannel.hpp>
+#include <SFML/Audio/VoicePool.hpp>
 
 #include <SFML/System/Err.hpp>
 #include <SFML/System/Time.hpp>
@@ -105,6 +107,19 @@ void applySettings(ma_sound& sound, const sf::priv::MiniaudioUtils::SavedSetting
         ma_sound_stop(&sound);
     }
 }
+
+
+////////////////////////////////////////////////////////////
+std::uint32_t getSampleRate(ma_sound& sound)
+{
+    std::uint32_t sampleRate{};
+
+    if (const ma_result result = ma_sound_get_data_format(&sound, nullptr, nullptr, &sampleRate, nullptr, 0);
+        result != MA_SUCCESS)
+        sf::err() << "Failed to get sound data format: " << ma_result_description(result) << std::endl;
+
+    return sampleRate;
+}
 } // namespace
 
 
@@ -125,12 +140,22 @@ MiniaudioUtils::SoundBase::SoundBase(const ma_data_source_vtable&     dataSource
         this,
         [](void* ptr) { static_cast<SoundBase*>(ptr)->deinitialize(); },
         reinitializeFunc);
+
+    VoicePool::registerVoice(*this);
 }
 
 
 ////////////////////////////////////////////////////////////
 MiniaudioUtils::SoundBase::~SoundBase()
 {
+    VoicePool::unregisterVoice(*this);
+
+    if (bus)
+        bus->detachSource(*this);
+
+    // Make sure no pending command refers to the sound once it is gone
+    AudioDevice::applySoundCommands();
+
     AudioDevice::unregisterResource(resourceEntryIter);
     ma_sound_uninit(&sound);
     ma_node_uninit(&effectNode, nullptr);
@@ -188,17 +213,32 @@ void MiniaudioUtils::SoundBase::initialize(ma_sound_end_proc endCallback)
     effectNode.impl         = this;
     effectNode.channelCount = nodeChannelCount;
 
+    initialized = true;
+
     // Route the sound through the effect node depending on whether an effect processor is set
     connectEffect(bool{effectProcessor});
 
     applySettings(sound, savedSettings);
+
+    // Virtual voices continue advancing from the position they had reached on the previous engine
+    if (isVirtual)
+        virtualStartTime = ma_engine_get_time_in_pcm_frames(engine);
 }
 
 
 ////////////////////////////////////////////////////////////
 void MiniaudioUtils::SoundBase::deinitialize()
 {
+    if (isVirtual)
+    {
+        if (const auto cursor = getVirtualCursor())
+            virtualCursor = *cursor;
+        else
+            leaveVirtual(false);
+    }
+
     savedSettings = saveSettings(sound);
+    initialized   = false;
     ma_sound_uninit(&sound);
     ma_node_uninit(&effectNode, nullptr);
 }
@@ -246,28 +286,31 @@ void MiniaudioUtils::SoundBase::connectEffect(bool connect)
         return;
     }
 
+    // Sounds routed into a bus feed its node, all others feed the engine endpoint directly
+    ma_node* output = (bus && bus->getNode()) ? bus->getNode() : ma_engine_get_endpoint(engine);
+
     if (connect)
     {
-        // Attach the custom effect node output to our engine endpoint
-        if (const ma_result result = ma_node_attach_output_bus(&effectNode, 0, ma_engine_get_endpoint(engine), 0);
-            result != MA_SUCCESS)
+        // Attach the custom effect node output to our output node
+        if (const ma_result result = ma_node_attach_output_bus(&effectNode, 0, output, 0); result != MA_SUCCESS)
         {
-            err() << "Failed to attach effect node output to endpoint: " << ma_result_description(result) << std::endl;
+            err() << "Failed to attach effect node output to output node: " << ma_result_description(result) << std::endl;
             return;
         }
     }
     else
     {
-        // Detach the custom effect node output from our engine endpoint
+        // Detach the custom effect node output from our output node
         if (const ma_result result = ma_node_detach_output_bus(&effectNode, 0); result != MA_SUCCESS)
         {
-            err() << "Failed to detach effect node output from endpoint: " << ma_result_description(result) << std::endl;
+            err() << "Failed to detach effect node output from output node: " << ma_result_description(result)
+                  << std::endl;
             return;
         }
     }
 
-    // Attach the sound output to the custom effect node or the engine endpoint
-    if (const ma_result result = ma_node_attach_output_bus(&sound, 0, connect ? &effectNode : ma_engine_get_endpoint(engine), 0);
+    // Attach the sound output to the custom effect node or the output node
+    if (const ma_result result = ma_node_attach_output_bus(&sound, 0, connect ? &effectNode : output, 0);
         result != MA_SUCCESS)
     {
         err() << "Failed to attach sound node output to effect node: " << ma_result_description(result) << std::endl;
@@ -276,6 +319,152 @@ void MiniaudioUtils::SoundBase::connectEffect(bool connect)
 }
 
 
+////////////////////////////////////////////////////////////
+void MiniaudioUtils::SoundBase::setBus(MixBus* newBus)
+{
+    if (newBus == bus)
+        return;
+
+    if (bus)
+        bus->detachSource(*this);
+
+    bus = newBus;
+
+    if (bus)
+        bus->attachSource(*this);
+
+    if (initialized)
+        connectEffect(bool{effectProcessor});
+}
+
+
+////////////////////////////////////////////////////////////
+ma_result MiniaudioUtils::SoundBase::start()
+{
+    // Voices that don't get a slot keep playing virtually until one frees up
+    if (!VoicePool::acquire(*this))
+    {
+        enterVirtual();
+        return MA_SUCCESS;
+    }
+
+    isVirtual = false;
+    return ma_sound_start(&sound);
+}
+
+
+////////////////////////////////////////////////////////////
+void MiniaudioUtils::SoundBase::enterVirtual()
+{
+    if (const ma_result result = ma_sound_get_cursor_in_pcm_frames(&sound, &virtualCursor); result != MA_SUCCESS)
+    {
+        err() << "Failed to get sound cursor: " << ma_result_description(result) << std::endl;
+        virtualCursor = 0;
+    }
+
+    auto* engine     = AudioDevice::getEngine();
+    virtualStartTime = engine ? ma_engine_get_time_in_pcm_frames(engine) : 0;
+    isVirtual        = true;
+
+    if (const ma_result result = ma_sound_stop(&sound); result != MA_SUCCESS)
+        err() << "Failed to stop virtual sound: " << ma_result_description(result) << std::endl;
+}
+
+
+////////////////////////////////////////////////////////////
+bool MiniaudioUtils::SoundBase::leaveVirtual(bool resume)
+{
+    const auto cursor = getVirtualCursor();
+    isVirtual         = false;
+
+    // The voice would have finished playing while it was virtual
+    if (!cursor)
+    {
+        status = SoundSource::Status::Stopped;
+
+        if (const ma_result result = ma_sound_seek_to_pcm_frame(&sound, 0); result != MA_SUCCESS)
+            err() << "Failed to seek sound to frame 0: " << ma_result_description(result) << std::endl;
+
+        return false;
+    }
+
+    if (const ma_result result = ma_sound_seek_to_pcm_frame(&sound, *cursor); result != MA_SUCCESS)
+        err() << "Failed to seek sound to pcm frame: " << ma_result_description(result) << std::endl;
+
+    if (resume)
+    {
+        if (const ma_result result = ma_sound_start(&sound); result != MA_SUCCESS)
+            err() << "Failed to start playing sound: " << ma_result_description(result) << std::endl;
+    }
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void MiniaudioUtils::SoundBase::reconsiderVirtual()
+{
+    // A virtual voice which became audible or came back in range is mixed again right away if it gets a slot
+    if (isVirtual && (status == SoundSource::Status::Playing) && VoicePool::acquire(*this))
+        (void)leaveVirtual(true);
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<std::uint64_t> MiniaudioUtils::SoundBase::getVirtualCursor()
+{
+    auto cursor = virtualCursor;
+
+    // Advance the cursor as if the voice had been mixed at its current pitch
+    if (auto* engine = AudioDevice::getEngine())
+    {
+        const auto engineTime       = ma_engine_get_time_in_pcm_frames(engine);
+        const auto engineSampleRate = ma_engine_get_sample_rate(engine);
+        const auto elapsed          = engineTime > virtualStartTime ? engineTime - virtualStartTime : 0;
+
+        if (engineSampleRate != 0)
+            cursor += static_cast<std::uint64_t>(static_cast<double>(elapsed) *
+                                                 static_cast<double>(ma_sound_get_pitch(&sound)) *
+                                                 static_cast<double>(getSampleRate(sound)) / static_cast<double>(engineSampleRate));
+    }
+
+    // Streams don't know their length, they report their end themselves once seeked past it
+    std::uint64_t length{};
+
+    if ((ma_sound_get_length_in_pcm_frames(&sound, &length) != MA_SUCCESS) || (length == 0) || (cursor < length))
+        return cursor;
+
+    if (ma_sound_is_looping(&sound))
+        return cursor % length;
+
+    return std::nullopt;
+}
+
+
+////////////////////////////////////////////////////////////
+Time MiniaudioUtils::SoundBase::getPlayingOffset()
+{
+    if (!isVirtual)
+        return MiniaudioUtils::getPlayingOffset(sound);
+
+    const auto cursor     = getVirtualCursor();
+    const auto sampleRate = getSampleRate(sound);
+
+    if (!cursor || sampleRate == 0)
+        return Time::Zero;
+
+    return seconds(static_cast<float>(*cursor) / static_cast<float>(sampleRate));
+}
+
+
+////////////////////////////////////////////////////////////
+MiniaudioUtils::SoundBase* MiniaudioUtils::getSoundBase(const ma_sound& sound)
+{
+    // The sound base registers itself as the user data of the end callback when initializing the sound
+    return static_cast<SoundBase*>(sound.pEndCallbackUserData);
+}
+
+
 ////////////////////////////////////////////////////////////
 ma_channel MiniaudioUtils::soundChannelToMiniaudioChannel(SoundChannel soundChannel)
 {
@@ -36,6 +36,7 @@
 #include <miniaudio.h>
 
 #include <limits>
+#include <optional>
 
 
 ////////////////////////////////////////////////////////////
@@ -46,6 +47,11 @@ namespace sf
 {
 class Time;
 
+namespace priv
+{
+class MixBus;
+}
+
 namespace priv::MiniaudioUtils
 {
 struct SavedSettings
@@ -80,6 +86,14 @@ struct SoundBase
     void deinitialize();
     void processEffect(const float** framesIn, std::uint32_t& frameCountIn, float** framesOut, std::uint32_t& frameCountOut) const;
     void connectEffect(bool connect);
+    void setBus(MixBus* newBus);
+
+    [[nodiscard]] ma_result                    start();
+    void                                       enterVirtual();
+    bool                                       leaveVirtual(bool resume);
+    void                                       reconsiderVirtual();
+    [[nodiscard]] std::optional<std::uint64_t> getVirtualCursor();
+    [[nodiscard]] Time                         getPlayingOffset();
 
     ////////////////////////////////////////////////////////////
     // Member data
@@ -100,8 +114,15 @@ struct SoundBase
     SoundSource::EffectProcessor effectProcessor;                      //!< The effect processor
     AudioDevice::ResourceEntryIter resourceEntryIter; //!< Iterator to the resource entry registered with the AudioDevice
     MiniaudioUtils::SavedSettings savedSettings; //!< Saved settings used to restore ma_sound state in case we need to recreate it
+    MixBus*       bus{};              //!< Bus the sound is routed into, `nullptr` for the engine endpoint
+    bool          initialized{};      //!< `true` if the sound and effect nodes are initialized
+    int           priority{};         //!< Priority of the voice when competing for a voice slot
+    bool          isVirtual{};        //!< `true` if the voice is playing without being mixed
+    std::uint64_t virtualCursor{};    //!< Source frame at which the voice became virtual
+    std::uint64_t virtualStartTime{}; //!< Engine time (in frames) at which the voice became virtual
 };
 
+[[nodiscard]] SoundBase*    getSoundBase(const ma_sound& sound);
 [[nodiscard]] ma_channel    soundChannelToMiniaudioChannel(SoundChannel soundChannel);
 [[nodiscard]] SoundChannel  miniaudioChannelToSoundChannel(ma_channel soundChannel);
 [[nodiscard]] Time          getPlayingOffset(ma_sound& sound);
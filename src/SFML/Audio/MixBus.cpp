@@ -0,0 +1,357 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/AudioEffect.hpp>
+#include <SFML/Audio/MiniaudioUtils.hpp>
+#include <SFML/Audio/MixBus.hpp>
+
+#include <SFML/System/Err.hpp>
+
+#include <algorithm>
+#include <ostream>
+
+#include <cstring>
+
+
+namespace
+{
+constexpr std::size_t chunksPerChannel = sf::AudioBlock::MaxFrameCount * sizeof(float) / sf::AudioBlock::Alignment;
+} // namespace
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+MixBus::MixBus(AudioBus& owner) : m_owner(owner)
+{
+    m_resourceEntryIter = AudioDevice::registerResource(
+        this,
+        [](void* ptr) { static_cast<MixBus*>(ptr)->deinitialize(); },
+        [](void* ptr) { static_cast<MixBus*>(ptr)->initialize(); });
+
+    initialize();
+}
+
+
+////////////////////////////////////////////////////////////
+MixBus::~MixBus()
+{
+    // Copy the lists since rerouting removes the entries
+    for (auto* source : std::vector(m_sources))
+        source->setBus(nullptr);
+
+    for (auto* input : std::vector(m_inputs))
+        input->setOutput(nullptr);
+
+    setOutput(nullptr);
+
+    AudioDevice::unregisterResource(m_resourceEntryIter);
+    deinitialize();
+}
+
+
+////////////////////////////////////////////////////////////
+void MixBus::addEffect(std::shared_ptr<AudioEffect> effect)
+{
+    if (!effect)
+        return;
+
+    const std::lock_guard lock(m_effectMutex);
+
+    if (m_initialized)
+        effect->prepare(m_sampleRate, m_channelCount);
+
+    m_effects.push_back(std::move(effect));
+}
+
+
+////////////////////////////////////////////////////////////
+void MixBus::removeEffect(const AudioEffect& effect)
+{
+    const std::lock_guard lock(m_effectMutex);
+    m_effects.erase(std::remove_if(m_effects.begin(),
+                                   m_effects.end(),
+                                   [&effect](const auto& entry) { return entry.get() == &effect; }),
+                    m_effects.end());
+}
+
+
+////////////////////////////////////////////////////////////
+void MixBus::clearEffects()
+{
+    const std::lock_guard lock(m_effectMutex);
+    m_effects.clear();
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t MixBus::getEffectCount() const
+{
+    const std::lock_guard lock(m_effectMutex);
+    return m_effects.size();
+}
+
+
+////////////////////////////////////////////////////////////
+void MixBus::setOutput(MixBus* output)
+{
+    if (output == m_output)
+        return;
+
+    // Refuse to create a feedback loop
+    for (const auto* bus = output; bus; bus = bus->m_output)
+    {
+        if (bus == this)
+        {
+            err() << "Failed to set audio bus output: Routing would create a loop" << std::endl;
+            return;
+        }
+    }
+
+    if (m_output)
+        m_output->m_inputs.erase(std::remove(m_output->m_inputs.begin(), m_output->m_inputs.end(), this),
+                                 m_output->m_inputs.end());
+
+    m_output = output;
+
+    if (m_output)
+        m_output->m_inputs.push_back(this);
+
+    if (m_initialized)
+        connect();
+}
+
+
+////////////////////////////////////////////////////////////
+MixBus* MixBus::getOutput() const
+{
+    return m_output;
+}
+
+
+////////////////////////////////////////////////////////////
+void MixBus::setVolume(float volume)
+{
+    m_volume = volume;
+
+    if (m_initialized)
+        ma_node_set_output_bus_volume(&m_node, 0, m_volume);
+}
+
+
+////////////////////////////////////////////////////////////
+float MixBus::getVolume() const
+{
+    return m_volume;
+}
+
+
+////////////////////////////////////////////////////////////
+void MixBus::attachSource(MiniaudioUtils::SoundBase& source)
+{
+    m_sources.push_back(&source);
+}
+
+
+////////////////////////////////////////////////////////////
+void MixBus::detachSource(MiniaudioUtils::SoundBase& source)
+{
+    m_sources.erase(std::remove(m_sources.begin(), m_sources.end(), &source), m_sources.end());
+}
+
+
+////////////////////////////////////////////////////////////
+ma_node* MixBus::getNode()
+{
+    return m_initialized ? &m_node : nullptr;
+}
+
+
+////////////////////////////////////////////////////////////
+AudioBus& MixBus::getOwner() const
+{
+    return m_owner;
+}
+
+
+////////////////////////////////////////////////////////////
+void MixBus::initialize()
+{
+    auto* engine = AudioDevice::getEngine();
+
+    if (engine == nullptr)
+    {
+        err() << "Failed to initialize audio bus: No engine available" << std::endl;
+        return;
+    }
+
+    m_vtable.onProcess =
+        [](ma_node* node, const float** framesIn, std::uint32_t* frameCountIn, float** framesOut, std::uint32_t* frameCountOut)
+    { static_cast<Node*>(node)->impl->process(framesIn, *frameCountIn, framesOut, *frameCountOut); };
+    m_vtable.onGetRequiredInputFrameCount = nullptr;
+    m_vtable.inputBusCount                = 1;
+    m_vtable.outputBusCount               = 1;
+    m_vtable.flags                        = MA_NODE_FLAG_CONTINUOUS_PROCESSING | MA_NODE_FLAG_ALLOW_NULL_INPUT;
+
+    const auto     channelCount = ma_engine_get_channels(engine);
+    ma_node_config nodeConfig   = ma_node_config_init();
+    nodeConfig.vtable           = &m_vtable;
+    nodeConfig.pInputChannels   = &channelCount;
+    nodeConfig.pOutputChannels  = &channelCount;
+
+    if (const ma_result result = ma_node_init(ma_engine_get_node_graph(engine), &nodeConfig, nullptr, &m_node);
+        result != MA_SUCCESS)
+    {
+        err() << "Failed to initialize audio bus node: " << ma_result_description(result) << std::endl;
+        return;
+    }
+
+    m_node.impl    = this;
+    m_sampleRate   = ma_engine_get_sample_rate(engine);
+    m_channelCount = channelCount;
+
+    // Give every channel its own aligned slice of the block storage
+    m_storage.assign(m_channelCount * chunksPerChannel, {});
+    m_channels.resize(m_channelCount);
+    for (unsigned int channel = 0; channel < m_channelCount; ++channel)
+        m_channels[channel] = m_storage[channel * chunksPerChannel].samples.data();
+
+    {
+        // The format may have changed since the effects were last prepared
+        const std::lock_guard lock(m_effectMutex);
+        for (const auto& effect : m_effects)
+            effect->prepare(m_sampleRate, m_channelCount);
+    }
+
+    ma_node_set_output_bus_volume(&m_node, 0, m_volume);
+
+    m_initialized = true;
+    connect();
+
+    // Whatever feeds this bus and has already been initialized may be attached now
+    for (auto* input : m_inputs)
+    {
+        if (input->m_initialized)
+            input->connect();
+    }
+
+    for (auto* source : m_sources)
+    {
+        if (source->initialized)
+            source->connectEffect(bool{source->effectProcessor});
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void MixBus::deinitialize()
+{
+    if (!m_initialized)
+        return;
+
+    m_initialized = false;
+    ma_node_uninit(&m_node, nullptr);
+}
+
+
+////////////////////////////////////////////////////////////
+void MixBus::connect()
+{
+    auto* engine = AudioDevice::getEngine();
+
+    if (engine == nullptr)
+        return;
+
+    ma_node* output = (m_output && m_output->m_initialized) ? &m_output->m_node : ma_engine_get_endpoint(engine);
+
+    if (const ma_result result = ma_node_attach_output_bus(&m_node, 0, output, 0); result != MA_SUCCESS)
+        err() << "Failed to attach audio bus output: " << ma_result_description(result) << std::endl;
+}
+
+
+////////////////////////////////////////////////////////////
+void MixBus::process(const float** framesIn, std::uint32_t& frameCountIn, float** framesOut, std::uint32_t& frameCountOut)
+{
+    // Keep processing silence when nothing is attached so that effect tails ring out
+    const float* input      = framesIn ? framesIn[0] : nullptr;
+    float*       output     = framesOut[0];
+    const auto   frameCount = input ? std::min(frameCountIn, frameCountOut) : frameCountOut;
+
+    frameCountIn  = input ? frameCount : 0;
+    frameCountOut = frameCount;
+
+    // Never wait for the effect chain to be edited, let the audio through unprocessed instead
+    const std::unique_lock lock(m_effectMutex, std::try_to_lock);
+
+    if (!lock.owns_lock() || m_effects.empty())
+    {
+        if (input)
+            std::memcpy(output, input, frameCount * m_channelCount * sizeof(float));
+        else
+            std::memset(output, 0, frameCount * m_channelCount * sizeof(float));
+        return;
+    }
+
+    for (std::size_t offset = 0; offset < frameCount; offset += AudioBlock::MaxFrameCount)
+    {
+        const std::size_t blockFrameCount = std::min<std::size_t>(AudioBlock::MaxFrameCount, frameCount - offset);
+
+        // Deinterleave the input into the block
+        for (unsigned int channel = 0; channel < m_channelCount; ++channel)
+        {
+            float* samples = m_channels[channel];
+
+            if (input)
+            {
+                const float* frames = input + offset * m_channelCount + channel;
+                for (std::size_t i = 0; i < blockFrameCount; ++i)
+                    samples[i] = frames[i * m_channelCount];
+            }
+            else
+            {
+                std::fill_n(samples, blockFrameCount, 0.f);
+            }
+        }
+
+        AudioBlock block(m_channels.data(), m_channelCount, blockFrameCount);
+
+        for (const auto& effect : m_effects)
+            effect->process(block);
+
+        // Interleave the block into the output
+        for (unsigned int channel = 0; channel < m_channelCount; ++channel)
+        {
+            const float* samples = m_channels[channel];
+            float*       frames  = output + offset * m_channelCount + channel;
+            for (std::size_t i = 0; i < blockFrameCount; ++i)
+                frames[i * m_channelCount] = samples[i];
+        }
+    }
+}
+
+} // namespace sf::priv
@@ -0,0 +1,250 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/AudioBlock.hpp>
+#include <SFML/Audio/AudioDevice.hpp>
+
+#include <miniaudio.h>
+
+#include <array>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+class AudioBus;
+class AudioEffect;
+
+namespace priv
+{
+namespace MiniaudioUtils
+{
+struct SoundBase;
+}
+
+////////////////////////////////////////////////////////////
+/// \brief Engine node that mixes its inputs and runs them
+///        through a chain of effects
+///
+////////////////////////////////////////////////////////////
+class MixBus
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the bus
+    ///
+    /// \param owner The public bus this bus implements
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit MixBus(AudioBus& owner);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// Sources and buses feeding into this bus are routed
+    /// straight to the engine endpoint.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~MixBus();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    MixBus(const MixBus&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    MixBus& operator=(const MixBus&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Append an effect to the effect chain
+    ///
+    /// \param effect The effect to append
+    ///
+    ////////////////////////////////////////////////////////////
+    void addEffect(std::shared_ptr<AudioEffect> effect);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove an effect from the effect chain
+    ///
+    /// \param effect The effect to remove
+    ///
+    ////////////////////////////////////////////////////////////
+    void removeEffect(const AudioEffect& effect);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove all effects from the effect chain
+    ///
+    ////////////////////////////////////////////////////////////
+    void clearEffects();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of effects in the effect chain
+    ///
+    /// \return Number of effects
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getEffectCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Route the output of the bus into another bus
+    ///
+    /// \param output The bus to feed, `nullptr` for the engine endpoint
+    ///
+    ////////////////////////////////////////////////////////////
+    void setOutput(MixBus* output);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the bus the output of this bus is routed into
+    ///
+    /// \return The bus this bus feeds, `nullptr` for the engine endpoint
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] MixBus* getOutput() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the linear volume of the bus output
+    ///
+    /// \param volume Linear volume
+    ///
+    ////////////////////////////////////////////////////////////
+    void setVolume(float volume);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the linear volume of the bus output
+    ///
+    /// \return Linear volume
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] float getVolume() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Keep track of a sound routed into this bus
+    ///
+    /// \param source The sound
+    ///
+    ////////////////////////////////////////////////////////////
+    void attachSource(MiniaudioUtils::SoundBase& source);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Stop keeping track of a sound routed into this bus
+    ///
+    /// \param source The sound
+    ///
+    ////////////////////////////////////////////////////////////
+    void detachSource(MiniaudioUtils::SoundBase& source);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the engine node of the bus
+    ///
+    /// \return The node, `nullptr` if it is not initialized
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] ma_node* getNode();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the public bus this bus implements
+    ///
+    /// \return The public bus
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] AudioBus& getOwner() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the engine node and connect it
+    ///
+    ////////////////////////////////////////////////////////////
+    void initialize();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destroy the engine node
+    ///
+    ////////////////////////////////////////////////////////////
+    void deinitialize();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Attach the node output to the output bus or the engine endpoint
+    ///
+    ////////////////////////////////////////////////////////////
+    void connect();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Run the mixed input through the effect chain
+    ///
+    /// \param framesIn      Interleaved input frames, `nullptr` if nothing is attached
+    /// \param frameCountIn  Number of input frames, updated with the number of frames consumed
+    /// \param framesOut     Interleaved output frames
+    /// \param frameCountOut Capacity of the output, updated with the number of frames produced
+    ///
+    ////////////////////////////////////////////////////////////
+    void process(const float** framesIn, std::uint32_t& frameCountIn, float** framesOut, std::uint32_t& frameCountOut);
+
+    struct Node
+    {
+        ma_node_base base{};
+        MixBus*      impl{};
+    };
+
+    struct alignas(AudioBlock::Alignment) Chunk
+    {
+        std::array<float, AudioBlock::Alignment / sizeof(float)> samples{};
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    AudioBus&                                 m_owner;             //!< The public bus
+    ma_node_vtable                            m_vtable{};          //!< Vtable of the node
+    Node                                      m_node;              //!< The engine node
+    bool                                      m_initialized{};     //!< Whether the node is initialized
+    unsigned int                              m_sampleRate{};      //!< Sample rate of the engine
+    unsigned int                              m_channelCount{};    //!< Channel count of the engine
+    std::vector<Chunk>                        m_storage;           //!< Aligned storage of the block channels
+    std::vector<float*>                       m_channels;          //!< Pointers to each channel of the block
+    mutable std::mutex                        m_effectMutex;       //!< Guards the effect chain
+    std::vector<std::shared_ptr<AudioEffect>> m_effects;           //!< The effect chain
+    std::vector<MiniaudioUtils::SoundBase*>   m_sources;           //!< Sounds routed into this bus
+    std::vector<MixBus*>                      m_inputs;            //!< Buses routed into this bus
+    MixBus*                                   m_output{};          //!< Bus this bus is routed into
+    float                                     m_volume{1.f};       //!< Linear volume of the output
+    AudioDevice::ResourceEntryIter            m_resourceEntryIter; //!< Entry registered with the AudioDevice
+};
+
+} // namespace priv
+} // namespace sf
@@ -251,6 +251,22 @@ void Music::setLoopPoints(TimeSpan timePoints)
 }
 
 
+////////////////////////////////////////////////////////////
+void Music::setSeekIndex(const SeekIndex& seekIndex)
+{
+    m_impl->file.setSeekIndex(seekIndex);
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<SeekIndex> Music::getSeekIndex() const
+{
+    // The streaming thread may be reading the file
+    const std::lock_guard lock(m_impl->mutex);
+    return m_impl->file.getSeekIndex();
+}
+
+
 ////////////////////////////////////////////////////////////
 bool Music::onGetData(SoundStream::Chunk& data)
 {
@@ -67,6 +67,9 @@ bool OutputSoundFile::openFromFile(const std::filesystem::path&     filename,
         return false;
     }
 
+    if (m_quality)
+        m_writer->setQuality(*m_quality);
+
     // Pass the stream to the reader
     if (!m_writer->open(filename, sampleRate, channelCount, channelMap))
     {
@@ -89,6 +92,13 @@ void OutputSoundFile::write(const std::int16_t* samples, std::uint64_t count)
 }
 
 
+////////////////////////////////////////////////////////////
+void OutputSoundFile::setQuality(float quality)
+{
+    m_quality = quality;
+}
+
+
 ////////////////////////////////////////////////////////////
 void OutputSoundFile::close()
 {
@@ -26,9 +26,14 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/Audio/AudioDevice.hpp>
+#include <SFML/Audio/OutputSoundFile.hpp>
 #include <SFML/Audio/PlaybackDevice.hpp>
 
+#include <SFML/System/Err.hpp>
+
 #include <algorithm>
+#include <ostream>
+#include <vector>
 
 
 namespace sf::PlaybackDevice
@@ -88,6 +93,61 @@ bool setDeviceToNull()
 }
 
 
+////////////////////////////////////////////////////////////
+bool setDeviceToOffline(unsigned int channelCount, unsigned int sampleRate)
+{
+    return priv::AudioDevice::setDeviceToOffline(channelCount, sampleRate);
+}
+
+
+////////////////////////////////////////////////////////////
+bool isOffline()
+{
+    return priv::AudioDevice::isOffline();
+}
+
+
+////////////////////////////////////////////////////////////
+bool render(std::int16_t* samples, std::uint64_t frameCount)
+{
+    return priv::AudioDevice::render(samples, frameCount);
+}
+
+
+////////////////////////////////////////////////////////////
+bool render(OutputSoundFile& file, Time duration)
+{
+    if (!isOffline())
+    {
+        err() << "Failed to render audio: offline rendering is not enabled" << std::endl;
+        return false;
+    }
+
+    // The offline format is always known, even before the engine is created
+    const auto channelCount = *getDeviceChannelCount();
+    const auto sampleRate   = *getDeviceSampleRate();
+    const auto frameCount   = static_cast<std::uint64_t>(std::max(duration.asMicroseconds(), std::int64_t{0})) *
+                            sampleRate / 1'000'000;
+
+    // Render and write the mix one block at a time
+    constexpr std::uint64_t   blockSize = 4096;
+    std::vector<std::int16_t> samples(blockSize * channelCount);
+
+    for (std::uint64_t frameOffset = 0; frameOffset < frameCount;)
+    {
+        const auto frames = std::min(frameCount - frameOffset, blockSize);
+
+        if (!render(samples.data(), frames))
+            return false;
+
+        file.write(samples.data(), frames * channelCount);
+        frameOffset += frames;
+    }
+
+    return true;
+}
+
+
 ////////////////////////////////////////////////////////////
 std::optional<std::string> getDevice()
 {
@@ -102,6 +162,13 @@ std::optional<std::uint32_t> getDeviceSampleRate()
 }
 
 
+////////////////////////////////////////////////////////////
+std::optional<std::uint32_t> getDeviceChannelCount()
+{
+    return priv::AudioDevice::getDeviceChannelCount();
+}
+
+
 ////////////////////////////////////////////////////////////
 bool isDefaultDevice()
 {
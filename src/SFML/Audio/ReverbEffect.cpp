@@ -0,0 +1,169 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/AudioBlock.hpp>
+#include <SFML/Audio/ReverbEffect.hpp>
+
+#include <algorithm>
+
+
+namespace
+{
+// Freeverb tunings, in frames at 44100 Hz
+constexpr std::array<std::size_t, 8> combTunings{1116, 1188, 1277, 1356, 1422, 1491, 1557, 1617};
+constexpr std::array<std::size_t, 4> allPassTunings{556, 441, 341, 225};
+constexpr std::size_t                stereoSpread = 23;
+constexpr float                      inputGain    = 0.015f;
+constexpr float                      allPassGain  = 0.5f;
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+void ReverbEffect::setRoomSize(float roomSize)
+{
+    m_roomSize = std::clamp(roomSize, 0.f, 1.f);
+}
+
+
+////////////////////////////////////////////////////////////
+float ReverbEffect::getRoomSize() const
+{
+    return m_roomSize;
+}
+
+
+////////////////////////////////////////////////////////////
+void ReverbEffect::setDamping(float damping)
+{
+    m_damping = std::clamp(damping, 0.f, 1.f);
+}
+
+
+////////////////////////////////////////////////////////////
+float ReverbEffect::getDamping() const
+{
+    return m_damping;
+}
+
+
+////////////////////////////////////////////////////////////
+void ReverbEffect::setMix(float mix)
+{
+    m_mix = std::clamp(mix, 0.f, 1.f);
+}
+
+
+////////////////////////////////////////////////////////////
+float ReverbEffect::getMix() const
+{
+    return m_mix;
+}
+
+
+////////////////////////////////////////////////////////////
+void ReverbEffect::prepare(unsigned int sampleRate, unsigned int channelCount)
+{
+    const auto scale = [sampleRate](std::size_t tuning)
+    { return std::max<std::size_t>(tuning * sampleRate / 44100, 1); };
+
+    m_channels.resize(channelCount);
+
+    for (std::size_t channel = 0; channel < m_channels.size(); ++channel)
+    {
+        // Detune every other channel so that the channels decorrelate
+        const std::size_t spread = (channel % 2) * stereoSpread;
+
+        for (std::size_t i = 0; i < combTunings.size(); ++i)
+            m_channels[channel].combs[i] = {std::vector<float>(scale(combTunings[i] + spread)), 0, 0.f};
+
+        for (std::size_t i = 0; i < allPassTunings.size(); ++i)
+            m_channels[channel].allPasses[i] = {std::vector<float>(scale(allPassTunings[i] + spread)), 0};
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void ReverbEffect::process(AudioBlock& block)
+{
+    const float        feedback     = m_roomSize * 0.28f + 0.7f;
+    const float        damping      = m_damping * 0.4f;
+    const float        wet          = m_mix;
+    const float        dry          = 1.f - wet;
+    const unsigned int channelCount = std::min(block.getChannelCount(), static_cast<unsigned int>(m_channels.size()));
+
+    std::array<float, AudioBlock::MaxFrameCount> input{};
+    std::array<float, AudioBlock::MaxFrameCount> output{};
+
+    for (unsigned int channel = 0; channel < channelCount; ++channel)
+    {
+        float*            samples    = block.getChannel(channel);
+        auto&             filters    = m_channels[channel];
+        const std::size_t frameCount = block.getFrameCount();
+
+        for (std::size_t i = 0; i < frameCount; ++i)
+            input[i] = samples[i] * inputGain;
+
+        std::fill_n(output.begin(), frameCount, 0.f);
+
+        // Process filter by filter rather than frame by frame to keep each delay line hot in cache
+        for (auto& comb : filters.combs)
+        {
+            for (std::size_t i = 0; i < frameCount; ++i)
+            {
+                const float delayed        = comb.buffer[comb.position];
+                comb.filtered              = delayed * (1.f - damping) + comb.filtered * damping;
+                comb.buffer[comb.position] = input[i] + comb.filtered * feedback;
+
+                output[i] += delayed;
+
+                if (++comb.position == comb.buffer.size())
+                    comb.position = 0;
+            }
+        }
+
+        for (auto& allPass : filters.allPasses)
+        {
+            for (std::size_t i = 0; i < frameCount; ++i)
+            {
+                const float delayed              = allPass.buffer[allPass.position];
+                allPass.buffer[allPass.position] = output[i] + delayed * allPassGain;
+                output[i]                        = delayed - output[i];
+
+                if (++allPass.position == allPass.buffer.size())
+                    allPass.position = 0;
+            }
+        }
+
+        for (std::size_t i = 0; i < frameCount; ++i)
+            samples[i] = samples[i] * dry + output[i] * wet;
+    }
+}
+
+} // namespace sf
@@ -0,0 +1,188 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/SeekIndex.hpp>
+
+#include <SFML/System/Err.hpp>
+#include <SFML/System/Utils.hpp>
+
+#include <array>
+#include <fstream>
+#include <ostream>
+#include <utility>
+
+
+namespace
+{
+// File layout: magic, version, stream size, sample count, point count, then the points.
+// All integers are stored as 64-bit little endian values.
+constexpr std::array<char, 4> magic{'S', 'F', 'S', 'I'};
+constexpr std::uint64_t       version = 1;
+
+void writeInteger(std::ostream& stream, std::uint64_t value)
+{
+    std::array<char, 8> bytes{};
+    for (std::size_t i = 0; i < bytes.size(); ++i)
+        bytes[i] = static_cast<char>((value >> (i * 8)) & 0xFF);
+
+    stream.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+}
+
+bool readInteger(std::istream& stream, std::uint64_t& value)
+{
+    std::array<char, 8> bytes{};
+    if (!stream.read(bytes.data(), static_cast<std::streamsize>(bytes.size())))
+        return false;
+
+    value = 0;
+    for (std::size_t i = 0; i < bytes.size(); ++i)
+        value |= std::uint64_t{static_cast<unsigned char>(bytes[i])} << (i * 8);
+
+    return true;
+}
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+SeekIndex::SeekIndex(std::uint64_t streamSize, std::uint64_t sampleCount, std::vector<Point> points) :
+    m_streamSize(streamSize),
+    m_sampleCount(sampleCount),
+    m_points(std::move(points))
+{
+}
+
+
+////////////////////////////////////////////////////////////
+bool SeekIndex::loadFromFile(const std::filesystem::path& filename)
+{
+    std::ifstream file(filename, std::ios_base::binary);
+    if (!file)
+    {
+        err() << "Failed to open seek index file\n" << formatDebugPathInfo(filename) << std::endl;
+        return false;
+    }
+
+    // Check the header
+    std::array<char, 4> fileMagic{};
+    std::uint64_t       fileVersion{};
+    std::uint64_t       streamSize{};
+    std::uint64_t       sampleCount{};
+    std::uint64_t       pointCount{};
+    if (!file.read(fileMagic.data(), static_cast<std::streamsize>(fileMagic.size())) || fileMagic != magic ||
+        !readInteger(file, fileVersion) || fileVersion != version || !readInteger(file, streamSize) ||
+        !readInteger(file, sampleCount) || !readInteger(file, pointCount))
+    {
+        err() << "Failed to load seek index (invalid header)\n" << formatDebugPathInfo(filename) << std::endl;
+        return false;
+    }
+
+    // Make sure the point count matches the file size before allocating anything
+    const auto headerEnd = file.tellg();
+    file.seekg(0, std::ios_base::end);
+    const auto remaining = static_cast<std::uint64_t>(file.tellg() - headerEnd);
+    file.seekg(headerEnd);
+    if (remaining % 16 != 0 || remaining / 16 != pointCount)
+    {
+        err() << "Failed to load seek index (truncated file)\n" << formatDebugPathInfo(filename) << std::endl;
+        return false;
+    }
+
+    std::vector<Point> points(static_cast<std::size_t>(pointCount));
+    for (std::size_t i = 0; i < points.size(); ++i)
+    {
+        if (!readInteger(file, points[i].sampleOffset) || !readInteger(file, points[i].byteOffset) ||
+            points[i].sampleOffset > sampleCount || points[i].byteOffset >= streamSize ||
+            (i > 0 && points[i].sampleOffset <= points[i - 1].sampleOffset))
+        {
+            err() << "Failed to load seek index (invalid point)\n" << formatDebugPathInfo(filename) << std::endl;
+            return false;
+        }
+    }
+
+    m_streamSize  = streamSize;
+    m_sampleCount = sampleCount;
+    m_points      = std::move(points);
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool SeekIndex::saveToFile(const std::filesystem::path& filename) const
+{
+    std::ofstream file(filename, std::ios_base::binary | std::ios_base::trunc);
+    if (!file)
+    {
+        err() << "Failed to open seek index file for writing\n" << formatDebugPathInfo(filename) << std::endl;
+        return false;
+    }
+
+    file.write(magic.data(), static_cast<std::streamsize>(magic.size()));
+    writeInteger(file, version);
+    writeInteger(file, m_streamSize);
+    writeInteger(file, m_sampleCount);
+    writeInteger(file, m_points.size());
+    for (const Point& point : m_points)
+    {
+        writeInteger(file, point.sampleOffset);
+        writeInteger(file, point.byteOffset);
+    }
+
+    if (!file.flush())
+    {
+        err() << "Failed to write seek index\n" << formatDebugPathInfo(filename) << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t SeekIndex::getStreamSize() const
+{
+    return m_streamSize;
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t SeekIndex::getSampleCount() const
+{
+    return m_sampleCount;
+}
+
+
+////////////////////////////////////////////////////////////
+const std::vector<SeekIndex::Point>& SeekIndex::getPoints() const
+{
+    return m_points;
+}
+
+} // namespace sf
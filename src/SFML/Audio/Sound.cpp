@@ -220,7 +220,7 @@ void Sound::play()
     if (m_impl->status == Status::Playing)
         setPlayingOffset(Time::Zero);
 
-    if (const ma_result result = ma_sound_start(&m_impl->sound); result != MA_SUCCESS)
+    if (const ma_result result = m_impl->start(); result != MA_SUCCESS)
     {
         err() << "Failed to start playing sound: " << ma_result_description(result) << std::endl;
     }
@@ -234,6 +234,10 @@ void Sound::play()
 ////////////////////////////////////////////////////////////
 void Sound::pause()
 {
+    // Resolve the position a virtual voice has reached so it resumes from there
+    if (m_impl->isVirtual)
+        m_impl->leaveVirtual(false);
+
     if (const ma_result result = ma_sound_stop(&m_impl->sound); result != MA_SUCCESS)
     {
         err() << "Failed to stop playing sound: " << ma_result_description(result) << std::endl;
@@ -249,6 +253,8 @@ void Sound::pause()
 ////////////////////////////////////////////////////////////
 void Sound::stop()
 {
+    m_impl->isVirtual = false;
+
     if (const ma_result result = ma_sound_stop(&m_impl->sound); result != MA_SUCCESS)
     {
         err() << "Failed to stop playing sound: " << ma_result_description(result) << std::endl;
@@ -301,6 +307,10 @@ void Sound::setPlayingOffset(Time timeOffset)
 
     if (m_impl->buffer)
         m_impl->cursor = static_cast<std::size_t>(frameIndex * m_impl->buffer->getChannelCount());
+
+    // Virtual voices continue advancing from the new position
+    if (m_impl->isVirtual)
+        m_impl->enterVirtual();
 }
 
 
@@ -333,7 +343,7 @@ Time Sound::getPlayingOffset() const
     if (!m_impl->buffer || m_impl->buffer->getChannelCount() == 0 || m_impl->buffer->getSampleRate() == 0)
         return {};
 
-    return priv::MiniaudioUtils::getPlayingOffset(m_impl->sound);
+    return m_impl->getPlayingOffset();
 }
 
 
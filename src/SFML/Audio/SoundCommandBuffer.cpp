@@ -0,0 +1,140 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/AudioDevice.hpp>
+#include <SFML/Audio/SoundCommandBuffer.hpp>
+#include <SFML/Audio/SoundCommandQueue.hpp>
+#include <SFML/Audio/SoundSource.hpp>
+
+#include <vector>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct SoundCommandBuffer::Impl
+{
+    ////////////////////////////////////////////////////////////
+    void record(SoundSource& source, priv::SoundCommand::Property property, const Vector3f& value)
+    {
+        if (auto* sound = static_cast<ma_sound*>(source.getSound()))
+            commands.push_back({sound, property, {value.x, value.y, value.z}});
+    }
+
+    std::vector<priv::SoundCommand> commands; //!< Commands recorded since the last submission
+};
+
+
+////////////////////////////////////////////////////////////
+SoundCommandBuffer::SoundCommandBuffer() : m_impl(std::make_unique<Impl>())
+{
+}
+
+
+////////////////////////////////////////////////////////////
+SoundCommandBuffer::~SoundCommandBuffer() = default;
+
+
+////////////////////////////////////////////////////////////
+SoundCommandBuffer::SoundCommandBuffer(SoundCommandBuffer&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+SoundCommandBuffer& SoundCommandBuffer::operator=(SoundCommandBuffer&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+void SoundCommandBuffer::setPitch(SoundSource& source, float pitch)
+{
+    m_impl->record(source, priv::SoundCommand::Property::Pitch, {pitch, 0.f, 0.f});
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundCommandBuffer::setPan(SoundSource& source, float pan)
+{
+    m_impl->record(source, priv::SoundCommand::Property::Pan, {pan, 0.f, 0.f});
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundCommandBuffer::setVolume(SoundSource& source, float volume)
+{
+    m_impl->record(source, priv::SoundCommand::Property::Volume, {volume * 0.01f, 0.f, 0.f});
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundCommandBuffer::setPosition(SoundSource& source, const Vector3f& position)
+{
+    m_impl->record(source, priv::SoundCommand::Property::Position, position);
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundCommandBuffer::setDirection(SoundSource& source, const Vector3f& direction)
+{
+    m_impl->record(source, priv::SoundCommand::Property::Direction, direction);
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundCommandBuffer::setVelocity(SoundSource& source, const Vector3f& velocity)
+{
+    m_impl->record(source, priv::SoundCommand::Property::Velocity, velocity);
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundCommandBuffer::submit()
+{
+    if (m_impl->commands.empty())
+        return;
+
+    priv::SoundCommandQueue::submit(m_impl->commands);
+
+    // Without an engine there is no audio thread that would pick the batch up
+    if (!priv::AudioDevice::getEngine())
+        priv::AudioDevice::applySoundCommands();
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundCommandBuffer::clear()
+{
+    m_impl->commands.clear();
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t SoundCommandBuffer::getCommandCount() const
+{
+    return m_impl->commands.size();
+}
+
+} // namespace sf
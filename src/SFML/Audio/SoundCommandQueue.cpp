@@ -0,0 +1,138 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/SoundCommandQueue.hpp>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+void SoundCommandQueue::submit(std::vector<SoundCommand>& commands)
+{
+    auto&  state = getState();
+    Batch* batch = nullptr;
+
+    {
+        const std::lock_guard lock(state.mutex);
+
+        // Reclaim the batches the audio thread is done with
+        for (auto* recycled = state.recycled.exchange(nullptr, std::memory_order_acquire); recycled;)
+        {
+            auto* next = recycled->next;
+            state.freeBatches.push_back(recycled);
+            recycled = next;
+        }
+
+        if (state.freeBatches.empty())
+        {
+            batch = state.batches.emplace_back(std::make_unique<Batch>()).get();
+        }
+        else
+        {
+            batch = state.freeBatches.back();
+            state.freeBatches.pop_back();
+        }
+    }
+
+    // Swap rather than move so the caller inherits the capacity of the recycled batch
+    batch->commands.swap(commands);
+    commands.clear();
+
+    push(state.pending, *batch);
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundCommandQueue::apply()
+{
+    auto& state = getState();
+
+    // Take all pending batches at once and restore submission order
+    Batch* ordered = nullptr;
+    for (auto* batch = state.pending.exchange(nullptr, std::memory_order_acquire); batch;)
+    {
+        auto* next  = batch->next;
+        batch->next = ordered;
+        ordered     = batch;
+        batch       = next;
+    }
+
+    while (ordered)
+    {
+        for (const auto& command : ordered->commands)
+        {
+            const auto& [x, y, z] = command.value;
+
+            switch (command.property)
+            {
+                case SoundCommand::Property::Pitch:
+                    ma_sound_set_pitch(command.sound, x);
+                    break;
+                case SoundCommand::Property::Pan:
+                    ma_sound_set_pan(command.sound, x);
+                    break;
+                case SoundCommand::Property::Volume:
+                    ma_sound_set_volume(command.sound, x);
+                    break;
+                case SoundCommand::Property::Position:
+                    ma_sound_set_position(command.sound, x, y, z);
+                    break;
+                case SoundCommand::Property::Direction:
+                    ma_sound_set_direction(command.sound, x, y, z);
+                    break;
+                case SoundCommand::Property::Velocity:
+                    ma_sound_set_velocity(command.sound, x, y, z);
+                    break;
+            }
+        }
+
+        auto* next = ordered->next;
+        push(state.recycled, *ordered);
+        ordered = next;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundCommandQueue::push(std::atomic<Batch*>& stack, Batch& batch)
+{
+    batch.next = stack.load(std::memory_order_relaxed);
+    while (!stack.compare_exchange_weak(batch.next, &batch, std::memory_order_release, std::memory_order_relaxed))
+    {
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+SoundCommandQueue::State& SoundCommandQueue::getState()
+{
+    static State state;
+    return state;
+}
+
+} // namespace sf::priv
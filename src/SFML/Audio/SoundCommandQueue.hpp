@@ -0,0 +1,130 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <miniaudio.h>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief A single deferred change to a sound property
+///
+////////////////////////////////////////////////////////////
+struct SoundCommand
+{
+    enum class Property
+    {
+        Pitch,
+        Pan,
+        Volume,
+        Position,
+        Direction,
+        Velocity
+    };
+
+    ma_sound* sound{};    //!< The sound the command applies to
+    Property  property{}; //!< The property to change
+    ma_vec3f  value{};    //!< The new value, scalar properties use the x component
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Hands batches of sound commands over to the
+///        audio thread without blocking it
+///
+/// Submitted batches are pushed onto a lock-free stack that
+/// the audio thread drains at the start of each read cycle.
+/// Applied batches are handed back through a second lock-free
+/// stack so their storage can be reused by later submissions.
+///
+////////////////////////////////////////////////////////////
+class SoundCommandQueue
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Submit a batch of commands
+    ///
+    /// The commands are moved out of \a commands, which is left
+    /// empty but possibly with the capacity of a recycled batch.
+    ///
+    /// \param commands The commands to submit
+    ///
+    ////////////////////////////////////////////////////////////
+    static void submit(std::vector<SoundCommand>& commands);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Apply all pending batches in submission order
+    ///
+    /// This function never blocks. It must only be called while
+    /// the engine reading mutex is held so that commands are not
+    /// applied concurrently or to sounds that are being destroyed.
+    ///
+    ////////////////////////////////////////////////////////////
+    static void apply();
+
+private:
+    struct Batch
+    {
+        std::vector<SoundCommand> commands; //!< The commands of the batch
+        Batch*                    next{};   //!< Next batch in the stack the batch currently belongs to
+    };
+
+    struct State
+    {
+        std::atomic<Batch*>                 pending{};   //!< Batches waiting to be applied, most recent first
+        std::atomic<Batch*>                 recycled{};  //!< Batches that have been applied
+        std::mutex                          mutex;       //!< Mutex guarding the storage, never taken by the audio thread
+        std::vector<std::unique_ptr<Batch>> batches;     //!< Storage of all batches
+        std::vector<Batch*>                 freeBatches; //!< Batches ready to be reused
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Push a batch onto a lock-free stack
+    ///
+    /// \param stack The stack to push onto
+    /// \param batch The batch to push
+    ///
+    ////////////////////////////////////////////////////////////
+    static void push(std::atomic<Batch*>& stack, Batch& batch);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the state shared by all command buffers
+    ///
+    /// \return The shared state
+    ///
+    ////////////////////////////////////////////////////////////
+    static State& getState();
+};
+
+} // namespace sf::priv
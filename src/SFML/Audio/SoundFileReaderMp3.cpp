@@ -58,9 +58,12 @@
 #include <algorithm>
 #include <array>
 #include <ostream>
+#include <utility>
+#include <vector>
 
 #include <cassert>
 #include <cstdint>
+#include <cstdlib>
 #include <cstring>
 
 
@@ -128,8 +131,20 @@ std::optional<SoundFileReader::Info> SoundFileReaderMp3::open(InputStream& strea
     m_io.read_data = &stream;
     m_io.seek_data = &stream;
 
-    // Init mp3 decoder
-    mp3dec_ex_open_cb(&m_decoder, &m_io, MP3D_SEEK_TO_SAMPLE);
+    m_streamSize = stream.getSize().value_or(0);
+
+    // Init mp3 decoder, skipping the scan of the whole stream if we were given an index matching it
+    const bool useSeekIndex = m_seekIndex && !m_seekIndex->getPoints().empty() &&
+                              m_seekIndex->getStreamSize() == m_streamSize;
+    mp3dec_ex_open_cb(&m_decoder, &m_io, useSeekIndex ? MP3D_SEEK_TO_SAMPLE | MP3D_DO_NOT_SCAN : MP3D_SEEK_TO_SAMPLE);
+    if (useSeekIndex && !loadSeekIndex())
+    {
+        // The index doesn't fit this stream, fall back to a regular open
+        mp3dec_ex_close(&m_decoder);
+        mp3dec_ex_open_cb(&m_decoder, &m_io, MP3D_SEEK_TO_SAMPLE);
+    }
+    m_seekIndex.reset();
+
     if (!m_decoder.samples)
         return std::nullopt;
 
@@ -179,4 +194,65 @@ std::uint64_t SoundFileReaderMp3::read(std::int16_t* samples, std::uint64_t maxC
     return toRead;
 }
 
+
+////////////////////////////////////////////////////////////
+void SoundFileReaderMp3::setSeekIndex(const SeekIndex& seekIndex)
+{
+    m_seekIndex = seekIndex;
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<SeekIndex> SoundFileReaderMp3::getSeekIndex()
+{
+    // Files with a VBR header are indexed on their first seek, so trigger
+    // one with a non-zero target (seeking to 0 doesn't need the index)
+    if (!m_decoder.indexes_built && m_numSamples > 0)
+    {
+        mp3dec_ex_seek(&m_decoder, m_numSamples);
+        mp3dec_ex_seek(&m_decoder, m_position);
+    }
+
+    if (!m_decoder.indexes_built || !m_decoder.index.frames)
+        return std::nullopt;
+
+    std::vector<SeekIndex::Point> points(m_decoder.index.num_frames);
+    for (std::size_t i = 0; i < points.size(); ++i)
+        points[i] = {m_decoder.index.frames[i].sample, m_decoder.index.frames[i].offset};
+
+    return SeekIndex(m_streamSize, m_decoder.samples, std::move(points));
+}
+
+
+////////////////////////////////////////////////////////////
+bool SoundFileReaderMp3::loadSeekIndex()
+{
+    assert(m_seekIndex && "No seek index to load. Call SoundFileReaderMp3::setSeekIndex() first.");
+
+    // The VBR header gives the exact sample count, use it to validate the index
+    if (m_decoder.vbr_tag_found && m_decoder.samples != m_seekIndex->getSampleCount())
+        return false;
+
+    const std::vector<SeekIndex::Point>& points = m_seekIndex->getPoints();
+    if (points.front().byteOffset < m_decoder.start_offset)
+        return false;
+
+    // minimp3 releases the index with free(), so allocate it with malloc()
+    auto* frames = static_cast<mp3dec_frame_t*>(std::malloc(points.size() * sizeof(mp3dec_frame_t)));
+    if (!frames)
+        return false;
+
+    for (std::size_t i = 0; i < points.size(); ++i)
+        frames[i] = {points[i].sampleOffset, points[i].byteOffset};
+
+    std::free(m_decoder.index.frames);
+    m_decoder.index.frames     = frames;
+    m_decoder.index.num_frames = points.size();
+    m_decoder.index.capacity   = points.size();
+    m_decoder.indexes_built    = 1;
+    m_decoder.samples          = m_seekIndex->getSampleCount();
+
+    return true;
+}
+
 } // namespace sf::priv
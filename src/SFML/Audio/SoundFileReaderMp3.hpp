@@ -120,14 +120,46 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] std::uint64_t read(std::int16_t* samples, std::uint64_t maxCount) override;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Provide a seek index built during a previous session
+    ///
+    /// If the index matches the stream given to `open`, the frame
+    /// scan normally performed when opening the file is skipped.
+    ///
+    /// \param seekIndex Seek index to use
+    ///
+    ////////////////////////////////////////////////////////////
+    void setSeekIndex(const SeekIndex& seekIndex) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the seek index built by the reader
+    ///
+    /// Files with a VBR header are only scanned on their first
+    /// seek, in which case calling this function scans them.
+    ///
+    /// \return Index of every frame of the open file
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<SeekIndex> getSeekIndex() override;
+
 private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Replace the frame index of the decoder with the provided seek index
+    ///
+    /// \return `true` if the index was loaded
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool loadSeekIndex();
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    mp3dec_io_t   m_io{};
-    mp3dec_ex_t   m_decoder{};
-    std::uint64_t m_numSamples{}; // Decompressed audio storage size
-    std::uint64_t m_position{};   // Position in decompressed audio buffer
+    mp3dec_io_t              m_io{};
+    mp3dec_ex_t              m_decoder{};
+    std::uint64_t            m_numSamples{}; // Decompressed audio storage size
+    std::uint64_t            m_position{};   // Position in decompressed audio buffer
+    std::uint64_t            m_streamSize{}; // Size of the encoded stream
+    std::optional<SeekIndex> m_seekIndex;    // Index provided before opening the stream
 };
 
 } // namespace sf::priv
@@ -30,6 +30,8 @@
 #include <SFML/System/Err.hpp>
 #include <SFML/System/InputStream.hpp>
 
+#include <algorithm>
+#include <array>
 #include <ostream>
 
 #include <cassert>
@@ -188,6 +190,14 @@ std::optional<SoundFileReader::Info> SoundFileReaderOgg::open(InputStream& strea
 
     // We must keep the channel count for the seek function
     m_channelCount = info.channelCount;
+    m_sampleRate   = info.sampleRate;
+    m_sampleCount  = info.sampleCount;
+    m_streamSize   = stream.getSize().value_or(0);
+
+    // Reuse the seek points of a previous session if they were recorded from this stream
+    if (m_seekIndex && m_seekIndex->getStreamSize() == m_streamSize && m_seekIndex->getSampleCount() == m_sampleCount)
+        m_seekPoints = m_seekIndex->getPoints();
+    m_seekIndex.reset();
 
     return info;
 }
@@ -198,7 +208,10 @@ void SoundFileReaderOgg::seek(std::uint64_t sampleOffset)
 {
     assert(m_vorbis.datasource && "Vorbis datasource is missing. Call SoundFileReaderOgg::open() to initialize it.");
 
-    ov_pcm_seek(&m_vorbis, static_cast<ogg_int64_t>(sampleOffset / m_channelCount));
+    // Jump directly to a nearby page if the index covers the target, bisect the stream otherwise
+    const auto frameOffset = static_cast<ogg_int64_t>(sampleOffset / m_channelCount);
+    if (!seekWithIndex(frameOffset))
+        ov_pcm_seek(&m_vorbis, frameOffset);
 }
 
 
@@ -211,6 +224,8 @@ std::uint64_t SoundFileReaderOgg::read(std::int16_t* samples, std::uint64_t maxC
     std::uint64_t count = 0;
     while (count < maxCount)
     {
+        recordSeekPoint();
+
         const int bytesToRead = static_cast<int>(maxCount - count) * static_cast<int>(sizeof(std::int16_t));
         const long bytesRead = ov_read(&m_vorbis, reinterpret_cast<char*>(samples), bytesToRead, SFML_IS_BIG_ENDIAN, 2, 1, nullptr);
         if (bytesRead > 0)
@@ -230,6 +245,98 @@ std::uint64_t SoundFileReaderOgg::read(std::int16_t* samples, std::uint64_t maxC
 }
 
 
+////////////////////////////////////////////////////////////
+void SoundFileReaderOgg::setSeekIndex(const SeekIndex& seekIndex)
+{
+    m_seekIndex = seekIndex;
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<SeekIndex> SoundFileReaderOgg::getSeekIndex()
+{
+    if (m_seekPoints.empty())
+        return std::nullopt;
+
+    return SeekIndex(m_streamSize, m_sampleCount, m_seekPoints);
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundFileReaderOgg::recordSeekPoint()
+{
+    // Only extend the index from its last point, so that two
+    // consecutive points are never more than 2 seconds apart
+    const ogg_int64_t frame     = ov_pcm_tell(&m_vorbis);
+    const ogg_int64_t lastFrame = m_seekPoints.empty()
+                                      ? 0
+                                      : static_cast<ogg_int64_t>(m_seekPoints.back().sampleOffset / m_channelCount);
+    if (frame < lastFrame + m_sampleRate || frame >= lastFrame + 2 * ogg_int64_t{m_sampleRate})
+        return;
+
+    const ogg_int64_t byteOffset = ov_raw_tell(&m_vorbis);
+    if (byteOffset < 0)
+        return;
+
+    m_seekPoints.push_back(
+        {static_cast<std::uint64_t>(frame) * m_channelCount, static_cast<std::uint64_t>(byteOffset)});
+}
+
+
+////////////////////////////////////////////////////////////
+bool SoundFileReaderOgg::seekWithIndex(ogg_int64_t frameOffset)
+{
+    if (m_seekPoints.empty())
+        return false;
+
+    // Past the last point, the index is only useful if the target is close enough
+    const auto sampleOffset = static_cast<std::uint64_t>(frameOffset) * m_channelCount;
+    if (sampleOffset >= m_seekPoints.back().sampleOffset + 2 * std::uint64_t{m_sampleRate} * m_channelCount)
+        return false;
+
+    // The page found from the byte offset of a point may start after the point itself,
+    // in which case the previous point gives a page that starts before the target
+    auto it = std::upper_bound(m_seekPoints.begin(),
+                               m_seekPoints.end(),
+                               sampleOffset,
+                               [](std::uint64_t offset, const SeekIndex::Point& point)
+                               { return offset < point.sampleOffset; });
+    for (int attempt = 0; (attempt < 2) && (it != m_seekPoints.begin()); ++attempt)
+    {
+        --it;
+        if (ov_raw_seek(&m_vorbis, static_cast<ogg_int64_t>(it->byteOffset)) != 0)
+            return false;
+
+        const ogg_int64_t position = ov_pcm_tell(&m_vorbis);
+        if (position < 0 || position > frameOffset)
+            continue;
+
+        // Decode and discard the samples between the start of the page and the target
+        const auto             frameSize = static_cast<long>(m_channelCount * sizeof(std::int16_t));
+        long                   remaining = static_cast<long>(frameOffset - position) * frameSize;
+        std::array<char, 8192> buffer{};
+        while (remaining > 0)
+        {
+            const long bytesRead = ov_read(&m_vorbis,
+                                           buffer.data(),
+                                           static_cast<int>(std::min(remaining, static_cast<long>(buffer.size()))),
+                                           SFML_IS_BIG_ENDIAN,
+                                           2,
+                                           1,
+                                           nullptr);
+            if (bytesRead <= 0)
+                return false;
+
+            remaining -= bytesRead;
+        }
+
+        return true;
+    }
+
+    return false;
+}
+
+
 ////////////////////////////////////////////////////////////
 void SoundFileReaderOgg::close()
 {
@@ -238,6 +345,7 @@ void SoundFileReaderOgg::close()
         ov_clear(&m_vorbis);
         m_vorbis.datasource = nullptr;
         m_channelCount      = 0;
+        m_seekPoints.clear();
     }
 }
 
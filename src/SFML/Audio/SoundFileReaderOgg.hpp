@@ -32,6 +32,7 @@
 #include <vorbis/vorbisfile.h>
 
 #include <optional>
+#include <vector>
 
 #include <cstdint>
 
@@ -102,7 +103,47 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] std::uint64_t read(std::int16_t* samples, std::uint64_t maxCount) override;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Provide a seek index built during a previous session
+    ///
+    /// If the index matches the stream given to `open`, seeking
+    /// within the range it covers jumps directly to a nearby page
+    /// instead of bisecting the stream.
+    ///
+    /// \param seekIndex Seek index to use
+    ///
+    ////////////////////////////////////////////////////////////
+    void setSeekIndex(const SeekIndex& seekIndex) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the seek index built by the reader
+    ///
+    /// Points are recorded about every second while the file is
+    /// read, so the index covers the file entirely once it has
+    /// been read through from the beginning.
+    ///
+    /// \return Index of the part of the file read so far, `std::nullopt` if it is empty
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<SeekIndex> getSeekIndex() override;
+
 private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Add a seek point at the current position if it extends the index
+    ///
+    ////////////////////////////////////////////////////////////
+    void recordSeekPoint();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Seek to the given frame using the seek points
+    ///
+    /// \param frameOffset Index of the frame to jump to
+    ///
+    /// \return `true` on success, `false` if the index doesn't cover the frame
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool seekWithIndex(ogg_int64_t frameOffset);
+
     ////////////////////////////////////////////////////////////
     /// \brief Close the open Vorbis file
     ///
@@ -112,8 +153,13 @@ private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    OggVorbis_File m_vorbis{};       // ogg/vorbis file handle
-    unsigned int   m_channelCount{}; // number of channels of the open sound file
+    OggVorbis_File                m_vorbis{};       // ogg/vorbis file handle
+    unsigned int                  m_channelCount{}; // number of channels of the open sound file
+    unsigned int                  m_sampleRate{};   // sample rate of the open sound file
+    std::uint64_t                 m_sampleCount{};  // total number of samples of the open sound file
+    std::uint64_t                 m_streamSize{};   // size of the encoded stream
+    std::vector<SeekIndex::Point> m_seekPoints;     // seek points recorded so far, contiguous from the start
+    std::optional<SeekIndex>      m_seekIndex;      // index provided before opening the stream
 };
 
 } // namespace sf::priv
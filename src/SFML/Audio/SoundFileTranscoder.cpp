@@ -0,0 +1,396 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/InputSoundFile.hpp>
+#include <SFML/Audio/OutputSoundFile.hpp>
+#include <SFML/Audio/SeekIndex.hpp>
+#include <SFML/Audio/SoundFileTranscoder.hpp>
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <utility>
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+// Part of a large input file, decoded by any thread of the batch
+////////////////////////////////////////////////////////////
+struct Chunk
+{
+    std::vector<std::int16_t> samples;  // Decoded samples
+    bool                      done{};   // Whether decoding finished
+    bool                      failed{}; // Whether decoding failed
+};
+
+
+////////////////////////////////////////////////////////////
+// State shared by the threads converting a batch of jobs
+////////////////////////////////////////////////////////////
+class Batch
+{
+public:
+    using Job              = sf::SoundFileTranscoder::Job;
+    using Progress         = sf::SoundFileTranscoder::Progress;
+    using ProgressCallback = sf::SoundFileTranscoder::ProgressCallback;
+    using Status           = sf::SoundFileTranscoder::Status;
+
+    Batch(const std::vector<Job>& jobs,
+          unsigned int            threadCount,
+          std::optional<float>    quality,
+          sf::Time                chunkDuration,
+          const ProgressCallback& progressCallback) :
+        m_jobs(jobs),
+        m_threadCount(threadCount),
+        m_quality(quality),
+        m_chunkDuration(chunkDuration),
+        m_progressCallback(progressCallback)
+    {
+    }
+
+    bool run()
+    {
+        std::vector<std::thread> threads;
+        threads.reserve(m_threadCount - 1);
+        for (auto i = 1u; i < m_threadCount; ++i)
+            threads.emplace_back(&Batch::work, this);
+
+        work();
+
+        for (auto& thread : threads)
+            thread.join();
+
+        return !m_failed;
+    }
+
+private:
+    void work()
+    {
+        std::unique_lock lock(m_mutex);
+        while (true)
+        {
+            if (!m_tasks.empty())
+            {
+                // Help decoding the chunks of large files first, their jobs wait for them
+                auto task = std::move(m_tasks.front());
+                m_tasks.pop_front();
+                lock.unlock();
+                task();
+                lock.lock();
+            }
+            else if (m_nextJob < m_jobs.size())
+            {
+                const std::size_t index = m_nextJob++;
+                ++m_activeJobs;
+                lock.unlock();
+                const bool succeeded = transcode(index);
+                lock.lock();
+                --m_activeJobs;
+                m_failed = m_failed || !succeeded;
+                m_condition.notify_all();
+            }
+            else if (m_activeJobs > 0)
+            {
+                // Running jobs may still queue chunks
+                m_condition.wait(lock);
+            }
+            else
+            {
+                break;
+            }
+        }
+    }
+
+    void queue(std::function<void()> task)
+    {
+        {
+            const std::lock_guard lock(m_mutex);
+            m_tasks.push_back(std::move(task));
+        }
+        m_condition.notify_all();
+    }
+
+    void waitFor(const Chunk& chunk)
+    {
+        // Run queued tasks while waiting, so that a thread never
+        // sits idle on a chunk that nobody else would decode
+        std::unique_lock lock(m_mutex);
+        while (!chunk.done)
+        {
+            if (!m_tasks.empty())
+            {
+                auto task = std::move(m_tasks.front());
+                m_tasks.pop_front();
+                lock.unlock();
+                task();
+                lock.lock();
+            }
+            else
+            {
+                m_condition.wait(lock);
+            }
+        }
+    }
+
+    void report(const Progress& progress)
+    {
+        if (!m_progressCallback)
+            return;
+
+        const std::lock_guard lock(m_callbackMutex);
+        m_progressCallback(progress);
+    }
+
+    bool transcode(std::size_t index)
+    {
+        const Job& job = m_jobs[index];
+        Progress   progress{index, 0, 0, Status::Running};
+
+        sf::InputSoundFile input;
+        if (!input.openFromFile(job.input))
+        {
+            progress.status = Status::Failed;
+            report(progress);
+            return false;
+        }
+
+        progress.sampleCount = input.getSampleCount();
+        report(progress);
+
+        sf::OutputSoundFile output;
+        if (m_quality)
+            output.setQuality(*m_quality);
+
+        if (!output.openFromFile(job.output, input.getSampleRate(), input.getChannelCount(), input.getChannelMap()))
+        {
+            progress.status = Status::Failed;
+            report(progress);
+            return false;
+        }
+
+        const std::uint64_t channelCount = input.getChannelCount();
+        const std::uint64_t chunkSize    = static_cast<std::uint64_t>(m_chunkDuration.asMicroseconds()) *
+                                        input.getSampleRate() / 1'000'000 * channelCount;
+        const bool split = (m_threadCount > 1) && (chunkSize > 0) && (input.getSampleCount() > 2 * chunkSize);
+
+        const bool succeeded = split ? transcodeChunks(job, input, output, chunkSize, progress)
+                                     : transcodeBlocks(input, output, progress);
+        output.close();
+
+        // Don't leave truncated files behind
+        if (!succeeded)
+        {
+            std::error_code error;
+            std::filesystem::remove(job.output, error);
+        }
+
+        progress.status = succeeded ? Status::Succeeded : Status::Failed;
+        report(progress);
+        return succeeded;
+    }
+
+    bool transcodeBlocks(sf::InputSoundFile& input, sf::OutputSoundFile& output, Progress& progress)
+    {
+        // Convert by blocks of 1 second
+        std::vector<std::int16_t> samples(std::max(input.getSampleRate() * input.getChannelCount(), 1u));
+        std::uint64_t             written = 0;
+        while (const std::uint64_t count = input.read(samples.data(), samples.size()))
+        {
+            output.write(samples.data(), count);
+            written += count;
+            progress.processedSamples += count;
+            report(progress);
+        }
+
+        // An input which ends before all its samples were read is truncated or corrupt, like a short chunk
+        return written == input.getSampleCount();
+    }
+
+    bool transcodeChunks(const Job&           job,
+                         sf::InputSoundFile&  input,
+                         sf::OutputSoundFile& output,
+                         std::uint64_t        chunkSize,
+                         Progress&            progress)
+    {
+        // Reuse the seek index of the input so that each chunk doesn't scan the file again
+        const std::optional<sf::SeekIndex> seekIndex   = input.getSeekIndex();
+        const std::uint64_t                sampleCount = input.getSampleCount();
+        std::vector<Chunk>                 chunks(static_cast<std::size_t>((sampleCount + chunkSize - 1) / chunkSize));
+
+        const auto queueChunk = [&](std::size_t index)
+        {
+            const std::uint64_t offset = index * chunkSize;
+            const std::uint64_t count  = std::min(chunkSize, sampleCount - offset);
+            queue([this, &job, &seekIndex, &chunk = chunks[index], offset, count]
+                  { decode(job.input, seekIndex, offset, count, chunk); });
+        };
+
+        // Chunks are written in order, keep a bounded number of them in flight to bound memory usage
+        const std::size_t maxQueued = 2 * std::size_t{m_threadCount};
+        std::size_t       queued    = 0;
+        bool              succeeded = true;
+        for (std::size_t i = 0; i < chunks.size(); ++i)
+        {
+            while (succeeded && (queued < chunks.size()) && (queued < i + maxQueued))
+                queueChunk(queued++);
+
+            // After a failure, only the chunks already queued must be waited for
+            if (i >= queued)
+                break;
+
+            waitFor(chunks[i]);
+            if (succeeded && !chunks[i].failed)
+            {
+                output.write(chunks[i].samples.data(), chunks[i].samples.size());
+                progress.processedSamples += chunks[i].samples.size();
+                report(progress);
+            }
+            else
+            {
+                succeeded = false;
+            }
+
+            chunks[i].samples = {};
+        }
+
+        return succeeded;
+    }
+
+    void decode(const std::filesystem::path&        path,
+                const std::optional<sf::SeekIndex>& seekIndex,
+                std::uint64_t                       offset,
+                std::uint64_t                       count,
+                Chunk&                              chunk)
+    {
+        std::vector<std::int16_t> samples(static_cast<std::size_t>(count));
+
+        sf::InputSoundFile file;
+        if (seekIndex)
+            file.setSeekIndex(*seekIndex);
+
+        // A chunk which can't be read entirely fails, rather than leaving a gap in the output
+        bool failed = !file.openFromFile(path);
+        if (!failed)
+        {
+            file.seek(offset);
+            const std::uint64_t read = file.read(samples.data(), count);
+            samples.resize(static_cast<std::size_t>(read));
+            failed = (read < count);
+        }
+
+        {
+            const std::lock_guard lock(m_mutex);
+            chunk.samples = std::move(samples);
+            chunk.failed  = failed;
+            chunk.done    = true;
+        }
+        m_condition.notify_all();
+    }
+
+    const std::vector<Job>&           m_jobs;
+    const unsigned int                m_threadCount;
+    const std::optional<float>        m_quality;
+    const sf::Time                    m_chunkDuration;
+    const ProgressCallback&           m_progressCallback;
+    std::mutex                        m_mutex;
+    std::condition_variable           m_condition;
+    std::deque<std::function<void()>> m_tasks;
+    std::size_t                       m_nextJob{};
+    std::size_t                       m_activeJobs{};
+    bool                              m_failed{};
+    std::mutex                        m_callbackMutex;
+};
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+void SoundFileTranscoder::setThreadCount(unsigned int threadCount)
+{
+    m_threadCount = threadCount;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int SoundFileTranscoder::getThreadCount() const
+{
+    return m_threadCount;
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundFileTranscoder::setQuality(float quality)
+{
+    m_quality = std::clamp(quality, 0.f, 1.f);
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<float> SoundFileTranscoder::getQuality() const
+{
+    return m_quality;
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundFileTranscoder::setChunkDuration(Time duration)
+{
+    m_chunkDuration = std::max(duration, Time::Zero);
+}
+
+
+////////////////////////////////////////////////////////////
+Time SoundFileTranscoder::getChunkDuration() const
+{
+    return m_chunkDuration;
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundFileTranscoder::setProgressCallback(ProgressCallback callback)
+{
+    m_progressCallback = std::move(callback);
+}
+
+
+////////////////////////////////////////////////////////////
+bool SoundFileTranscoder::run(const std::vector<Job>& jobs) const
+{
+    const unsigned int threadCount = m_threadCount > 0 ? m_threadCount
+                                                       : std::max(std::thread::hardware_concurrency(), 1u);
+
+    Batch batch(jobs, threadCount, m_quality, m_chunkDuration, m_progressCallback);
+    return batch.run();
+}
+
+} // namespace sf
@@ -33,6 +33,8 @@
 #include <algorithm>
 #include <ostream>
 
+#include <cmath>
+
 
 namespace sf::priv
 {
@@ -144,6 +146,7 @@ bool SoundFileWriterFlac::open(const std::filesystem::path&     filename,
     FLAC__stream_encoder_set_channels(m_encoder.get(), channelCount);
     FLAC__stream_encoder_set_bits_per_sample(m_encoder.get(), 16);
     FLAC__stream_encoder_set_sample_rate(m_encoder.get(), sampleRate);
+    FLAC__stream_encoder_set_compression_level(m_encoder.get(), m_compressionLevel);
 
     // Initialize the output stream
     if (FLAC__stream_encoder_init_FILE(m_encoder.get(), m_file, nullptr, nullptr) != FLAC__STREAM_ENCODER_INIT_STATUS_OK)
@@ -187,4 +190,11 @@ void SoundFileWriterFlac::write(const std::int16_t* samples, std::uint64_t count
     }
 }
 
+
+////////////////////////////////////////////////////////////
+void SoundFileWriterFlac::setQuality(float quality)
+{
+    m_compressionLevel = static_cast<unsigned int>(std::lround(std::clamp(quality, 0.f, 1.f) * 8.f));
+}
+
 } // namespace sf::priv
@@ -83,6 +83,14 @@ public:
     ////////////////////////////////////////////////////////////
     void write(const std::int16_t* samples, std::uint64_t count) override;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the quality of the encoder
+    ///
+    /// \param quality Compression effort, in range [0, 1], mapped to FLAC compression levels 0 to 8
+    ///
+    ////////////////////////////////////////////////////////////
+    void setQuality(float quality) override;
+
 private:
     ////////////////////////////////////////////////////////////
     // Member data
@@ -94,6 +102,7 @@ private:
     std::FILE*                                                     m_file{};
     std::unique_ptr<FLAC__StreamEncoder, FlacStreamEncoderDeleter> m_encoder;        //!< FLAC stream encoder
     unsigned int                                                   m_channelCount{}; //!< Number of channels
+    unsigned int m_compressionLevel{5}; //!< Compression level, 5 is the default of the reference encoder
     std::array<std::size_t, 8> m_remapTable{}; //!< Table we use to remap source to target channel order
     std::vector<std::int32_t>  m_samples32;    //!< Conversion buffer
 };
@@ -139,8 +139,10 @@ bool SoundFileWriterOgg::open(const std::filesystem::path&     filename,
     vorbis_info_init(&m_vorbis);
 
     // Setup the encoder: VBR, automatic bitrate management
-    // Quality is in range [-1 .. 1], 0.4 gives ~128 kbps for a 44 KHz stereo sound
-    int status = vorbis_encode_init_vbr(&m_vorbis, static_cast<long>(channelCount), static_cast<long>(sampleRate), 0.4f);
+    int status = vorbis_encode_init_vbr(&m_vorbis,
+                                        static_cast<long>(channelCount),
+                                        static_cast<long>(sampleRate),
+                                        m_quality);
     if (status < 0)
     {
         err() << "Failed to write ogg/vorbis file (unsupported bitrate)\n"
@@ -229,6 +231,13 @@ void SoundFileWriterOgg::write(const std::int16_t* samples, std::uint64_t count)
 }
 
 
+////////////////////////////////////////////////////////////
+void SoundFileWriterOgg::setQuality(float quality)
+{
+    m_quality = std::clamp(quality, 0.f, 1.f);
+}
+
+
 ////////////////////////////////////////////////////////////
 void SoundFileWriterOgg::flushBlocks()
 {
@@ -88,6 +88,14 @@ public:
     ////////////////////////////////////////////////////////////
     void write(const std::int16_t* samples, std::uint64_t count) override;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the quality of the encoder
+    ///
+    /// \param quality Vorbis VBR quality, in range [0, 1]
+    ///
+    ////////////////////////////////////////////////////////////
+    void setQuality(float quality) override;
+
 private:
     ////////////////////////////////////////////////////////////
     /// \brief Flush blocks produced by the ogg stream, if any
@@ -105,6 +113,7 @@ private:
     // Member data
     ////////////////////////////////////////////////////////////
     unsigned int               m_channelCount{}; //!< Channel count of the sound being written
+    float                      m_quality{0.4f};  //!< VBR quality, 0.4 gives ~128 kbps for a 44 KHz stereo sound
     std::array<std::size_t, 8> m_remapTable{};   //!< Table we use to remap source to target channel order
     std::ofstream              m_file;           //!< Output file
     ogg_stream_state           m_ogg{};          //!< OGG stream
@@ -34,8 +34,12 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
 #include <optional>
 #include <ostream>
+#include <thread>
 
 #include <cassert>
 #include <cstring>
@@ -84,19 +88,34 @@ struct SoundRecorder::Impl
         {
             auto& impl = *static_cast<Impl*>(device->pUserData);
 
-            // Copy the new samples into our temporary buffer
-            impl.samples.resize(frameCount * impl.channelCount);
-            std::memcpy(impl.samples.data(), input, frameCount * impl.channelCount * sizeof(std::int16_t));
+            if (!impl.ringBuffer)
+                return;
 
-            // Notify the derived class of the availability of new samples
-            if (!impl.owner->onProcessSamples(impl.samples.data(), impl.samples.size()))
+            // Copy the new samples into the ring buffer; this runs on the audio thread,
+            // so it must neither allocate, lock nor call into user code
+            const auto  channels = ma_pcm_rb_get_channels(&*impl.ringBuffer);
+            const auto* source   = static_cast<const std::int16_t*>(input);
+
+            while (frameCount > 0)
             {
-                // If the derived class wants to stop, stop the capture
-                if (const auto result = ma_device_stop(device); result != MA_SUCCESS)
-                {
-                    err() << "Failed to stop audio capture device: " << ma_result_description(result) << std::endl;
-                    return;
-                }
+                auto  frames = frameCount;
+                void* buffer = nullptr;
+
+                if (ma_pcm_rb_acquire_write(&*impl.ringBuffer, &frames, &buffer) != MA_SUCCESS || frames == 0)
+                    break;
+
+                std::memcpy(buffer, source, frames * channels * sizeof(std::int16_t));
+                ma_pcm_rb_commit_write(&*impl.ringBuffer, frames);
+
+                source += frames * channels;
+                frameCount -= frames;
+            }
+
+            // The processing thread didn't keep up, the remaining samples are lost
+            if (frameCount > 0)
+            {
+                impl.overrunCount.fetch_add(1, std::memory_order_relaxed);
+                impl.droppedSampleCount.fetch_add(std::uint64_t{frameCount} * channels, std::memory_order_relaxed);
             }
         };
 
@@ -110,6 +129,109 @@ struct SoundRecorder::Impl
         return true;
     }
 
+    bool startProcessing()
+    {
+        // Leave room for several processing intervals, so that a late processing thread doesn't lose samples
+        const auto intervalFrames = static_cast<std::uint32_t>(
+            std::max(processingInterval.asMicroseconds(), std::int64_t{0}) * sampleRate / 1'000'000);
+        const auto capacity = std::max(sampleRate, 4 * intervalFrames);
+
+        ringBuffer.emplace();
+
+        if (const auto result = ma_pcm_rb_init(ma_format_s16, channelCount, capacity, nullptr, nullptr, &*ringBuffer);
+            result != MA_SUCCESS)
+        {
+            ringBuffer.reset();
+            err() << "Failed to initialize the audio capture buffer: " << ma_result_description(result) << std::endl;
+            return false;
+        }
+
+        // Allocate the processing buffer once, it is reused for every call to onProcessSamples
+        samples.resize(std::size_t{capacity} * channelCount);
+
+        overrunCount       = 0;
+        droppedSampleCount = 0;
+        stopRequested      = false;
+
+        processingThread = std::thread([this, interval = processingInterval] { processSamples(interval); });
+        return true;
+    }
+
+    void stopProcessing()
+    {
+        // Wake up the processing thread, it delivers the remaining samples before exiting
+        if (processingThread.joinable())
+        {
+            {
+                const std::lock_guard lock(processingMutex);
+                stopRequested = true;
+            }
+
+            processingCondition.notify_one();
+            processingThread.join();
+        }
+
+        if (ringBuffer)
+        {
+            ma_pcm_rb_uninit(&*ringBuffer);
+            ringBuffer.reset();
+        }
+    }
+
+    void processSamples(Time interval)
+    {
+        std::unique_lock lock(processingMutex);
+        bool             stopping = false;
+
+        while (!stopping)
+        {
+            stopping = processingCondition.wait_for(lock, interval.toDuration(), [this] { return stopRequested; });
+
+            lock.unlock();
+            const bool keepCapturing = deliverSamples();
+            lock.lock();
+
+            if (!keepCapturing)
+            {
+                // If the derived class wants to stop, stop the capture
+                if (!stopping)
+                {
+                    if (const auto result = ma_device_stop(&*captureDevice); result != MA_SUCCESS)
+                        err() << "Failed to stop audio capture device: " << ma_result_description(result) << std::endl;
+                }
+
+                return;
+            }
+        }
+    }
+
+    bool deliverSamples()
+    {
+        // Move the captured samples to the contiguous processing buffer
+        const auto  channels = ma_pcm_rb_get_channels(&*ringBuffer);
+        std::size_t count    = 0;
+
+        while (count < samples.size())
+        {
+            auto  frames = static_cast<std::uint32_t>((samples.size() - count) / channels);
+            void* buffer = nullptr;
+
+            if (ma_pcm_rb_acquire_read(&*ringBuffer, &frames, &buffer) != MA_SUCCESS || frames == 0)
+                break;
+
+            std::memcpy(samples.data() + count, buffer, frames * channels * sizeof(std::int16_t));
+            ma_pcm_rb_commit_read(&*ringBuffer, frames);
+
+            count += std::size_t{frames} * channels;
+        }
+
+        if (count == 0)
+            return true;
+
+        // Notify the derived class of the availability of new samples
+        return owner->onProcessSamples(samples.data(), count);
+    }
+
     static std::vector<ma_device_info> getAvailableDevices()
     {
         std::vector<ma_device_info> deviceList;
@@ -147,15 +269,23 @@ struct SoundRecorder::Impl
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    SoundRecorder* const      owner;                          //!< Owning SoundRecorder object
-    std::optional<ma_log>     log;                            //!< The miniaudio log
-    std::optional<ma_context> context;                        //!< The miniaudio context
-    std::optional<ma_device>  captureDevice;                  //!< The miniaudio capture device
-    std::string               deviceName{getDefaultDevice()}; //!< Name of the audio capture device
-    unsigned int              channelCount{1};                //!< Number of recording channels
-    unsigned int              sampleRate{44100};              //!< Sample rate
-    std::vector<std::int16_t> samples;                        //!< Buffer to store captured samples
-    std::vector<SoundChannel> channelMap{SoundChannel::Mono}; //!< The map of position in sample frame to sound channel
+    SoundRecorder* const       owner;                                 //!< Owning SoundRecorder object
+    std::optional<ma_log>      log;                                   //!< The miniaudio log
+    std::optional<ma_context>  context;                               //!< The miniaudio context
+    std::optional<ma_device>   captureDevice;                         //!< The miniaudio capture device
+    std::string                deviceName{getDefaultDevice()};        //!< Name of the audio capture device
+    unsigned int               channelCount{1};                       //!< Number of recording channels
+    unsigned int               sampleRate{44100};                     //!< Sample rate
+    std::vector<std::int16_t>  samples;                               //!< Buffer passed to onProcessSamples
+    std::vector<SoundChannel>  channelMap{SoundChannel::Mono};        //!< Map of sample frame position to sound channel
+    std::optional<ma_pcm_rb>   ringBuffer;                            //!< Lock-free capture buffer
+    Time                       processingInterval{milliseconds(100)}; //!< Delay between two calls to onProcessSamples
+    std::thread                processingThread;                      //!< Thread calling onProcessSamples
+    std::mutex                 processingMutex;                       //!< Mutex protecting stopRequested
+    std::condition_variable    processingCondition;                   //!< Wakes up the processing thread
+    bool                       stopRequested{};                       //!< Whether the processing thread should exit
+    std::atomic<std::uint64_t> overrunCount{};                        //!< Number of capture buffer overruns
+    std::atomic<std::uint64_t> droppedSampleCount{};                  //!< Number of samples lost to overruns
 };
 
 
@@ -255,6 +385,9 @@ SoundRecorder::~SoundRecorder()
     if (m_impl->captureDevice)
         ma_device_uninit(&*m_impl->captureDevice);
 
+    // Make sure the processing thread is gone
+    m_impl->stopProcessing();
+
     // Destroy the context
     if (m_impl->context)
         ma_context_uninit(&*m_impl->context);
@@ -303,12 +436,20 @@ bool SoundRecorder::start(unsigned int sampleRate)
         return false;
     }
 
+    // Clean up after a capture that was stopped by onProcessSamples
+    m_impl->stopProcessing();
+
     // Notify derived class
     if (onStart())
     {
+        // Start the thread delivering the captured samples
+        if (!m_impl->startProcessing())
+            return false;
+
         // Start the capture
         if (const auto result = ma_device_start(&*m_impl->captureDevice); result != MA_SUCCESS)
         {
+            m_impl->stopProcessing();
             err() << "Failed to start audio capture device: " << ma_result_description(result) << std::endl;
             return false;
         }
@@ -333,9 +474,16 @@ void SoundRecorder::stop()
             return;
         }
 
+        // Deliver the remaining samples
+        m_impl->stopProcessing();
+
         // Notify derived class
         onStop();
     }
+    else
+    {
+        m_impl->stopProcessing();
+    }
 }
 
 
@@ -443,6 +591,34 @@ const std::vector<SoundChannel>& SoundRecorder::getChannelMap() const
 }
 
 
+////////////////////////////////////////////////////////////
+void SoundRecorder::setProcessingInterval(Time interval)
+{
+    m_impl->processingInterval = interval;
+}
+
+
+////////////////////////////////////////////////////////////
+Time SoundRecorder::getProcessingInterval() const
+{
+    return m_impl->processingInterval;
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t SoundRecorder::getOverrunCount() const
+{
+    return m_impl->overrunCount.load(std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t SoundRecorder::getDroppedSampleCount() const
+{
+    return m_impl->droppedSampleCount.load(std::memory_order_relaxed);
+}
+
+
 ////////////////////////////////////////////////////////////
 bool SoundRecorder::isAvailable()
 {
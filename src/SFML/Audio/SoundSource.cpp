@@ -25,6 +25,9 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <SFML/Audio/AudioBus.hpp>
+#include <SFML/Audio/MiniaudioUtils.hpp>
+#include <SFML/Audio/MixBus.hpp>
 #include <SFML/Audio/SoundSource.hpp>
 
 #include <miniaudio.h>
@@ -32,6 +35,18 @@
 #include <algorithm>
 
 
+namespace
+{
+////////////////////////////////////////////////////////////
+// Changing the loudness or the position of a virtual sound may earn it a voice again
+void reconsiderVirtual(const ma_sound& sound)
+{
+    if (auto* soundBase = sf::priv::MiniaudioUtils::getSoundBase(sound))
+        soundBase->reconsiderVirtual();
+}
+} // namespace
+
+
 namespace sf
 {
 // NOLINTBEGIN(readability-make-member-function-const)
@@ -55,7 +70,10 @@ void SoundSource::setPan(float pan)
 void SoundSource::setVolume(float volume)
 {
     if (auto* sound = static_cast<ma_sound*>(getSound()))
+    {
         ma_sound_set_volume(sound, volume * 0.01f);
+        reconsiderVirtual(*sound);
+    }
 }
 
 
@@ -63,7 +81,10 @@ void SoundSource::setVolume(float volume)
 void SoundSource::setSpatializationEnabled(bool enabled)
 {
     if (auto* sound = static_cast<ma_sound*>(getSound()))
+    {
         ma_sound_set_spatialization_enabled(sound, enabled ? MA_TRUE : MA_FALSE);
+        reconsiderVirtual(*sound);
+    }
 }
 
 
@@ -71,7 +92,10 @@ void SoundSource::setSpatializationEnabled(bool enabled)
 void SoundSource::setPosition(const Vector3f& position)
 {
     if (auto* sound = static_cast<ma_sound*>(getSound()))
+    {
         ma_sound_set_position(sound, position.x, position.y, position.z);
+        reconsiderVirtual(*sound);
+    }
 }
 
 
@@ -122,7 +146,10 @@ void SoundSource::setDirectionalAttenuationFactor(float factor)
 void SoundSource::setRelativeToListener(bool relative)
 {
     if (auto* sound = static_cast<ma_sound*>(getSound()))
+    {
         ma_sound_set_positioning(sound, relative ? ma_positioning_relative : ma_positioning_absolute);
+        reconsiderVirtual(*sound);
+    }
 }
 
 
@@ -130,7 +157,10 @@ void SoundSource::setRelativeToListener(bool relative)
 void SoundSource::setMinDistance(float distance)
 {
     if (auto* sound = static_cast<ma_sound*>(getSound()))
+    {
         ma_sound_set_min_distance(sound, distance);
+        reconsiderVirtual(*sound);
+    }
 }
 
 
@@ -138,7 +168,10 @@ void SoundSource::setMinDistance(float distance)
 void SoundSource::setMaxDistance(float distance)
 {
     if (auto* sound = static_cast<ma_sound*>(getSound()))
+    {
         ma_sound_set_max_distance(sound, distance);
+        reconsiderVirtual(*sound);
+    }
 }
 
 
@@ -146,7 +179,10 @@ void SoundSource::setMaxDistance(float distance)
 void SoundSource::setMinGain(float gain)
 {
     if (auto* sound = static_cast<ma_sound*>(getSound()))
+    {
         ma_sound_set_min_gain(sound, gain);
+        reconsiderVirtual(*sound);
+    }
 }
 
 
@@ -154,7 +190,10 @@ void SoundSource::setMinGain(float gain)
 void SoundSource::setMaxGain(float gain)
 {
     if (auto* sound = static_cast<ma_sound*>(getSound()))
+    {
         ma_sound_set_max_gain(sound, gain);
+        reconsiderVirtual(*sound);
+    }
 }
 
 
@@ -162,7 +201,35 @@ void SoundSource::setMaxGain(float gain)
 void SoundSource::setAttenuation(float attenuation)
 {
     if (auto* sound = static_cast<ma_sound*>(getSound()))
+    {
         ma_sound_set_rolloff(sound, attenuation);
+        reconsiderVirtual(*sound);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundSource::setPriority(int priority)
+{
+    if (const auto* sound = static_cast<const ma_sound*>(getSound()))
+    {
+        if (auto* soundBase = priv::MiniaudioUtils::getSoundBase(*sound))
+        {
+            soundBase->priority = priority;
+            soundBase->reconsiderVirtual();
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundSource::setBus(AudioBus* bus)
+{
+    if (const auto* sound = static_cast<const ma_sound*>(getSound()))
+    {
+        if (auto* soundBase = priv::MiniaudioUtils::getSoundBase(*sound))
+            soundBase->setBus(bus ? bus->m_mixBus.get() : nullptr);
+    }
 }
 
 
@@ -350,6 +417,45 @@ float SoundSource::getAttenuation() const
 }
 
 
+////////////////////////////////////////////////////////////
+int SoundSource::getPriority() const
+{
+    if (const auto* sound = static_cast<const ma_sound*>(getSound()))
+    {
+        if (const auto* soundBase = priv::MiniaudioUtils::getSoundBase(*sound))
+            return soundBase->priority;
+    }
+
+    return 0;
+}
+
+
+////////////////////////////////////////////////////////////
+AudioBus* SoundSource::getBus() const
+{
+    if (const auto* sound = static_cast<const ma_sound*>(getSound()))
+    {
+        if (const auto* soundBase = priv::MiniaudioUtils::getSoundBase(*sound); soundBase && soundBase->bus)
+            return &soundBase->bus->getOwner();
+    }
+
+    return nullptr;
+}
+
+
+////////////////////////////////////////////////////////////
+bool SoundSource::isVirtual() const
+{
+    if (const auto* sound = static_cast<const ma_sound*>(getSound()))
+    {
+        if (const auto* soundBase = priv::MiniaudioUtils::getSoundBase(*sound))
+            return soundBase->isVirtual;
+    }
+
+    return false;
+}
+
+
 ////////////////////////////////////////////////////////////
 SoundSource& SoundSource::operator=(const SoundSource& right)
 {
@@ -369,6 +475,8 @@ SoundSource& SoundSource::operator=(const SoundSource& right)
     setMinGain(right.getMinGain());
     setMaxGain(right.getMaxGain());
     setAttenuation(right.getAttenuation());
+    setPriority(right.getPriority());
+    setBus(right.getBus());
 
     return *this;
 }
@@ -276,7 +276,7 @@ void SoundStream::play()
     if (m_impl->status == Status::Playing)
         setPlayingOffset(Time::Zero);
 
-    if (const ma_result result = ma_sound_start(&m_impl->sound); result != MA_SUCCESS)
+    if (const ma_result result = m_impl->start(); result != MA_SUCCESS)
     {
         err() << "Failed to start playing sound: " << ma_result_description(result) << std::endl;
     }
@@ -290,6 +290,10 @@ void SoundStream::play()
 ////////////////////////////////////////////////////////////
 void SoundStream::pause()
 {
+    // Resolve the position a virtual voice has reached so it resumes from there
+    if (m_impl->isVirtual)
+        m_impl->leaveVirtual(false);
+
     if (const ma_result result = ma_sound_stop(&m_impl->sound); result != MA_SUCCESS)
     {
         err() << "Failed to stop playing sound: " << ma_result_description(result) << std::endl;
@@ -305,6 +309,8 @@ void SoundStream::pause()
 ////////////////////////////////////////////////////////////
 void SoundStream::stop()
 {
+    m_impl->isVirtual = false;
+
     if (const ma_result result = ma_sound_stop(&m_impl->sound); result != MA_SUCCESS)
     {
         err() << "Failed to stop playing sound: " << ma_result_description(result) << std::endl;
@@ -363,6 +369,10 @@ void SoundStream::setPlayingOffset(Time timeOffset)
     m_impl->samplesProcessed   = frameIndex * m_impl->channelCount;
 
     onSeek(seconds(static_cast<float>(frameIndex) / static_cast<float>(m_impl->sampleRate)));
+
+    // Virtual voices continue advancing from the new position
+    if (m_impl->isVirtual)
+        m_impl->enterVirtual();
 }
 
 
@@ -372,7 +382,7 @@ Time SoundStream::getPlayingOffset() const
     if (m_impl->channelCount == 0 || m_impl->sampleRate == 0)
         return {};
 
-    return priv::MiniaudioUtils::getPlayingOffset(m_impl->sound);
+    return m_impl->getPlayingOffset();
 }
 
 
@@ -0,0 +1,338 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/AudioDevice.hpp>
+#include <SFML/Audio/MiniaudioUtils.hpp>
+#include <SFML/Audio/VoicePool.hpp>
+
+#include <miniaudio.h>
+
+#include <algorithm>
+
+#include <cmath>
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+float getDistanceGain(const ma_sound& sound, float distance)
+{
+    // Mirror the attenuation models applied by the miniaudio spatializer
+    const float minDistance = ma_sound_get_min_distance(&sound);
+    const float maxDistance = ma_sound_get_max_distance(&sound);
+    const float rollOff     = ma_sound_get_rolloff(&sound);
+    float       gain        = 1.f;
+
+    if (minDistance < maxDistance)
+    {
+        distance = std::clamp(distance, minDistance, maxDistance);
+
+        switch (ma_sound_get_attenuation_model(&sound))
+        {
+            case ma_attenuation_model_inverse:
+                if (const float denominator = minDistance + rollOff * (distance - minDistance); denominator > 0.f)
+                    gain = minDistance / denominator;
+                break;
+            case ma_attenuation_model_linear:
+                gain = 1.f - rollOff * (distance - minDistance) / (maxDistance - minDistance);
+                break;
+            case ma_attenuation_model_exponential:
+                if (minDistance > 0.f)
+                    gain = std::pow(distance / minDistance, -rollOff);
+                break;
+            default:
+                break;
+        }
+    }
+
+    return std::clamp(gain, ma_sound_get_min_gain(&sound), ma_sound_get_max_gain(&sound));
+}
+} // namespace
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+void VoicePool::registerVoice(MiniaudioUtils::SoundBase& voice)
+{
+    auto&                 state = getState();
+    const std::lock_guard lock(state.mutex);
+    state.voices.push_back(&voice);
+}
+
+
+////////////////////////////////////////////////////////////
+void VoicePool::unregisterVoice(MiniaudioUtils::SoundBase& voice)
+{
+    auto&                 state = getState();
+    const std::lock_guard lock(state.mutex);
+    state.voices.erase(std::remove(state.voices.begin(), state.voices.end(), &voice), state.voices.end());
+}
+
+
+////////////////////////////////////////////////////////////
+bool VoicePool::acquire(MiniaudioUtils::SoundBase& voice)
+{
+    auto&                 state = getState();
+    const std::lock_guard lock(state.mutex);
+
+    // Voice management is opt-in, sounds are never culled or stolen until it is used
+    if (!isManaged(state))
+        return true;
+
+    const auto rating = rate(voice, state.cullDistance);
+
+    if (rating.culled)
+        return false;
+
+    if (state.maxVoices == 0)
+        return true;
+
+    // Find the weakest voice that is currently being mixed
+    unsigned int               activeCount = 0;
+    MiniaudioUtils::SoundBase* weakest{};
+    Rating                     weakestRating;
+
+    for (auto* other : state.voices)
+    {
+        if ((other == &voice) || other->isVirtual || (other->status != SoundSource::Status::Playing))
+            continue;
+
+        ++activeCount;
+
+        const auto otherRating = rate(*other, state.cullDistance);
+
+        if (!weakest || outranks(weakestRating, otherRating))
+        {
+            weakest       = other;
+            weakestRating = otherRating;
+        }
+    }
+
+    if (activeCount < state.maxVoices)
+        return true;
+
+    // Steal the slot of the weakest voice if the new voice is more important
+    if (weakest && outranks(rating, weakestRating))
+    {
+        weakest->enterVirtual();
+        return true;
+    }
+
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////
+void VoicePool::update()
+{
+    auto&                 state = getState();
+    const std::lock_guard lock(state.mutex);
+
+    // Inaudible voices are only culled once voice management is used
+    const bool managed = isManaged(state);
+
+    for (auto* voice : state.voices)
+    {
+        if (voice->status != SoundSource::Status::Playing)
+            continue;
+
+        // Virtual voices that would have reached their end by now are stopped
+        if (voice->isVirtual && !voice->getVirtualCursor())
+        {
+            voice->leaveVirtual(false);
+            continue;
+        }
+
+        const auto rating = rate(*voice, state.cullDistance);
+
+        if (rating.culled && managed)
+        {
+            if (!voice->isVirtual)
+                voice->enterVirtual();
+
+            continue;
+        }
+
+        state.ranking.emplace_back(voice, rating);
+    }
+
+    // Voices that are already being mixed win ties so voices of equal rank don't flip-flop between updates
+    std::sort(state.ranking.begin(),
+              state.ranking.end(),
+              [](const auto& lhs, const auto& rhs)
+              {
+                  if (outranks(lhs.second, rhs.second))
+                      return true;
+
+                  if (outranks(rhs.second, lhs.second))
+                      return false;
+
+                  return !lhs.first->isVirtual && rhs.first->isVirtual;
+              });
+
+    const auto slotCount = state.maxVoices == 0 ? state.ranking.size()
+                                                : std::min<std::size_t>(state.maxVoices, state.ranking.size());
+
+    // Free slots before handing them out so we never exceed the limit
+    for (auto i = slotCount; i < state.ranking.size(); ++i)
+    {
+        if (!state.ranking[i].first->isVirtual)
+            state.ranking[i].first->enterVirtual();
+    }
+
+    for (auto i = std::size_t{0}; i < slotCount; ++i)
+    {
+        if (state.ranking[i].first->isVirtual)
+            state.ranking[i].first->leaveVirtual(true);
+    }
+
+    state.ranking.clear();
+}
+
+
+////////////////////////////////////////////////////////////
+void VoicePool::setMaxVoices(unsigned int maxVoices)
+{
+    auto&                 state = getState();
+    const std::lock_guard lock(state.mutex);
+    state.maxVoices = maxVoices;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int VoicePool::getMaxVoices()
+{
+    auto&                 state = getState();
+    const std::lock_guard lock(state.mutex);
+    return state.maxVoices;
+}
+
+
+////////////////////////////////////////////////////////////
+void VoicePool::setCullDistance(float distance)
+{
+    auto&                 state = getState();
+    const std::lock_guard lock(state.mutex);
+    state.cullDistance = distance;
+}
+
+
+////////////////////////////////////////////////////////////
+float VoicePool::getCullDistance()
+{
+    auto&                 state = getState();
+    const std::lock_guard lock(state.mutex);
+    return state.cullDistance;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int VoicePool::getActiveVoiceCount()
+{
+    auto&                 state = getState();
+    const std::lock_guard lock(state.mutex);
+    return static_cast<unsigned int>(
+        std::count_if(state.voices.begin(),
+                      state.voices.end(),
+                      [](const auto* voice)
+                      { return !voice->isVirtual && (voice->status == SoundSource::Status::Playing); }));
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int VoicePool::getVirtualVoiceCount()
+{
+    auto&                 state = getState();
+    const std::lock_guard lock(state.mutex);
+    return static_cast<unsigned int>(
+        std::count_if(state.voices.begin(),
+                      state.voices.end(),
+                      [](const auto* voice)
+                      { return voice->isVirtual && (voice->status == SoundSource::Status::Playing); }));
+}
+
+
+////////////////////////////////////////////////////////////
+VoicePool::Rating VoicePool::rate(MiniaudioUtils::SoundBase& voice, float cullDistance)
+{
+    auto&  sound = voice.sound;
+    Rating rating{voice.priority, ma_sound_get_volume(&sound), false};
+
+    if (auto* engine = AudioDevice::getEngine(); engine && ma_sound_is_spatialization_enabled(&sound))
+    {
+        auto position = ma_sound_get_position(&sound);
+
+        if (ma_sound_get_positioning(&sound) == ma_positioning_absolute)
+        {
+            const auto listenerPosition = ma_engine_listener_get_position(engine, 0);
+            position.x -= listenerPosition.x;
+            position.y -= listenerPosition.y;
+            position.z -= listenerPosition.z;
+        }
+
+        const float distance = std::sqrt(position.x * position.x + position.y * position.y + position.z * position.z);
+
+        if (distance > cullDistance)
+            rating.culled = true;
+
+        rating.gain *= getDistanceGain(sound, distance);
+    }
+
+    if (rating.gain <= 0.f)
+        rating.culled = true;
+
+    return rating;
+}
+
+
+////////////////////////////////////////////////////////////
+bool VoicePool::outranks(const Rating& lhs, const Rating& rhs)
+{
+    if (lhs.priority != rhs.priority)
+        return lhs.priority > rhs.priority;
+
+    return lhs.gain > rhs.gain;
+}
+
+
+////////////////////////////////////////////////////////////
+bool VoicePool::isManaged(const State& state)
+{
+    return (state.maxVoices != 0) || (state.cullDistance != std::numeric_limits<float>::max());
+}
+
+
+////////////////////////////////////////////////////////////
+VoicePool::State& VoicePool::getState()
+{
+    static State state;
+    return state;
+}
+
+} // namespace sf::priv
@@ -0,0 +1,205 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <limits>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+
+namespace sf::priv
+{
+namespace MiniaudioUtils
+{
+struct SoundBase;
+}
+
+////////////////////////////////////////////////////////////
+/// \brief Keeps track of all voices and decides which of
+///        them get mixed when the number of concurrently
+///        playing voices is limited
+///
+////////////////////////////////////////////////////////////
+class VoicePool
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Register a voice with the pool
+    ///
+    /// \param voice The voice to register
+    ///
+    /// \see unregisterVoice
+    ///
+    ////////////////////////////////////////////////////////////
+    static void registerVoice(MiniaudioUtils::SoundBase& voice);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Unregister a voice from the pool
+    ///
+    /// \param voice The voice to unregister
+    ///
+    /// \see registerVoice
+    ///
+    ////////////////////////////////////////////////////////////
+    static void unregisterVoice(MiniaudioUtils::SoundBase& voice);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Try to acquire a voice slot for a voice that is about to start
+    ///
+    /// If all slots are taken, the weakest playing voice is
+    /// made virtual to free its slot, provided it ranks below
+    /// \a voice. The weakest voice is the one with the lowest
+    /// priority or, among equal priorities, the quietest one.
+    ///
+    /// \param voice The voice that wants to start playing
+    ///
+    /// \return `true` if the voice may be mixed, `false` if it has to start out virtual
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool acquire(MiniaudioUtils::SoundBase& voice);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Re-evaluate which playing voices get mixed
+    ///
+    ////////////////////////////////////////////////////////////
+    static void update();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the maximum number of voices that are mixed at once
+    ///
+    /// \param maxVoices Maximum number of mixed voices, 0 for no limit
+    ///
+    ////////////////////////////////////////////////////////////
+    static void setMaxVoices(unsigned int maxVoices);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the maximum number of voices that are mixed at once
+    ///
+    /// \return Maximum number of mixed voices, 0 if there is no limit
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static unsigned int getMaxVoices();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the distance beyond which spatialized voices are culled
+    ///
+    /// \param distance Cull distance
+    ///
+    ////////////////////////////////////////////////////////////
+    static void setCullDistance(float distance);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the distance beyond which spatialized voices are culled
+    ///
+    /// \return Cull distance
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static float getCullDistance();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of playing voices that are being mixed
+    ///
+    /// \return Number of mixed voices
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static unsigned int getActiveVoiceCount();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of playing voices that are virtual
+    ///
+    /// \return Number of virtual voices
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static unsigned int getVirtualVoiceCount();
+
+private:
+    struct Rating
+    {
+        int   priority{}; //!< Priority of the voice
+        float gain{};     //!< Estimated gain of the voice at the listener
+        bool  culled{};   //!< `true` if the voice is out of range or inaudible
+    };
+
+    struct State
+    {
+        std::mutex                              mutex;       //!< Mutex guarding the voice list
+        std::vector<MiniaudioUtils::SoundBase*> voices;      //!< All registered voices
+        unsigned int                            maxVoices{}; //!< Maximum number of mixed voices, 0 for no limit
+        float cullDistance{std::numeric_limits<float>::max()}; //!< Distance beyond which spatialized voices are culled
+        std::vector<std::pair<MiniaudioUtils::SoundBase*, Rating>> ranking; //!< Scratch space reused by update()
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Rate how important it is to keep a voice audible
+    ///
+    /// \param voice        The voice to rate
+    /// \param cullDistance Distance beyond which spatialized voices are culled
+    ///
+    /// \return The rating of the voice
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static Rating rate(MiniaudioUtils::SoundBase& voice, float cullDistance);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Check whether a voice should be preferred over another
+    ///
+    /// Priority is compared first, the estimated gain breaks ties.
+    ///
+    /// \param lhs Rating of the first voice
+    /// \param rhs Rating of the second voice
+    ///
+    /// \return `true` if the first voice outranks the second one
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool outranks(const Rating& lhs, const Rating& rhs);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Check whether voice management was enabled
+    ///
+    /// Until a voice limit or a cull distance is set, every
+    /// voice is mixed, even the inaudible ones.
+    ///
+    /// \param state The shared state
+    ///
+    /// \return `true` if voices may be culled or stolen
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool isManaged(const State& state);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the state shared by all voices
+    ///
+    /// \return The shared state
+    ///
+    ////////////////////////////////////////////////////////////
+    static State& getState();
+};
+
+} // namespace sf::priv
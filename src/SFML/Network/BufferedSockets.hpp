@@ -0,0 +1,63 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Network/SocketHandle.hpp>
+
+#include <vector>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Tell the socket selectors whether a socket holds
+///        data already read from the operating system
+///
+/// Such data, e.g. the rest of a decrypted TLS record, can be
+/// received even though the operating system doesn't report
+/// the socket as ready. `sf::SocketSelector` reports the
+/// registered sockets which it watches as ready.
+///
+/// \param handle   Handle of the socket
+/// \param buffered `true` to register the socket, `false` to unregister it
+///
+////////////////////////////////////////////////////////////
+void setSocketBuffered(SocketHandle handle, bool buffered);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the handles of the sockets holding buffered data
+///
+/// This doesn't lock anything when no socket is registered,
+/// which is the usual case.
+///
+/// \param handles Filled with the handles of the registered sockets
+///
+////////////////////////////////////////////////////////////
+void getBufferedSockets(std::vector<SocketHandle>& handles);
+
+} // namespace sf::priv
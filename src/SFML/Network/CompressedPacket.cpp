@@ -0,0 +1,476 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Network/CompressedPacket.hpp>
+
+#include <SFML/System/Err.hpp>
+
+#include <algorithm>
+#include <array>
+#include <ostream>
+
+#include <cstdint>
+#include <cstring>
+
+
+namespace
+{
+// Wire format: one flags byte, then for compressed data the varint size of
+// the uncompressed data followed by an LZ4 block, otherwise the data itself
+constexpr std::uint8_t flagCompressed = 1 << 0; // Payload is an LZ4 block
+constexpr std::uint8_t flagDelta      = 1 << 1; // Uncompressed payload is a delta against the baseline
+
+// LZ4 block format constants
+constexpr std::size_t minMatch     = 4;     // Shortest match worth encoding
+constexpr std::size_t lastLiterals = 5;     // The last bytes of a block are always literals
+constexpr std::size_t matchLimit   = 12;    // No match may start this close to the end of a block
+constexpr std::size_t maxOffset    = 65535; // Furthest back a match may point
+constexpr int         hashBits     = 12;    // Size of the match finder hash table, in bits
+
+// Ranges of unchanged bytes shorter than this are sent as part of the surrounding changes
+constexpr std::size_t minUnchangedRun = 4;
+
+
+////////////////////////////////////////////////////////////
+void appendVarint(std::vector<std::byte>& output, std::size_t value)
+{
+    while (value >= 0x80)
+    {
+        output.push_back(static_cast<std::byte>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+
+    output.push_back(static_cast<std::byte>(value));
+}
+
+
+////////////////////////////////////////////////////////////
+bool parseVarint(const std::byte*& input, const std::byte* end, std::size_t& value)
+{
+    value = 0;
+
+    for (unsigned int shift = 0; (shift < sizeof(value) * 8) && (input != end); shift += 7)
+    {
+        const auto byte = std::to_integer<std::size_t>(*input++);
+        value |= (byte & 0x7F) << shift;
+
+        if ((byte & 0x80) == 0)
+            return true;
+    }
+
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////
+void writeLength(std::vector<std::byte>& output, std::size_t length)
+{
+    // Lengths which don't fit in their 4 bits of the token continue with 255-valued bytes
+    for (; length >= 255; length -= 255)
+        output.push_back(std::byte{255});
+
+    output.push_back(static_cast<std::byte>(length));
+}
+
+
+////////////////////////////////////////////////////////////
+bool readLength(const std::byte*& input, const std::byte* end, std::size_t& length)
+{
+    std::uint8_t byte = 255;
+
+    while (byte == 255)
+    {
+        if (input == end)
+            return false;
+
+        byte = std::to_integer<std::uint8_t>(*input++);
+        length += byte;
+    }
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void writeSequence(std::vector<std::byte>& output,
+                   const std::byte*        literals,
+                   std::size_t             literalCount,
+                   std::size_t             offset,
+                   std::size_t             matchLength)
+{
+    const std::size_t matchCode = (matchLength > 0) ? matchLength - minMatch : 0;
+
+    output.push_back(static_cast<std::byte>((std::min<std::size_t>(literalCount, 15) << 4) |
+                                            std::min<std::size_t>(matchCode, 15)));
+
+    if (literalCount >= 15)
+        writeLength(output, literalCount - 15);
+
+    output.insert(output.end(), literals, literals + literalCount);
+
+    // The last sequence of a block only has literals
+    if (matchLength == 0)
+        return;
+
+    output.push_back(static_cast<std::byte>(offset & 0xFF));
+    output.push_back(static_cast<std::byte>(offset >> 8));
+
+    if (matchCode >= 15)
+        writeLength(output, matchCode - 15);
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint32_t read32(const std::byte* data)
+{
+    std::uint32_t value = 0;
+    std::memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+
+////////////////////////////////////////////////////////////
+void compress(const std::byte* input, std::size_t size, std::vector<std::byte>& output)
+{
+    // Greedy LZ4 compressor: look the next 4 bytes up in a hash table
+    // of recent positions, and extend the match when one is found
+    std::array<std::uint32_t, 1 << hashBits> table{}; // Position + 1 of the last occurrence, 0 for none
+
+    std::size_t anchor   = 0;
+    std::size_t position = 0;
+
+    while ((size >= matchLimit) && (position + matchLimit <= size))
+    {
+        const std::uint32_t sequence = read32(input + position);
+        const std::size_t   hash     = (sequence * 2654435761u) >> (32 - hashBits);
+        const std::size_t   previous = table[hash];
+
+        table[hash] = static_cast<std::uint32_t>(position + 1);
+
+        if ((previous == 0) || (position - (previous - 1) > maxOffset) || (read32(input + previous - 1) != sequence))
+        {
+            ++position;
+            continue;
+        }
+
+        const std::size_t reference = previous - 1;
+        std::size_t       length    = minMatch;
+        while ((position + length < size - lastLiterals) && (input[reference + length] == input[position + length]))
+            ++length;
+
+        writeSequence(output, input + anchor, position - anchor, position - reference, length);
+
+        position += length;
+        anchor = position;
+    }
+
+    writeSequence(output, input + anchor, size - anchor, 0, 0);
+}
+
+
+////////////////////////////////////////////////////////////
+bool decompress(const std::byte* input, std::size_t size, std::vector<std::byte>& output, std::size_t outputSize)
+{
+    const std::byte* const end = input + size;
+
+    output.resize(outputSize);
+    std::size_t written = 0;
+
+    while (input != end)
+    {
+        const auto token = std::to_integer<std::uint8_t>(*input++);
+
+        // Copy the literals
+        std::size_t literalCount = token >> 4;
+        if ((literalCount == 15) && !readLength(input, end, literalCount))
+            return false;
+
+        if ((literalCount > static_cast<std::size_t>(end - input)) || (literalCount > outputSize - written))
+            return false;
+
+        std::memcpy(output.data() + written, input, literalCount);
+        input += literalCount;
+        written += literalCount;
+
+        // The last sequence has no match
+        if (input == end)
+            break;
+
+        // Copy the match, which may overlap the bytes it produces
+        if (end - input < 2)
+            return false;
+
+        const std::size_t offset = std::to_integer<std::size_t>(input[0]) | (std::to_integer<std::size_t>(input[1]) << 8);
+        input += 2;
+
+        std::size_t matchLength = token & 0x0F;
+        if ((matchLength == 15) && !readLength(input, end, matchLength))
+            return false;
+        matchLength += minMatch;
+
+        if ((offset == 0) || (offset > written) || (matchLength > outputSize - written))
+            return false;
+
+        for (std::size_t i = 0; i < matchLength; ++i, ++written)
+            output[written] = output[written - offset];
+    }
+
+    return written == outputSize;
+}
+
+
+////////////////////////////////////////////////////////////
+void encodeDelta(const std::byte*              data,
+                 std::size_t                   size,
+                 const std::vector<std::byte>& baseline,
+                 std::vector<std::byte>&       output)
+{
+    // Alternate runs of bytes identical to the baseline (only counted)
+    // and runs of changed bytes (sent as they are)
+    const auto unchanged = [&](std::size_t index) { return (index < baseline.size()) && (data[index] == baseline[index]); };
+
+    const auto unchangedRunAt = [&](std::size_t index)
+    {
+        std::size_t run = 0;
+        while ((index + run < size) && (run < minUnchangedRun) && unchanged(index + run))
+            ++run;
+
+        return (run == minUnchangedRun) || ((run > 0) && (index + run == size));
+    };
+
+    appendVarint(output, size);
+
+    std::size_t index = 0;
+    while (index < size)
+    {
+        const std::size_t unchangedStart = index;
+        while ((index < size) && unchanged(index))
+            ++index;
+
+        const std::size_t changedStart = index;
+        while ((index < size) && !unchangedRunAt(index))
+            ++index;
+
+        appendVarint(output, changedStart - unchangedStart);
+        appendVarint(output, index - changedStart);
+        output.insert(output.end(), data + changedStart, data + index);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool decodeDelta(const std::byte*              input,
+                 std::size_t                   size,
+                 const std::vector<std::byte>& baseline,
+                 std::size_t                   maxSize,
+                 std::vector<std::byte>&       output)
+{
+    const std::byte* const end = input + size;
+
+    std::size_t outputSize = 0;
+    if (!parseVarint(input, end, outputSize) || (outputSize > maxSize))
+        return false;
+
+    output.resize(outputSize);
+    std::size_t written = 0;
+
+    while (written < outputSize)
+    {
+        std::size_t unchangedCount = 0;
+        std::size_t changedCount   = 0;
+        if (!parseVarint(input, end, unchangedCount) || !parseVarint(input, end, changedCount))
+            return false;
+
+        if ((unchangedCount > outputSize - written) || (written + unchangedCount > baseline.size()))
+            return false;
+
+        std::copy_n(baseline.data() + written, unchangedCount, output.data() + written);
+        written += unchangedCount;
+
+        if ((changedCount > outputSize - written) || (changedCount > static_cast<std::size_t>(end - input)))
+            return false;
+
+        std::copy_n(input, changedCount, output.data() + written);
+        input += changedCount;
+        written += changedCount;
+    }
+
+    return input == end;
+}
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+void CompressedPacket::setCompressionThreshold(std::size_t size)
+{
+    m_compressionThreshold = size;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t CompressedPacket::getCompressionThreshold() const
+{
+    return m_compressionThreshold;
+}
+
+
+////////////////////////////////////////////////////////////
+void CompressedPacket::setMaxDecompressedSize(std::size_t size)
+{
+    m_maxDecompressedSize = size;
+}
+
+
+////////////////////////////////////////////////////////////
+void CompressedPacket::setBaseline(const Packet& baseline)
+{
+    const auto* data = static_cast<const std::byte*>(baseline.getData());
+    m_baseline.assign(data, data + baseline.getDataSize());
+    m_hasBaseline = true;
+}
+
+
+////////////////////////////////////////////////////////////
+void CompressedPacket::clearBaseline()
+{
+    m_baseline.clear();
+    m_hasBaseline = false;
+}
+
+
+////////////////////////////////////////////////////////////
+bool CompressedPacket::hasBaseline() const
+{
+    return m_hasBaseline;
+}
+
+
+////////////////////////////////////////////////////////////
+const void* CompressedPacket::onSend(std::size_t& size)
+{
+    const auto*  data     = static_cast<const std::byte*>(getData());
+    std::size_t  dataSize = getDataSize();
+    std::uint8_t flags    = 0;
+
+    if (m_hasBaseline)
+    {
+        m_scratchBuffer.clear();
+        encodeDelta(data, dataSize, m_baseline, m_scratchBuffer);
+
+        data     = m_scratchBuffer.data();
+        dataSize = m_scratchBuffer.size();
+        flags |= flagDelta;
+    }
+
+    m_sendBuffer.clear();
+    m_sendBuffer.push_back(std::byte{});
+
+    if (dataSize >= m_compressionThreshold)
+    {
+        appendVarint(m_sendBuffer, dataSize);
+        compress(data, dataSize, m_sendBuffer);
+
+        // Keep the compressed data only if it is actually smaller
+        if (m_sendBuffer.size() < dataSize + 1)
+            flags |= flagCompressed;
+        else
+            m_sendBuffer.resize(1);
+    }
+
+    if ((flags & flagCompressed) == 0)
+        m_sendBuffer.insert(m_sendBuffer.end(), data, data + dataSize);
+
+    m_sendBuffer.front() = static_cast<std::byte>(flags);
+
+    size = m_sendBuffer.size();
+    return m_sendBuffer.data();
+}
+
+
+////////////////////////////////////////////////////////////
+void CompressedPacket::onReceive(const void* data, std::size_t size)
+{
+    const auto*       input = static_cast<const std::byte*>(data);
+    const auto* const end   = input + size;
+
+    if (size == 0)
+    {
+        err() << "Failed to decode compressed packet (no data)" << std::endl;
+        invalidate();
+        return;
+    }
+
+    const auto flags = std::to_integer<std::uint8_t>(*input++);
+
+    if ((flags & flagDelta) && !m_hasBaseline)
+    {
+        err() << "Failed to decode compressed packet (received a delta but no baseline is set)" << std::endl;
+        invalidate();
+        return;
+    }
+
+    // Decompress into the scratch buffer
+    if (flags & flagCompressed)
+    {
+        std::size_t decompressedSize = 0;
+        if (!parseVarint(input, end, decompressedSize) || (decompressedSize > m_maxDecompressedSize) ||
+            !decompress(input, static_cast<std::size_t>(end - input), m_scratchBuffer, decompressedSize))
+        {
+            err() << "Failed to decode compressed packet (invalid compressed data)" << std::endl;
+            invalidate();
+            return;
+        }
+
+        input = m_scratchBuffer.data();
+        size  = m_scratchBuffer.size();
+    }
+    else
+    {
+        size = static_cast<std::size_t>(end - input);
+    }
+
+    if (flags & flagDelta)
+    {
+        std::vector<std::byte> snapshot;
+        if (!decodeDelta(input, size, m_baseline, m_maxDecompressedSize, snapshot))
+        {
+            err() << "Failed to decode compressed packet (invalid delta)" << std::endl;
+            invalidate();
+            return;
+        }
+
+        append(snapshot.data(), snapshot.size());
+        return;
+    }
+
+    append(input, size);
+}
+
+} // namespace sf
@@ -0,0 +1,407 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Network/Dns.hpp>
+#include <SFML/Network/DnsImpl.hpp>
+#include <SFML/Network/SocketImpl.hpp>
+
+#include <SFML/System/Clock.hpp>
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+
+#include <cctype>
+#include <cstddef>
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+constexpr std::size_t maxCacheEntries   = 256; // Names closest to expiring are evicted beyond this count
+constexpr std::size_t maxResolveThreads = 4;   // Lookups running at once, the other ones wait in a queue
+
+
+////////////////////////////////////////////////////////////
+// Host names resolved by the system resolver, and host entries
+////////////////////////////////////////////////////////////
+struct Cache
+{
+    struct Entry
+    {
+        sf::IpAddress address;    // Address the name resolved to
+        sf::Time      expiration; // Time at which the entry expires, relative to the cache clock
+    };
+
+    std::mutex                                     mutex;                       // Protects all the members
+    sf::Clock                                      clock;                       // Reference for the expiration times
+    sf::Time                                       timeToLive{sf::seconds(60)}; // Time during which names are reused
+    std::unordered_map<std::string, Entry>         entries;                     // Names resolved by the system
+    std::unordered_map<std::string, sf::IpAddress> hosts;                       // Host entries, which never expire
+};
+
+Cache& getCache()
+{
+    static Cache cache;
+    return cache;
+}
+
+
+////////////////////////////////////////////////////////////
+// Host names are case insensitive, and may end with the dot of the root domain
+////////////////////////////////////////////////////////////
+std::string normalize(std::string_view name)
+{
+    if (!name.empty() && name.back() == '.')
+        name.remove_suffix(1);
+
+    std::string result(name);
+    for (char& character : result)
+        character = static_cast<char>(std::tolower(static_cast<unsigned char>(character)));
+    return result;
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<sf::IpAddress> findCached(const std::string& name)
+{
+    Cache&                cache = getCache();
+    const std::lock_guard lock(cache.mutex);
+
+    if (const auto host = cache.hosts.find(name); host != cache.hosts.end())
+        return host->second;
+
+    const auto entry = cache.entries.find(name);
+    if (entry == cache.entries.end())
+        return std::nullopt;
+
+    if (entry->second.expiration <= cache.clock.getElapsedTime())
+    {
+        cache.entries.erase(entry);
+        return std::nullopt;
+    }
+
+    return entry->second.address;
+}
+
+
+////////////////////////////////////////////////////////////
+void insertCached(const std::string& name, sf::IpAddress address)
+{
+    Cache&                cache = getCache();
+    const std::lock_guard lock(cache.mutex);
+
+    if (cache.timeToLive == sf::Time::Zero)
+        return;
+
+    const sf::Time now = cache.clock.getElapsedTime();
+
+    // Make room for the new name: drop the expired entries first, then the ones closest to expiring
+    if ((cache.entries.size() >= maxCacheEntries) && (cache.entries.count(name) == 0))
+    {
+        for (auto it = cache.entries.begin(); it != cache.entries.end();)
+            it = (it->second.expiration <= now) ? cache.entries.erase(it) : std::next(it);
+
+        if (cache.entries.size() >= maxCacheEntries)
+            cache.entries.erase(std::min_element(cache.entries.begin(),
+                                                 cache.entries.end(),
+                                                 [](const auto& left, const auto& right)
+                                                 { return left.second.expiration < right.second.expiration; }));
+    }
+
+    cache.entries.insert_or_assign(name, Cache::Entry{address, now + cache.timeToLive});
+}
+
+
+////////////////////////////////////////////////////////////
+// Decimal and IPv6 addresses are parsed by IpAddress::resolve without querying the system resolver
+////////////////////////////////////////////////////////////
+bool isLiteralAddress(std::string_view address)
+{
+    if (address.find(':') != std::string_view::npos)
+        return true;
+
+    return std::all_of(address.begin(),
+                       address.end(),
+                       [](char character)
+                       { return (character == '.') || std::isdigit(static_cast<unsigned char>(character)); });
+}
+
+
+////////////////////////////////////////////////////////////
+// Pool of threads running the lookups of resolveAsync
+////////////////////////////////////////////////////////////
+class Resolver
+{
+public:
+    Resolver()
+    {
+        // The cache must outlive the threads that fill it
+        (void)getCache();
+    }
+
+    ~Resolver()
+    {
+        {
+            const std::lock_guard lock(m_mutex);
+            m_stop = true;
+        }
+        m_condition.notify_all();
+
+        for (std::thread& thread : m_threads)
+            thread.join();
+    }
+
+    Resolver(const Resolver&)            = delete;
+    Resolver& operator=(const Resolver&) = delete;
+
+    void resolve(std::string name, sf::Dns::ResolveCallback callback)
+    {
+        {
+            const std::lock_guard lock(m_mutex);
+
+            // Share the lookup already pending for this name, if any
+            std::vector<sf::Dns::ResolveCallback>& callbacks = m_pending[name];
+            callbacks.push_back(std::move(callback));
+            if (callbacks.size() > 1)
+                return;
+
+            m_queue.push_back(std::move(name));
+
+            // Start another thread if all the existing ones are busy
+            if ((m_idleThreads == 0) && (m_threads.size() < maxResolveThreads))
+                m_threads.emplace_back(&Resolver::run, this);
+        }
+        m_condition.notify_one();
+    }
+
+private:
+    void run()
+    {
+        std::unique_lock lock(m_mutex);
+
+        while (true)
+        {
+            ++m_idleThreads;
+            m_condition.wait(lock, [this] { return m_stop || !m_queue.empty(); });
+            --m_idleThreads;
+
+            // Requests still queued when the program exits are abandoned
+            if (m_stop)
+                return;
+
+            const std::string name = std::move(m_queue.front());
+            m_queue.pop_front();
+
+            lock.unlock();
+            const std::optional<sf::IpAddress> address = sf::IpAddress::resolve(name);
+            lock.lock();
+
+            const std::vector<sf::Dns::ResolveCallback> callbacks = std::move(m_pending[name]);
+            m_pending.erase(name);
+
+            lock.unlock();
+            for (const sf::Dns::ResolveCallback& callback : callbacks)
+                callback(address);
+            lock.lock();
+        }
+    }
+
+    std::mutex                                                             m_mutex;
+    std::condition_variable                                                m_condition;
+    std::vector<std::thread>                                               m_threads;
+    std::size_t                                                            m_idleThreads{};
+    bool                                                                   m_stop{};
+    std::deque<std::string>                                                m_queue;
+    std::unordered_map<std::string, std::vector<sf::Dns::ResolveCallback>> m_pending;
+};
+
+Resolver& getResolver()
+{
+    static Resolver resolver;
+    return resolver;
+}
+} // namespace
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+std::optional<IpAddress> resolveHostName(std::string_view name)
+{
+    const std::string key = normalize(name);
+    if (const std::optional<IpAddress> address = findCached(key))
+        return address;
+
+    // Only ask for the families that the computer can actually reach
+    addrinfo hints{}; // Zero-initialize
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_flags  = AI_ADDRCONFIG;
+
+    addrinfo* result = nullptr;
+    if (getaddrinfo(key.c_str(), nullptr, &hints, &result) != 0 || result == nullptr)
+    {
+        // Not generating en error message here as resolution failure is a valid outcome.
+        return std::nullopt;
+    }
+
+    // Prefer IPv4 addresses, which all the existing servers and networks handle
+    std::optional<IpAddress> address;
+    for (const addrinfo* info = result; info != nullptr; info = info->ai_next)
+    {
+        const std::optional<IpAddress> candidate = priv::SocketImpl::getIpAddress(*info->ai_addr);
+        if (candidate && (!address || (candidate->getType() == IpAddress::Type::IpV4)))
+            address = candidate;
+
+        if (address && (address->getType() == IpAddress::Type::IpV4))
+            break;
+    }
+
+    freeaddrinfo(result);
+
+    if (address)
+        insertCached(key, *address);
+
+    return address;
+}
+
+} // namespace sf::priv
+
+
+namespace sf::Dns
+{
+////////////////////////////////////////////////////////////
+std::future<std::optional<IpAddress>> resolveAsync(std::string_view address)
+{
+    auto promise = std::make_shared<std::promise<std::optional<IpAddress>>>();
+    auto future  = promise->get_future();
+
+    resolveAsync(address, [promise](std::optional<IpAddress> result) { promise->set_value(result); });
+    return future;
+}
+
+
+////////////////////////////////////////////////////////////
+void resolveAsync(std::string_view address, ResolveCallback callback)
+{
+    // Answer right away when no lookup is needed
+    if (isLiteralAddress(address))
+    {
+        callback(IpAddress::resolve(std::string(address)));
+        return;
+    }
+
+    std::string name = normalize(address);
+    if (const std::optional<IpAddress> cached = findCached(name))
+    {
+        callback(cached);
+        return;
+    }
+
+    getResolver().resolve(std::move(name), std::move(callback));
+}
+
+
+////////////////////////////////////////////////////////////
+void setCacheTimeToLive(Time timeToLive)
+{
+    Cache&                cache = getCache();
+    const std::lock_guard lock(cache.mutex);
+
+    cache.timeToLive = std::max(timeToLive, Time::Zero);
+    if (cache.timeToLive == Time::Zero)
+        cache.entries.clear();
+}
+
+
+////////////////////////////////////////////////////////////
+Time getCacheTimeToLive()
+{
+    Cache&                cache = getCache();
+    const std::lock_guard lock(cache.mutex);
+
+    return cache.timeToLive;
+}
+
+
+////////////////////////////////////////////////////////////
+void clearCache()
+{
+    Cache&                cache = getCache();
+    const std::lock_guard lock(cache.mutex);
+
+    cache.entries.clear();
+}
+
+
+////////////////////////////////////////////////////////////
+std::vector<CacheEntry> getCacheEntries()
+{
+    Cache&                cache = getCache();
+    const std::lock_guard lock(cache.mutex);
+
+    const Time              now = cache.clock.getElapsedTime();
+    std::vector<CacheEntry> entries;
+    for (const auto& [name, entry] : cache.entries)
+    {
+        if (entry.expiration > now)
+            entries.push_back({name, entry.address, entry.expiration - now});
+    }
+
+    std::sort(entries.begin(),
+              entries.end(),
+              [](const CacheEntry& left, const CacheEntry& right) { return left.name < right.name; });
+    return entries;
+}
+
+
+////////////////////////////////////////////////////////////
+void addHostEntry(std::string_view name, IpAddress address)
+{
+    Cache&                cache = getCache();
+    const std::lock_guard lock(cache.mutex);
+
+    cache.hosts.insert_or_assign(normalize(name), address);
+}
+
+
+////////////////////////////////////////////////////////////
+void clearHostEntries()
+{
+    Cache&                cache = getCache();
+    const std::lock_guard lock(cache.mutex);
+
+    cache.hosts.clear();
+}
+
+} // namespace sf::Dns
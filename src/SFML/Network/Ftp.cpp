@@ -27,21 +27,172 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Network/Ftp.hpp>
 #include <SFML/Network/IpAddress.hpp>
+#include <SFML/Network/SocketImpl.hpp>
 
+#include <SFML/System/Clock.hpp>
 #include <SFML/System/Err.hpp>
 
+#if defined(SFML_SYSTEM_LINUX) || defined(SFML_SYSTEM_ANDROID)
+#define SFML_FTP_SENDFILE
+#include <sys/sendfile.h>
+#endif
+
+#if !defined(SFML_SYSTEM_WINDOWS)
+#define SFML_FTP_FILE_DESCRIPTORS
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cerrno>
+#endif
+
 #include <algorithm>
 #include <array>
+#include <charconv>
 #include <fstream>
+#include <optional>
 #include <ostream>
 #include <sstream>
+#include <system_error>
 #include <utility>
+#include <vector>
 
 #include <cctype>
 #include <cstddef>
 #include <cstdint>
 
 
+namespace
+{
+////////////////////////////////////////////////////////////
+// Local file read or written by a data transfer, using the
+// file descriptors of the operating system when available
+// rather than a C++ stream and its extra copy
+////////////////////////////////////////////////////////////
+class TransferFile
+{
+public:
+    enum class Mode
+    {
+        Read,
+        Write
+    };
+
+    TransferFile(const std::filesystem::path& path, Mode mode)
+    {
+#if defined(SFML_FTP_FILE_DESCRIPTORS)
+        const int flags = (mode == Mode::Read) ? O_RDONLY : (O_WRONLY | O_CREAT | O_TRUNC);
+        m_descriptor    = ::open(path.c_str(), flags | O_CLOEXEC, 0644);
+#else
+        m_stream.open(path,
+                      (mode == Mode::Read) ? (std::ios_base::in | std::ios_base::binary)
+                                           : (std::ios_base::out | std::ios_base::binary | std::ios_base::trunc));
+#endif
+    }
+
+    ~TransferFile()
+    {
+#if defined(SFML_FTP_FILE_DESCRIPTORS)
+        if (m_descriptor != -1)
+            ::close(m_descriptor);
+#endif
+    }
+
+    TransferFile(const TransferFile&)            = delete;
+    TransferFile& operator=(const TransferFile&) = delete;
+
+    [[nodiscard]] bool isOpen() const
+    {
+#if defined(SFML_FTP_FILE_DESCRIPTORS)
+        return m_descriptor != -1;
+#else
+        return m_stream.is_open();
+#endif
+    }
+
+    // Return the number of bytes read, 0 at the end of the file, or nothing if reading failed
+    [[nodiscard]] std::optional<std::size_t> read(char* data, std::size_t size)
+    {
+#if defined(SFML_FTP_FILE_DESCRIPTORS)
+        while (true)
+        {
+            const auto count = ::read(m_descriptor, data, size);
+            if (count >= 0)
+                return static_cast<std::size_t>(count);
+
+            if (errno != EINTR)
+                return std::nullopt;
+        }
+#else
+        m_stream.read(data, static_cast<std::streamsize>(size));
+        if (m_stream.bad())
+            return std::nullopt;
+
+        return static_cast<std::size_t>(m_stream.gcount());
+#endif
+    }
+
+    [[nodiscard]] bool write(const char* data, std::size_t size)
+    {
+#if defined(SFML_FTP_FILE_DESCRIPTORS)
+        while (size > 0)
+        {
+            const auto count = ::write(m_descriptor, data, size);
+            if (count < 0)
+            {
+                if (errno == EINTR)
+                    continue;
+
+                return false;
+            }
+
+            data += count;
+            size -= static_cast<std::size_t>(count);
+        }
+
+        return true;
+#else
+        return static_cast<bool>(m_stream.write(data, static_cast<std::streamsize>(size)));
+#endif
+    }
+
+#if defined(SFML_FTP_FILE_DESCRIPTORS)
+    [[nodiscard]] int getDescriptor() const
+    {
+        return m_descriptor;
+    }
+#endif
+
+private:
+#if defined(SFML_FTP_FILE_DESCRIPTORS)
+    int m_descriptor{-1}; // File descriptor
+#else
+    std::fstream m_stream; // File stream
+#endif
+};
+
+
+////////////////////////////////////////////////////////////
+// Extract the size announced by a reply such as "150 Opening BINARY mode data connection for file (1234 bytes)"
+////////////////////////////////////////////////////////////
+std::uint64_t getAnnouncedSize(const std::string& message)
+{
+    const std::size_t end = message.rfind(" bytes)");
+    if (end == std::string::npos)
+        return 0;
+
+    const std::size_t begin = message.rfind('(', end);
+    if (begin == std::string::npos)
+        return 0;
+
+    std::uint64_t size = 0;
+    if (std::from_chars(message.data() + begin + 1, message.data() + end, size).ec != std::errc())
+        return 0;
+
+    return size;
+}
+} // namespace
+
+
 namespace sf
 {
 ////////////////////////////////////////////////////////////
@@ -67,17 +218,33 @@ public:
     Ftp::Response open(Ftp::TransferMode mode);
 
     ////////////////////////////////////////////////////////////
-    void send(std::istream& stream);
+    void send(TransferFile& file, std::uint64_t size);
 
     ////////////////////////////////////////////////////////////
     void receive(std::ostream& stream);
 
+    ////////////////////////////////////////////////////////////
+    void receive(TransferFile& file, std::uint64_t size);
+
 private:
+    ////////////////////////////////////////////////////////////
+    template <typename Writer>
+    void receiveData(Writer&& write);
+
+    ////////////////////////////////////////////////////////////
+    bool sendFile(TransferFile& file, std::uint64_t size);
+
+    ////////////////////////////////////////////////////////////
+    void reportProgress(std::uint64_t size);
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    Ftp&      m_ftp;        //!< Reference to the owner Ftp instance
-    TcpSocket m_dataSocket; //!< Socket used for data transfers
+    Ftp&              m_ftp;           //!< Reference to the owner Ftp instance
+    TcpSocket         m_dataSocket;    //!< Socket used for data transfers
+    std::vector<char> m_buffer;        //!< Buffer holding the data being transferred
+    Clock             m_clock;         //!< Time elapsed since the transfer started
+    std::uint64_t     m_transferred{}; //!< Number of bytes transferred so far
 };
 
 
@@ -299,15 +466,14 @@ Ftp::Response Ftp::download(const std::filesystem::path& remoteFile, const std::
         {
             // Create the file and truncate it if necessary
             const std::filesystem::path filepath = localPath / remoteFile.filename();
-            std::ofstream               file(filepath, std::ios_base::binary | std::ios_base::trunc);
-            if (!file)
-                return Response(Response::Status::InvalidFile);
-
-            // Receive the file data
-            data.receive(file);
+            {
+                TransferFile file(filepath, TransferFile::Mode::Write);
+                if (!file.isOpen())
+                    return Response(Response::Status::InvalidFile);
 
-            // Close the file
-            file.close();
+                // Receive the file data, using the size announced by the server (if any) to report progress
+                data.receive(file, getAnnouncedSize(response.getMessage()));
+            }
 
             // Get the response from the server
             response = getResponse();
@@ -329,8 +495,13 @@ Ftp::Response Ftp::upload(const std::filesystem::path& localFile,
                           bool                         append)
 {
     // Get the contents of the file to send
-    std::ifstream file(localFile, std::ios_base::binary);
-    if (!file)
+    TransferFile file(localFile, TransferFile::Mode::Read);
+    if (!file.isOpen())
+        return Response(Response::Status::InvalidFile);
+
+    std::error_code     error;
+    const std::uint64_t size = std::filesystem::file_size(localFile, error);
+    if (error)
         return Response(Response::Status::InvalidFile);
 
     // Open a data channel using the given transfer mode
@@ -343,7 +514,7 @@ Ftp::Response Ftp::upload(const std::filesystem::path& localFile,
         if (response.isOk())
         {
             // Send the file data
-            data.send(file);
+            data.send(file, size);
 
             // Get the response from the server
             response = getResponse();
@@ -354,6 +525,27 @@ Ftp::Response Ftp::upload(const std::filesystem::path& localFile,
 }
 
 
+////////////////////////////////////////////////////////////
+void Ftp::setTransferBufferSize(std::size_t size)
+{
+    m_transferBufferSize = std::max<std::size_t>(size, 1);
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t Ftp::getTransferBufferSize() const
+{
+    return m_transferBufferSize;
+}
+
+
+////////////////////////////////////////////////////////////
+void Ftp::setProgressCallback(ProgressCallback callback)
+{
+    m_progressCallback = std::move(callback);
+}
+
+
 ////////////////////////////////////////////////////////////
 Ftp::Response Ftp::sendCommand(const std::string& command, const std::string& parameter)
 {
@@ -584,14 +776,47 @@ Ftp::Response Ftp::DataChannel::open(Ftp::TransferMode mode)
 ////////////////////////////////////////////////////////////
 void Ftp::DataChannel::receive(std::ostream& stream)
 {
-    // Receive data
-    std::array<char, 1024> buffer{};
-    std::size_t            received = 0;
-    while (m_dataSocket.receive(buffer.data(), buffer.size(), received) == Socket::Status::Done)
-    {
-        stream.write(buffer.data(), static_cast<std::streamsize>(received));
+    receiveData(
+        [&stream](const char* data, std::size_t size)
+        {
+            stream.write(data, static_cast<std::streamsize>(size));
+            return stream.good();
+        });
+}
+
 
-        if (!stream.good())
+////////////////////////////////////////////////////////////
+void Ftp::DataChannel::receive(TransferFile& file, std::uint64_t size)
+{
+    receiveData(
+        [this, &file, size](const char* data, std::size_t count)
+        {
+            if (!file.write(data, count))
+                return false;
+
+            m_transferred += count;
+            reportProgress(size);
+            return true;
+        });
+
+    // Always let the caller know that the transfer is over, even if nothing was received
+    if (m_transferred == 0)
+        reportProgress(size);
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename Writer>
+void Ftp::DataChannel::receiveData(Writer&& write)
+{
+    // Receive data straight into the transfer buffer, and hand every block to the writer as is
+    m_buffer.resize(m_ftp.m_transferBufferSize);
+    m_clock.restart();
+
+    std::size_t received = 0;
+    while (m_dataSocket.receive(m_buffer.data(), m_buffer.size(), received) == Socket::Status::Done)
+    {
+        if (!write(m_buffer.data(), received))
         {
             err() << "FTP Error: Writing to the file has failed" << std::endl;
             break;
@@ -604,40 +829,110 @@ void Ftp::DataChannel::receive(std::ostream& stream)
 
 
 ////////////////////////////////////////////////////////////
-void Ftp::DataChannel::send(std::istream& stream)
+void Ftp::DataChannel::send(TransferFile& file, std::uint64_t size)
 {
-    // Send data
-    std::array<char, 1024> buffer{};
-    std::size_t            count = 0;
+    m_clock.restart();
 
-    for (;;)
+    // Let the kernel copy the file to the socket if it can, and fall back to a buffered copy otherwise
+    if (!sendFile(file, size))
     {
-        // read some data from the stream
-        stream.read(buffer.data(), buffer.size());
+        m_buffer.resize(m_ftp.m_transferBufferSize);
 
-        if (!stream.good() && !stream.eof())
+        for (;;)
         {
-            err() << "FTP Error: Reading from the file has failed" << std::endl;
-            break;
-        }
+            // Read some data from the file
+            const std::optional<std::size_t> count = file.read(m_buffer.data(), m_buffer.size());
+            if (!count.has_value())
+            {
+                err() << "FTP Error: Reading from the file has failed" << std::endl;
+                break;
+            }
 
-        count = static_cast<std::size_t>(stream.gcount());
+            // No more data: exit the loop
+            if (*count == 0)
+                break;
 
-        if (count > 0)
-        {
-            // we could read more data from the stream: send them
-            if (m_dataSocket.send(buffer.data(), count) != Socket::Status::Done)
+            // We could read more data from the file: send them
+            if (m_dataSocket.send(m_buffer.data(), *count) != Socket::Status::Done)
                 break;
-        }
-        else
-        {
-            // no more data: exit the loop
-            break;
+
+            m_transferred += *count;
+            reportProgress(size);
         }
     }
 
+    // Always let the caller know that the transfer is over, even for an empty file
+    if (m_transferred == 0)
+        reportProgress(size);
+
     // Close the data socket
     m_dataSocket.disconnect();
 }
 
+
+////////////////////////////////////////////////////////////
+bool Ftp::DataChannel::sendFile([[maybe_unused]] TransferFile& file, [[maybe_unused]] std::uint64_t size)
+{
+#if defined(SFML_FTP_SENDFILE)
+    using Counter = priv::SocketImpl::SocketAccess::Counter;
+
+    // Send the file in chunks of the transfer buffer size, so that progress can be reported regularly
+    const std::uint64_t bufferSize = m_ftp.m_transferBufferSize;
+    const SocketHandle  handle     = priv::SocketImpl::getNativeHandle(m_dataSocket);
+    off_t               offset     = 0;
+    while (m_transferred < size)
+    {
+        const auto    chunk = static_cast<std::size_t>(std::min(size - m_transferred, bufferSize));
+        const ssize_t sent  = ::sendfile(handle, file.getDescriptor(), &offset, chunk);
+
+        // The data bypasses the socket, keep its statistics up to date
+        priv::SocketImpl::countTraffic(m_dataSocket, Counter::SendCalls);
+        if (sent > 0)
+            priv::SocketImpl::countTraffic(m_dataSocket, Counter::BytesSent, static_cast<std::uint64_t>(sent));
+
+        if (sent < 0)
+        {
+            if (errno == EINTR)
+                continue;
+
+            // The file can't be sent by the kernel (e.g. it lives on a special file system): let the caller copy it
+            if ((m_transferred == 0) && ((errno == EINVAL) || (errno == ENOSYS)))
+                return false;
+
+            err() << "FTP Error: Sending the file has failed" << std::endl;
+            return true;
+        }
+
+        // The file was truncated while being sent
+        if (sent == 0)
+            return true;
+
+        m_transferred += static_cast<std::uint64_t>(sent);
+        reportProgress(size);
+    }
+
+    return true;
+#else
+    return false;
+#endif
+}
+
+
+////////////////////////////////////////////////////////////
+void Ftp::DataChannel::reportProgress(std::uint64_t size)
+{
+    if (!m_ftp.m_progressCallback)
+        return;
+
+    TransferProgress progress;
+    progress.transferredBytes = m_transferred;
+    progress.totalBytes       = size;
+    progress.elapsedTime      = m_clock.getElapsedTime();
+
+    const float seconds     = progress.elapsedTime.asSeconds();
+    progress.bytesPerSecond = (seconds > 0.f) ? static_cast<float>(m_transferred) / seconds : 0.f;
+
+    m_ftp.m_progressCallback(progress);
+}
+
 } // namespace sf
@@ -25,23 +25,227 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <SFML/Network/BufferedSockets.hpp>
 #include <SFML/Network/Http.hpp>
+#include <SFML/Network/SocketImpl.hpp>
+#include <SFML/Network/UdpSocket.hpp>
 
+#include <SFML/System/Clock.hpp>
 #include <SFML/System/Err.hpp>
 #include <SFML/System/Utils.hpp>
 
 #include <algorithm>
 #include <array>
+#include <charconv>
+#include <deque>
 #include <iterator>
 #include <limits>
 #include <ostream>
 #include <sstream>
+#include <string_view>
+#include <system_error>
+#include <thread>
 #include <utility>
 
 #include <cctype>
 #include <cstddef>
 
 
+namespace
+{
+////////////////////////////////////////////////////////////
+// Decodes the body of a response as it is received,
+// whichever way its end is delimited
+////////////////////////////////////////////////////////////
+class BodyDecoder
+{
+public:
+    // Determine how the body is delimited from the response header, without the empty line ending it
+    BodyDecoder(std::string_view header, bool headRequest)
+    {
+        // The status code follows the HTTP version
+        const std::size_t statusPos  = header.find(' ');
+        int               statusCode = 0;
+        if ((statusPos == std::string_view::npos) ||
+            (std::from_chars(header.data() + statusPos + 1, header.data() + header.size(), statusCode).ec !=
+             std::errc()))
+            return;
+
+        std::optional<std::size_t> contentLength;
+        bool                       chunked = false;
+        bool                       invalid = false;
+
+        for (std::size_t lineStart = header.find("\r\n"); lineStart != std::string_view::npos;)
+        {
+            lineStart += 2;
+            const std::size_t      lineEnd = header.find("\r\n", lineStart);
+            const std::string_view line    = header.substr(lineStart, lineEnd - lineStart);
+            lineStart                      = lineEnd;
+
+            const std::size_t colon = line.find(':');
+            if (colon == std::string_view::npos)
+                continue;
+
+            const std::string field = sf::toLower(std::string(line.substr(0, colon)));
+            std::string_view  value = line.substr(colon + 1);
+            while (!value.empty() && ((value.front() == ' ') || (value.front() == '\t')))
+                value.remove_prefix(1);
+            while (!value.empty() && ((value.back() == ' ') || (value.back() == '\t')))
+                value.remove_suffix(1);
+
+            if (field == "transfer-encoding")
+            {
+                const std::string encoding = sf::toLower(std::string(value));
+                chunked = (encoding.size() >= 7) && (encoding.compare(encoding.size() - 7, 7, "chunked") == 0);
+            }
+            else if (field == "content-length")
+            {
+                std::size_t length = 0;
+                if (std::from_chars(value.data(), value.data() + value.size(), length).ec != std::errc())
+                    invalid = true;
+                else
+                    contentLength = length;
+            }
+        }
+
+        m_interim = (statusCode >= 100) && (statusCode < 200);
+
+        if (headRequest || m_interim || (statusCode == 204) || (statusCode == 304))
+        {
+            m_state = State::Complete;
+        }
+        else if (chunked)
+        {
+            m_state = State::ChunkSize;
+        }
+        else if (contentLength.has_value() && !invalid)
+        {
+            m_state     = (*contentLength > 0) ? State::Length : State::Complete;
+            m_remaining = *contentLength;
+        }
+    }
+
+    // Tell whether the response is an interim (1xx) one
+    [[nodiscard]] bool isInterim() const
+    {
+        return m_interim;
+    }
+
+    // Tell whether the whole body was decoded
+    [[nodiscard]] bool isComplete() const
+    {
+        return m_state == State::Complete;
+    }
+
+    // Get the trailer fields which followed a chunked body
+    [[nodiscard]] const std::string& getTrailers() const
+    {
+        return m_trailers;
+    }
+
+    // Decode the body at the beginning of `data`, passing its content to `onData`
+    // Return the number of bytes consumed, or nothing if the body is malformed or `onData` stopped the transfer
+    [[nodiscard]] std::optional<std::size_t> decode(std::string_view data, const sf::Http::BodyCallback& onData)
+    {
+        // Lines are only consumed once complete, so their size must be bounded
+        constexpr std::size_t maxLineSize = 8192;
+
+        std::size_t position = 0;
+
+        while (m_state != State::Complete)
+        {
+            const std::string_view rest = data.substr(position);
+
+            if ((m_state == State::Length) || (m_state == State::ChunkData) || (m_state == State::UntilClose))
+            {
+                const std::size_t size = (m_state == State::UntilClose) ? rest.size()
+                                                                        : std::min(rest.size(), m_remaining);
+                if (size == 0)
+                    break;
+
+                if (onData && !onData(rest.data(), size))
+                    return std::nullopt;
+
+                position += size;
+
+                if (m_state != State::UntilClose)
+                {
+                    m_remaining -= size;
+                    if (m_remaining == 0)
+                        m_state = (m_state == State::Length) ? State::Complete : State::ChunkEnd;
+                }
+            }
+            else if (m_state == State::ChunkEnd)
+            {
+                if (rest.size() < 2)
+                    break;
+
+                if (rest.substr(0, 2) != "\r\n")
+                    return std::nullopt;
+
+                position += 2;
+                m_state = State::ChunkSize;
+            }
+            else
+            {
+                const std::size_t lineEnd = rest.find("\r\n");
+                if (lineEnd == std::string_view::npos)
+                {
+                    if (rest.size() > maxLineSize)
+                        return std::nullopt;
+
+                    break;
+                }
+
+                const std::string_view line = rest.substr(0, lineEnd);
+                position += lineEnd + 2;
+
+                if (m_state == State::ChunkSize)
+                {
+                    // The chunk size may be followed by extensions
+                    if (std::from_chars(line.data(), line.data() + line.size(), m_remaining, 16).ec != std::errc())
+                        return std::nullopt;
+
+                    m_state = (m_remaining > 0) ? State::ChunkData : State::Trailers;
+                }
+                else if (line.empty())
+                {
+                    m_state = State::Complete;
+                }
+                else
+                {
+                    if (m_trailers.size() + line.size() > maxLineSize)
+                        return std::nullopt;
+
+                    m_trailers.append(line);
+                    m_trailers += "\r\n";
+                }
+            }
+        }
+
+        return position;
+    }
+
+private:
+    enum class State
+    {
+        Length,     // The body size is given by Content-Length
+        ChunkSize,  // The line giving the size of the next chunk is expected
+        ChunkData,  // The data of a chunk is being received
+        ChunkEnd,   // The line break ending the data of a chunk is expected
+        Trailers,   // The trailer fields following the last chunk are expected
+        UntilClose, // The body ends when the connection is closed
+        Complete    // The whole body was received
+    };
+
+    State       m_state{State::UntilClose}; // What is expected next
+    std::size_t m_remaining{};              // Size of the body or chunk data left to receive
+    std::string m_trailers;                 // Trailer fields following a chunked body
+    bool        m_interim{};                // Whether the response is an interim one
+};
+} // namespace
+
+
 namespace sf
 {
 ////////////////////////////////////////////////////////////
@@ -242,7 +446,7 @@ void Http::Response::parse(const std::string& data)
         std::size_t length = 0;
 
         // Read all chunks, identified by a chunk-size not being 0
-        while (in >> std::hex >> length)
+        while ((in >> std::hex >> length) && (length > 0))
         {
             // Drop the rest of the line (chunk-extension)
             in.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
@@ -290,6 +494,667 @@ void Http::Response::parseFields(std::istream& in)
 }
 
 
+////////////////////////////////////////////////////////////
+struct Http::Connection
+{
+    ////////////////////////////////////////////////////////////
+    /// \brief Outcome of receiving a response
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class Result
+    {
+        Closed,      //!< The connection was closed before any of the response was received
+        Complete,    //!< The response was received, or the connection was closed while receiving it
+        Interrupted, //!< The response is malformed, or a callback stopped the transfer
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Receive the next response, streaming its body
+    ///
+    /// Only the data which can't be decoded yet is kept in
+    /// `pending`, so the memory used doesn't depend on the size
+    /// of the body.
+    ///
+    /// A blocking socket receives until the response is over.
+    /// A non-blocking socket returns as soon as no more data is
+    /// available, the function must then be called again once
+    /// the socket is ready to receive.
+    ///
+    /// \param headRequest `true` if the response answers a HEAD request, which has no body
+    /// \param response    Filled with the header and trailer fields of the response
+    /// \param onHeader    Function called once the header is received (may be empty)
+    /// \param onBody      Function called with each part of the body (may be empty)
+    ///
+    /// \return Outcome of the transfer, or nothing if the response isn't over yet
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<Result> receiveResponse(bool                  headRequest,
+                                                        Response&             response,
+                                                        const HeaderCallback& onHeader,
+                                                        const BodyCallback&   onBody)
+    {
+        while (true)
+        {
+            if (const std::optional<Result> result = processResponse(headRequest, response, onHeader, onBody))
+                return result;
+
+            // When the HTTPS connection makes use of TLS 1.3 new session ticket
+            // messages can be received by the client from the server at any time
+            // When these messages are received the receive function will return Socket::Status::Partial
+            // In this case We just continue to call receive until actual payload
+            // data is available, the connection is closed or an error occurs
+            std::size_t          received = 0;
+            const Socket::Status status   = socket.receive(buffer.data(), buffer.size(), received);
+
+            if (status == Socket::Status::Done)
+            {
+                pending.append(buffer.data(), received);
+                continue;
+            }
+
+            if (status == Socket::Status::Partial)
+                continue;
+
+            if (status == Socket::Status::NotReady)
+                return std::nullopt;
+
+            // The connection was closed: bodies without framing end here, others are truncated
+            closed = true;
+
+            if (!started)
+                return Result::Closed;
+
+            if (!decoder.has_value())
+                response.parse(pending);
+
+            pending.clear();
+            return finish(Result::Complete);
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Process the data received so far
+    ///
+    /// \param headRequest `true` if the response answers a HEAD request, which has no body
+    /// \param response    Filled with the header and trailer fields of the response
+    /// \param onHeader    Function called once the header is received (may be empty)
+    /// \param onBody      Function called with each part of the body (may be empty)
+    ///
+    /// \return Outcome of the transfer, or nothing if more data is needed
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<Result> processResponse(bool                  headRequest,
+                                                        Response&             response,
+                                                        const HeaderCallback& onHeader,
+                                                        const BodyCallback&   onBody)
+    {
+        started = started || !pending.empty();
+
+        while (!decoder.has_value())
+        {
+            const std::size_t headerEnd = pending.find("\r\n\r\n");
+            if (headerEnd == std::string::npos)
+                return std::nullopt;
+
+            decoder.emplace(std::string_view(pending).substr(0, headerEnd), headRequest);
+
+            // Interim responses such as "100 Continue" are followed by the actual response
+            if (decoder->isInterim())
+            {
+                pending.erase(0, headerEnd + 4);
+                decoder.reset();
+                continue;
+            }
+
+            response.parse(pending.substr(0, headerEnd + 4));
+            pending.erase(0, headerEnd + 4);
+
+            if (onHeader && !onHeader(response))
+                return finish(Result::Interrupted);
+        }
+
+        const std::optional<std::size_t> consumed = decoder->decode(pending, onBody);
+        if (!consumed.has_value())
+            return finish(Result::Interrupted);
+
+        pending.erase(0, *consumed);
+
+        if (!decoder->isComplete())
+            return std::nullopt;
+
+        std::istringstream trailers(decoder->getTrailers());
+        response.parseFields(trailers);
+        return finish(Result::Complete);
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get ready for the next response
+    ///
+    /// \param result Outcome of the response which is over
+    ///
+    /// \return `result`
+    ///
+    ////////////////////////////////////////////////////////////
+    Result finish(Result result)
+    {
+        decoder.reset();
+        started = false;
+        return result;
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the connection may serve other requests
+    ///
+    /// \param request  Request which was last sent
+    /// \param response Response to this request
+    ///
+    /// \return `true` if the connection is persistent
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isPersistent(const Request& request, const Response& response) const
+    {
+        if (closed || (response.getStatus() == Response::Status::InvalidResponse))
+            return false;
+
+        if (const auto it = request.m_fields.find("connection");
+            (it != request.m_fields.end()) && (toLower(it->second) == "close"))
+            return false;
+
+        // HTTP/1.1 connections are persistent unless closed explicitly, HTTP/1.0 ones only on request
+        const std::string connection = toLower(response.getField("connection"));
+        if (connection == "close")
+            return false;
+
+        return (response.getMajorHttpVersion() * 10 + response.getMinorHttpVersion() >= 11) ||
+               (connection == "keep-alive");
+    }
+
+    TcpSocket                  socket;     //!< Socket connected to the host
+    std::array<char, 65536>    buffer{};   //!< Buffer receiving data from the socket
+    std::string                pending;    //!< Data received but not processed yet
+    std::optional<BodyDecoder> decoder;    //!< Decoder of the body being received, once the header is received
+    bool                       started{};  //!< Whether any of the response being received was received
+    bool                       verified{}; //!< Whether the server was verified
+    bool                       reused{};   //!< Whether the connection was kept alive from a previous request
+    bool                       closed{};   //!< Whether the server closed the connection
+};
+
+
+////////////////////////////////////////////////////////////
+struct Http::AsyncLoop
+{
+    ////////////////////////////////////////////////////////////
+    /// \brief Asynchronous request and its progress
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Transfer
+    {
+        enum class Stage
+        {
+            Queued,      //!< Waiting for a connection to be available
+            Connecting,  //!< Waiting for the connection to the host to be established
+            Handshaking, //!< Performing the TLS handshake
+            Sending,     //!< Sending the request
+            Receiving    //!< Receiving the response
+        };
+
+        Request                     request;        //!< Request to send, with all the mandatory fields
+        std::string                 data;           //!< Prepared request
+        std::size_t                 sent{};         //!< Size of the data already sent
+        CompletionCallback          onComplete;     //!< Function called with the response
+        Clock                       clock;          //!< Time elapsed since the request was submitted
+        Time                        timeout;        //!< Maximum time the request may take
+        bool                        verifyServer{}; //!< Verify the server if using HTTPS
+        bool                        keepAlive{};    //!< Keep the connection alive once the response is received
+        bool                        retried{};      //!< Whether the request was sent again on a new connection
+        Stage                       stage{};        //!< Current stage of the transfer
+        std::unique_ptr<Connection> connection;     //!< Connection used by the transfer
+        Response                    response;       //!< Response received so far
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start the thread driving the asynchronous requests
+    ///
+    /// \param owner HTTP client the requests are sent by
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit AsyncLoop(const Http& owner) : http(owner)
+    {
+        // A datagram sent to ourselves interrupts the wait for network activity when a request is submitted
+        wakeable = wakeReceiver.bind(Socket::AnyPort, IpAddress::LocalHost) == Socket::Status::Done;
+        wakeReceiver.setBlocking(false);
+
+        thread = std::thread([this] { run(); });
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Complete the pending requests and stop the thread
+    ///
+    ////////////////////////////////////////////////////////////
+    ~AsyncLoop()
+    {
+        {
+            const std::lock_guard lock(mutex);
+            stop = true;
+            wake();
+        }
+
+        thread.join();
+    }
+
+    AsyncLoop(const AsyncLoop&)            = delete;
+    AsyncLoop& operator=(const AsyncLoop&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add a request to the ones driven by the loop
+    ///
+    /// \param transfer Request to send
+    ///
+    ////////////////////////////////////////////////////////////
+    void submit(Transfer&& transfer)
+    {
+        const std::lock_guard lock(mutex);
+        queue.push_back(std::move(transfer));
+        wake();
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Make the loop take changed settings into account
+    ///
+    ////////////////////////////////////////////////////////////
+    void notify()
+    {
+        const std::lock_guard lock(mutex);
+        wake();
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Interrupt the wait for network activity
+    ///
+    /// The mutex must be locked.
+    ///
+    ////////////////////////////////////////////////////////////
+    void wake()
+    {
+        if (!wakeable)
+            return;
+
+        const char signal = 0;
+        (void)wakeSender.send(&signal, 1, IpAddress::LocalHost, wakeReceiver.getLocalPort());
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Drive the requests until the loop is stopped
+    ///
+    ////////////////////////////////////////////////////////////
+    void run()
+    {
+        std::vector<Transfer>     active;
+        std::vector<Transfer>     done;
+        std::vector<SocketHandle> bufferedHandles;
+
+        // The wake up socket comes first, followed by the sockets of the active transfers in the same order
+        const std::size_t first = wakeable ? 1 : 0;
+        descriptors.resize(first);
+        if (wakeable)
+        {
+            descriptors[0].fd     = priv::SocketImpl::getNativeHandle(wakeReceiver);
+            descriptors[0].events = POLLIN;
+        }
+
+        while (true)
+        {
+            std::size_t maxConnections = 1;
+            {
+                const std::lock_guard lock(http.m_connectionMutex);
+                maxConnections = http.m_maxConnections;
+            }
+
+            // Requests waiting for a connection may run out of time too
+            Time nextTimeout = Time::Zero;
+            bool stopping    = false;
+            {
+                const std::lock_guard lock(mutex);
+                stopping = stop;
+
+                for (auto it = queue.begin(); it != queue.end();)
+                {
+                    if (stopping || hasExpired(*it))
+                    {
+                        (void)fail(*it);
+                        done.push_back(std::move(*it));
+                        it = queue.erase(it);
+                    }
+                    else if (active.size() < maxConnections)
+                    {
+                        active.push_back(std::move(*it));
+                        it = queue.erase(it);
+                    }
+                    else
+                    {
+                        nextTimeout = earliest(nextTimeout, getRemainingTime(*it));
+                        ++it;
+                    }
+                }
+            }
+
+            for (auto it = active.begin(); it != active.end();)
+            {
+                const bool connected = (it->stage != Transfer::Stage::Queued) || connect(*it, true);
+
+                if (!connected || stopping || hasExpired(*it))
+                {
+                    (void)fail(*it);
+                    done.push_back(std::move(*it));
+                    it = active.erase(it);
+                    continue;
+                }
+
+                nextTimeout = earliest(nextTimeout, getRemainingTime(*it));
+                ++it;
+            }
+
+            for (Transfer& transfer : done)
+                complete(transfer);
+
+            done.clear();
+
+            if (stopping)
+                return;
+
+            // Without the wake up socket, submitted requests are only noticed by waking up regularly
+            if (!wakeable)
+                nextTimeout = earliest(nextTimeout, milliseconds(10));
+
+            // Connections being established and requests being sent wait for the socket to be writable,
+            // handshakes and responses wait for data from the server
+            descriptors.resize(first + active.size());
+            for (std::size_t i = 0; i < active.size(); ++i)
+            {
+                const bool writing = (active[i].stage == Transfer::Stage::Connecting) ||
+                                     (active[i].stage == Transfer::Stage::Sending);
+
+                descriptors[first + i].fd     = priv::SocketImpl::getNativeHandle(active[i].connection->socket);
+                descriptors[first + i].events = writing ? POLLOUT : POLLIN;
+            }
+
+            for (auto& descriptor : descriptors)
+                descriptor.revents = 0;
+
+            // Sockets holding data they already read from the system (e.g. TLS records) are ready anyway
+            priv::getBufferedSockets(bufferedHandles);
+            const auto isBuffered = [&bufferedHandles](SocketHandle handle)
+            { return std::find(bufferedHandles.begin(), bufferedHandles.end(), handle) != bufferedHandles.end(); };
+
+            const bool buffered = std::any_of(descriptors.begin() + static_cast<std::ptrdiff_t>(first),
+                                              descriptors.end(),
+                                              [&isBuffered](const auto& descriptor)
+                                              { return isBuffered(descriptor.fd); });
+
+            const int timeout = buffered ? 0 : priv::SocketImpl::getPollTimeout(nextTimeout);
+            if ((priv::SocketImpl::poll(descriptors.data(), descriptors.size(), timeout) > 0) && wakeable &&
+                (descriptors[0].revents != 0))
+            {
+                // Drain the wake up signals
+                std::array<char, 64>     signals{};
+                std::size_t              received = 0;
+                std::optional<IpAddress> sender;
+                unsigned short           senderPort = 0;
+                Socket::Status           status     = Socket::Status::Done;
+                while (status == Socket::Status::Done)
+                    status = wakeReceiver.receive(signals.data(), signals.size(), received, sender, senderPort);
+            }
+
+            std::size_t index = first;
+            for (auto it = active.begin(); it != active.end(); ++index)
+            {
+                const auto& descriptor = descriptors[index];
+                const bool  ready      = (descriptor.revents != 0) || isBuffered(descriptor.fd);
+
+                if (update(*it, ready))
+                {
+                    done.push_back(std::move(*it));
+                    it = active.erase(it);
+                }
+                else
+                {
+                    ++it;
+                }
+            }
+
+            for (Transfer& transfer : done)
+                complete(transfer);
+
+            done.clear();
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a connection for a transfer and start sending its request
+    ///
+    /// \param transfer Transfer which needs a connection
+    /// \param reuse    `true` to use an idle connection if one is available
+    ///
+    /// \return `false` if connecting to the host failed
+    ///
+    ////////////////////////////////////////////////////////////
+    bool connect(Transfer& transfer, bool reuse)
+    {
+        transfer.sent = 0;
+        transfer.connection.reset();
+
+        if (reuse)
+            transfer.connection = http.takeIdleConnection(transfer.verifyServer);
+
+        if (transfer.connection)
+        {
+            transfer.connection->socket.setBlocking(false);
+            transfer.stage = Transfer::Stage::Sending;
+            return true;
+        }
+
+        if (!http.m_host.has_value())
+            return false;
+
+        auto connection = std::make_unique<Connection>();
+        connection->socket.setBlocking(false);
+        connection->verified = !http.m_https || transfer.verifyServer;
+
+        const Socket::Status status = connection->socket.connect(http.m_host.value(), http.m_port);
+        if ((status != Socket::Status::Done) && (status != Socket::Status::NotReady))
+            return false;
+
+        transfer.connection = std::move(connection);
+        transfer.stage      = Transfer::Stage::Connecting;
+        return true;
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Make a transfer progress as far as possible without blocking
+    ///
+    /// \param transfer Transfer to update
+    /// \param ready    Whether its socket is ready for what its current stage waits for
+    ///
+    /// \return `true` if the transfer is over
+    ///
+    ////////////////////////////////////////////////////////////
+    bool update(Transfer& transfer, bool ready)
+    {
+        Connection& connection = *transfer.connection;
+
+        if (transfer.stage == Transfer::Stage::Connecting)
+        {
+            // A connection attempt which fails makes the socket ready, a successful one gives it a peer
+            if (connection.socket.getRemotePort() == 0)
+                return ready && fail(transfer);
+
+            transfer.stage = http.m_https ? Transfer::Stage::Handshaking : Transfer::Stage::Sending;
+        }
+
+        if (transfer.stage == Transfer::Stage::Handshaking)
+        {
+            const TcpSocket::TlsStatus status = connection.socket.setupTlsClient(http.m_hostName,
+                                                                                 transfer.verifyServer);
+
+            if (status == TcpSocket::TlsStatus::HandshakeStarted)
+                return false;
+
+            if (status != TcpSocket::TlsStatus::HandshakeComplete)
+                return fail(transfer);
+
+            transfer.stage = Transfer::Stage::Sending;
+        }
+
+        if (transfer.stage == Transfer::Stage::Sending)
+        {
+            std::size_t          sent   = 0;
+            const Socket::Status status = connection.socket.send(transfer.data.data() + transfer.sent,
+                                                                 transfer.data.size() - transfer.sent,
+                                                                 sent);
+            transfer.sent += sent;
+
+            if ((status == Socket::Status::NotReady) || (status == Socket::Status::Partial))
+                return false;
+
+            if (status != Socket::Status::Done)
+                return retry(transfer);
+
+            transfer.stage = Transfer::Stage::Receiving;
+            ready          = true;
+        }
+
+        if (!ready)
+            return false;
+
+        Response&  response    = transfer.response;
+        const bool headRequest = transfer.request.m_method == Request::Method::Head;
+        const auto onBody      = [&response](const void* body, std::size_t size)
+        {
+            response.m_body.append(static_cast<const char*>(body), size);
+            return true;
+        };
+
+        const auto result = connection.receiveResponse(headRequest, response, nullptr, onBody);
+        if (!result.has_value())
+            return false;
+
+        if (*result == Connection::Result::Closed)
+            return retry(transfer);
+
+        if ((*result == Connection::Result::Complete) && transfer.keepAlive &&
+            connection.isPersistent(transfer.request, response) && connection.pending.empty())
+        {
+            connection.socket.setBlocking(true);
+            http.releaseConnection(std::move(transfer.connection));
+        }
+
+        return true;
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Send a request again on a new connection if its idle connection was closed by the server
+    ///
+    /// \param transfer Transfer whose connection was closed before it got a response
+    ///
+    /// \return `true` if the transfer is over
+    ///
+    ////////////////////////////////////////////////////////////
+    bool retry(Transfer& transfer)
+    {
+        if (!transfer.connection->reused || transfer.retried)
+            return fail(transfer);
+
+        transfer.retried = true;
+        transfer.connection->socket.disconnect();
+
+        return !connect(transfer, false) && fail(transfer);
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief End a transfer without a response
+    ///
+    /// The transfer may have run out of time, failed to connect
+    /// or still be pending when the loop stops.
+    ///
+    /// \param transfer Transfer which failed
+    ///
+    /// \return `true`
+    ///
+    ////////////////////////////////////////////////////////////
+    static bool fail(Transfer& transfer)
+    {
+        transfer.response = Response();
+        return true;
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Close the connection of a transfer which is over and pass its response on
+    ///
+    /// \param transfer Transfer which is over
+    ///
+    ////////////////////////////////////////////////////////////
+    static void complete(Transfer& transfer)
+    {
+        // Connections which were kept alive were already given back to the HTTP client
+        if (transfer.connection)
+            transfer.connection->socket.disconnect();
+
+        if (transfer.onComplete)
+            transfer.onComplete(std::move(transfer.response));
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether a transfer ran out of time
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool hasExpired(const Transfer& transfer)
+    {
+        return (transfer.timeout > Time::Zero) && (transfer.clock.getElapsedTime() >= transfer.timeout);
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the time a transfer has left, `Time::Zero` if it has no limit
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static Time getRemainingTime(const Transfer& transfer)
+    {
+        if (transfer.timeout <= Time::Zero)
+            return Time::Zero;
+
+        return std::max(transfer.timeout - transfer.clock.getElapsedTime(), microseconds(1));
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the earliest of two timeouts, `Time::Zero` meaning none
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static Time earliest(Time left, Time right)
+    {
+        if (left == Time::Zero)
+            return right;
+
+        if (right == Time::Zero)
+            return left;
+
+        return std::min(left, right);
+    }
+
+    const Http&                                   http;         //!< HTTP client the requests are sent by
+    std::mutex                                    mutex;        //!< Protects the queue and the stop flag
+    std::deque<Transfer>                          queue;        //!< Requests which haven't been started yet
+    bool                                          stop{};       //!< Whether the loop must stop
+    UdpSocket                                     wakeReceiver; //!< Socket interrupting the wait for network activity
+    UdpSocket                                     wakeSender;   //!< Socket sending the wake up signals
+    bool                                          wakeable{};   //!< Whether the wait for activity can be interrupted
+    std::vector<priv::SocketImpl::PollDescriptor> descriptors;  //!< Sockets watched by the loop, wake up socket first
+    std::thread                                   thread;       //!< Thread running the loop
+};
+
+
+////////////////////////////////////////////////////////////
+Http::Http() = default;
+
+
 ////////////////////////////////////////////////////////////
 Http::Http(const std::string& host, unsigned short port)
 {
@@ -300,6 +1165,9 @@ Http::Http(const std::string& host, unsigned short port)
 ////////////////////////////////////////////////////////////
 bool Http::setHost(const std::string& host, unsigned short port)
 {
+    // Connections kept alive lead to the previous host
+    closeIdleConnections();
+
     // Check the protocol
     if (toLower(host.substr(0, 7)) == "http://")
     {
@@ -330,10 +1198,242 @@ bool Http::setHost(const std::string& host, unsigned short port)
 }
 
 
+////////////////////////////////////////////////////////////
+Http::~Http() = default;
+
+
+////////////////////////////////////////////////////////////
+void Http::setKeepAlive(bool keepAlive)
+{
+    m_keepAlive = keepAlive;
+
+    if (!m_keepAlive)
+        closeIdleConnections();
+}
+
+
+////////////////////////////////////////////////////////////
+bool Http::isKeepAliveEnabled() const
+{
+    return m_keepAlive;
+}
+
+
+////////////////////////////////////////////////////////////
+void Http::setMaxIdleConnections(std::size_t count)
+{
+    const std::lock_guard lock(m_connectionMutex);
+
+    m_maxIdleConnections = count;
+    if (m_idleConnections.size() > m_maxIdleConnections)
+        m_idleConnections.resize(m_maxIdleConnections);
+}
+
+
+////////////////////////////////////////////////////////////
+void Http::setMaxConnections(std::size_t count)
+{
+    const std::lock_guard lock(m_connectionMutex);
+
+    m_maxConnections = std::max<std::size_t>(count, 1);
+
+    // Let queued requests use the connections which became available
+    if (m_asyncLoop)
+        m_asyncLoop->notify();
+}
+
+
 ////////////////////////////////////////////////////////////
 Http::Response Http::sendRequest(const Http::Request& request, Time timeout, bool verifyServer) const
 {
-    // First make sure that the request is valid -- add missing mandatory fields
+    std::string body;
+    Response    response = sendRequest(
+        request,
+        nullptr,
+        [&body](const void* data, std::size_t size)
+        {
+            body.append(static_cast<const char*>(data), size);
+            return true;
+        },
+        timeout,
+        verifyServer);
+
+    response.m_body += body;
+    return response;
+}
+
+
+////////////////////////////////////////////////////////////
+Http::Response Http::sendRequest(const Request&        request,
+                                 const HeaderCallback& onHeader,
+                                 const BodyCallback&   onBody,
+                                 Time                  timeout,
+                                 bool                  verifyServer) const
+{
+    const Request     toSend = completeRequest(request, m_keepAlive);
+    const std::string data   = toSend.prepare();
+    Response          response;
+
+    for (bool retried = false;; retried = true)
+    {
+        auto connection = acquireConnection(timeout, verifyServer);
+        if (!connection)
+            break;
+
+        auto result = Connection::Result::Closed;
+        if (connection->socket.send(data.data(), data.size()) == Socket::Status::Done)
+            result = connection->receiveResponse(toSend.m_method == Request::Method::Head, response, onHeader, onBody)
+                         .value_or(Connection::Result::Interrupted);
+
+        const bool reused = connection->reused;
+
+        if ((result == Connection::Result::Complete) && m_keepAlive && connection->isPersistent(toSend, response) &&
+            connection->pending.empty())
+            releaseConnection(std::move(connection));
+        else
+            connection->socket.disconnect();
+
+        // An idle connection may have been closed by the server in the meantime,
+        // in which case the request is sent again once on a new connection
+        if ((result != Connection::Result::Closed) || !reused || retried)
+            break;
+    }
+
+    return response;
+}
+
+
+////////////////////////////////////////////////////////////
+Http::Response Http::sendRequest(const Request& request, std::ostream& body, Time timeout, bool verifyServer) const
+{
+    return sendRequest(
+        request,
+        nullptr,
+        [&body](const void* data, std::size_t size)
+        { return static_cast<bool>(body.write(static_cast<const char*>(data), static_cast<std::streamsize>(size))); },
+        timeout,
+        verifyServer);
+}
+
+
+////////////////////////////////////////////////////////////
+std::vector<Http::Response> Http::sendRequests(const std::vector<Request>& requests,
+                                               Time                        timeout,
+                                               bool                        verifyServer) const
+{
+    // Pipelined requests keep the connection alive for the ones following them
+    std::vector<Request> toSend;
+    toSend.reserve(requests.size());
+    for (std::size_t i = 0; i < requests.size(); ++i)
+        toSend.push_back(completeRequest(requests[i], m_keepAlive || (i + 1 < requests.size())));
+
+    std::vector<Response> responses(requests.size());
+    std::size_t           answered = 0;
+    bool                  retried  = false;
+
+    while (answered < toSend.size())
+    {
+        auto connection = acquireConnection(timeout, verifyServer);
+        if (!connection)
+            break;
+
+        // Send all the requests which haven't been answered yet at once
+        std::string data;
+        for (std::size_t i = answered; i < toSend.size(); ++i)
+            data += toSend[i].prepare();
+
+        const std::size_t answeredBefore = answered;
+        bool              persistent     = connection->socket.send(data.data(), data.size()) == Socket::Status::Done;
+
+        // Responses come back in the order of the requests
+        while (persistent && (answered < toSend.size()))
+        {
+            Response&  response    = responses[answered];
+            const bool headRequest = toSend[answered].m_method == Request::Method::Head;
+            const auto onBody      = [&response](const void* body, std::size_t size)
+            {
+                response.m_body.append(static_cast<const char*>(body), size);
+                return true;
+            };
+
+            const auto result = connection->receiveResponse(headRequest, response, nullptr, onBody)
+                                    .value_or(Connection::Result::Interrupted);
+            if (result == Connection::Result::Closed)
+                break;
+
+            persistent = (result == Connection::Result::Complete) &&
+                         connection->isPersistent(toSend[answered], response);
+            ++answered;
+        }
+
+        const bool reused = connection->reused;
+
+        if (persistent && m_keepAlive && (answered == toSend.size()) && connection->pending.empty())
+            releaseConnection(std::move(connection));
+        else
+            connection->socket.disconnect();
+
+        // An idle connection may have been closed by the server in the meantime,
+        // in which case the requests are sent again once on a new connection
+        if (answered == answeredBefore)
+        {
+            if (!reused || retried)
+                break;
+
+            retried = true;
+        }
+    }
+
+    return responses;
+}
+
+
+////////////////////////////////////////////////////////////
+std::future<Http::Response> Http::sendRequestAsync(const Request& request, Time timeout, bool verifyServer) const
+{
+    // std::function must be copyable, unlike std::promise
+    auto promise = std::make_shared<std::promise<Response>>();
+    auto future  = promise->get_future();
+
+    sendRequestAsync(
+        request,
+        [promise](Response response) { promise->set_value(std::move(response)); },
+        timeout,
+        verifyServer);
+
+    return future;
+}
+
+
+////////////////////////////////////////////////////////////
+void Http::sendRequestAsync(const Request&     request,
+                            CompletionCallback onComplete,
+                            Time               timeout,
+                            bool               verifyServer) const
+{
+    AsyncLoop::Transfer transfer;
+    transfer.request      = completeRequest(request, m_keepAlive);
+    transfer.data         = transfer.request.prepare();
+    transfer.onComplete   = std::move(onComplete);
+    transfer.timeout      = timeout;
+    transfer.verifyServer = verifyServer;
+    transfer.keepAlive    = m_keepAlive;
+
+    {
+        const std::lock_guard lock(m_connectionMutex);
+
+        if (!m_asyncLoop)
+            m_asyncLoop = std::make_unique<AsyncLoop>(*this);
+    }
+
+    m_asyncLoop->submit(std::move(transfer));
+}
+
+
+////////////////////////////////////////////////////////////
+Http::Request Http::completeRequest(const Request& request, bool keepAlive) const
+{
+    // Make sure that the request is valid -- add missing mandatory fields
     Request toSend(request);
     if (!toSend.hasField("From"))
     {
@@ -357,60 +1457,79 @@ Http::Response Http::sendRequest(const Http::Request& request, Time timeout, boo
     {
         toSend.setField("Content-Type", "application/x-www-form-urlencoded");
     }
+    if (keepAlive && !toSend.hasField("Connection"))
+    {
+        toSend.setField("Connection", "keep-alive");
+    }
     if ((toSend.m_majorVersion * 10 + toSend.m_minorVersion >= 11) && !toSend.hasField("Connection"))
     {
         toSend.setField("Connection", "close");
     }
 
-    // Prepare the response
-    Response received;
+    return toSend;
+}
 
-    TcpSocket connection;
-    // Connect the socket to the host
-    if (m_host.has_value() && connection.connect(m_host.value(), m_port, timeout) == Socket::Status::Done)
-    {
-        if (m_https && (connection.setupTlsClient(m_hostName, verifyServer) != sf::TcpSocket::TlsStatus::HandshakeComplete))
-            return received;
 
-        // Convert the request to string and send it through the connected socket
-        const std::string requestStr = toSend.prepare();
+////////////////////////////////////////////////////////////
+std::unique_ptr<Http::Connection> Http::acquireConnection(Time timeout, bool verifyServer) const
+{
+    if (auto connection = takeIdleConnection(verifyServer))
+        return connection;
 
-        if (!requestStr.empty())
-        {
-            // Send it through the socket
-            if (connection.send(requestStr.c_str(), requestStr.size()) == Socket::Status::Done)
-            {
-                // Wait for the server's response
-                std::string            receivedStr;
-                std::size_t            size = 0;
-                std::array<char, 1024> buffer{};
-
-                // When the HTTPS connection makes use of TLS 1.3 new session ticket
-                // messages can be received by the client from the server at any time
-                // When these messages are received the receive function will return Socket::Status::Partial
-                // In this case We just continue to call receive until actual payload
-                // data is available, the connection is closed or an error occurs
-                auto result = connection.receive(buffer.data(), buffer.size(), size);
-
-                while ((result == Socket::Status::Done) || (result == Socket::Status::Partial))
-                {
-                    // Only append payload data when it has been completely received
-                    if (result == Socket::Status::Done)
-                        receivedStr.append(buffer.data(), buffer.data() + size);
+    if (!m_host.has_value())
+        return nullptr;
 
-                    result = connection.receive(buffer.data(), buffer.size(), size);
-                }
+    auto connection = std::make_unique<Connection>();
 
-                // Build the Response object from the received data
-                received.parse(receivedStr);
-            }
-        }
+    if (connection->socket.connect(m_host.value(), m_port, timeout) != Socket::Status::Done)
+        return nullptr;
 
-        // Close the connection
-        connection.disconnect();
-    }
+    if (m_https &&
+        (connection->socket.setupTlsClient(m_hostName, verifyServer) != TcpSocket::TlsStatus::HandshakeComplete))
+        return nullptr;
+
+    connection->verified = !m_https || verifyServer;
+    return connection;
+}
 
-    return received;
+
+////////////////////////////////////////////////////////////
+std::unique_ptr<Http::Connection> Http::takeIdleConnection(bool verifyServer) const
+{
+    const std::lock_guard lock(m_connectionMutex);
+
+    // Take the most recently used connection, which is the least likely to have been closed by the server
+    // A connection to an unverified server must not serve a request which requires verification
+    const auto it = std::find_if(m_idleConnections.rbegin(),
+                                 m_idleConnections.rend(),
+                                 [verifyServer](const auto& connection)
+                                 { return connection->verified || !verifyServer; });
+
+    if (it == m_idleConnections.rend())
+        return nullptr;
+
+    auto connection = std::move(*it);
+    m_idleConnections.erase(std::next(it).base());
+    connection->reused = true;
+    return connection;
+}
+
+
+////////////////////////////////////////////////////////////
+void Http::releaseConnection(std::unique_ptr<Connection> connection) const
+{
+    const std::lock_guard lock(m_connectionMutex);
+
+    if (m_idleConnections.size() < m_maxIdleConnections)
+        m_idleConnections.push_back(std::move(connection));
+}
+
+
+////////////////////////////////////////////////////////////
+void Http::closeIdleConnections()
+{
+    const std::lock_guard lock(m_connectionMutex);
+    m_idleConnections.clear();
 }
 
 } // namespace sf
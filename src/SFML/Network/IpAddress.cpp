@@ -25,6 +25,7 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <SFML/Network/DnsImpl.hpp>
 #include <SFML/Network/Http.hpp>
 #include <SFML/Network/IpAddress.hpp>
 #include <SFML/Network/SocketImpl.hpp>
@@ -43,6 +44,8 @@ namespace sf
 const IpAddress IpAddress::Any(0, 0, 0, 0);
 const IpAddress IpAddress::LocalHost(127, 0, 0, 1);
 const IpAddress IpAddress::Broadcast(255, 255, 255, 255);
+const IpAddress IpAddress::AnyV6(std::array<std::uint8_t, 16>{});
+const IpAddress IpAddress::LocalHostV6(std::array<std::uint8_t, 16>{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1});
 
 
 ////////////////////////////////////////////////////////////
@@ -70,24 +73,27 @@ std::optional<IpAddress> IpAddress::resolve(std::string_view address)
     if (const std::uint32_t ip = inet_addr(address.data()); ip != INADDR_NONE)
         return IpAddress(ntohl(ip));
 
-    // Not a valid address, try to convert it as a host name
-    addrinfo hints{}; // Zero-initialize
-    hints.ai_family = AF_INET;
-
-    addrinfo* result = nullptr;
-    if (getaddrinfo(address.data(), nullptr, &hints, &result) == 0 && result != nullptr)
+    // Try to convert the address as an IPv6 address ("2001:db8::1" or "[2001:db8::1]")
+    if (address.find(':') != std::string_view::npos)
     {
-        sockaddr_in sin{};
-        std::memcpy(&sin, result->ai_addr, sizeof(*result->ai_addr));
-
-        const std::uint32_t ip = sin.sin_addr.s_addr;
-        freeaddrinfo(result);
-
-        return IpAddress(ntohl(ip));
+        if ((address.size() > 2) && (address.front() == '[') && (address.back() == ']'))
+            address = address.substr(1, address.size() - 2);
+
+        const std::string str(address);
+        in6_addr          ip{};
+        if (inet_pton(AF_INET6, str.c_str(), &ip) != 1)
+        {
+            // Host names can't contain colons, so there is nothing to look up
+            return std::nullopt;
+        }
+
+        std::array<std::uint8_t, 16> bytes{};
+        std::memcpy(bytes.data(), &ip, bytes.size());
+        return IpAddress(bytes);
     }
 
-    // Not generating en error message here as resolution failure is a valid outcome.
-    return std::nullopt;
+    // Not a valid address, try to convert it as a host name
+    return priv::resolveHostName(address);
 }
 
 
@@ -104,9 +110,34 @@ IpAddress::IpAddress(std::uint32_t address) : m_address(address)
 }
 
 
+////////////////////////////////////////////////////////////
+IpAddress::IpAddress(const std::array<std::uint8_t, 16>& bytes) : m_bytes(bytes), m_type(Type::IpV6)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+IpAddress::Type IpAddress::getType() const
+{
+    return m_type;
+}
+
+
 ////////////////////////////////////////////////////////////
 std::string IpAddress::toString() const
 {
+    if (m_type == Type::IpV6)
+    {
+        in6_addr address{};
+        std::memcpy(&address, m_bytes.data(), m_bytes.size());
+
+        std::array<char, INET6_ADDRSTRLEN> buffer{};
+        if (inet_ntop(AF_INET6, &address, buffer.data(), buffer.size()) == nullptr)
+            return {};
+
+        return buffer.data();
+    }
+
     in_addr address{};
     address.s_addr = htonl(m_address);
 
@@ -117,7 +148,25 @@ std::string IpAddress::toString() const
 ////////////////////////////////////////////////////////////
 std::uint32_t IpAddress::toInteger() const
 {
-    return m_address;
+    return (m_type == Type::IpV4) ? m_address : 0;
+}
+
+
+////////////////////////////////////////////////////////////
+std::array<std::uint8_t, 16> IpAddress::toBytes() const
+{
+    if (m_type == Type::IpV6)
+        return m_bytes;
+
+    // IPv4-mapped IPv6 address (::ffff:a.b.c.d)
+    std::array<std::uint8_t, 16> bytes{};
+    bytes[10] = 0xFF;
+    bytes[11] = 0xFF;
+    bytes[12] = static_cast<std::uint8_t>(m_address >> 24);
+    bytes[13] = static_cast<std::uint8_t>(m_address >> 16);
+    bytes[14] = static_cast<std::uint8_t>(m_address >> 8);
+    bytes[15] = static_cast<std::uint8_t>(m_address);
+    return bytes;
 }
 
 
@@ -208,6 +257,12 @@ bool operator!=(IpAddress left, IpAddress right)
 ////////////////////////////////////////////////////////////
 bool operator<(IpAddress left, IpAddress right)
 {
+    if (left.m_type != right.m_type)
+        return left.m_type < right.m_type;
+
+    if (left.m_type == IpAddress::Type::IpV6)
+        return left.m_bytes < right.m_bytes;
+
     return left.m_address < right.m_address;
 }
 
@@ -26,29 +26,69 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/Network/Packet.hpp>
+#include <SFML/Network/PacketBufferPool.hpp>
 #include <SFML/Network/SocketImpl.hpp>
 
 #include <SFML/System/String.hpp>
 #include <SFML/System/Utils.hpp>
 
+#include <algorithm>
 #include <array>
+#include <limits>
+#include <utility>
 
 #include <cassert>
+#include <cmath>
 #include <cstring>
 #include <cwchar>
 
 
+namespace
+{
+////////////////////////////////////////////////////////////
+std::uint64_t zigZagEncode(std::int64_t value)
+{
+    // Interleave positive and negative values so that small magnitudes get small codes
+    return (static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63);
+}
+
+
+////////////////////////////////////////////////////////////
+std::int64_t zigZagDecode(std::uint64_t value)
+{
+    return static_cast<std::int64_t>(value >> 1) ^ -static_cast<std::int64_t>(value & 1);
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t minCharacterSize(sf::Packet::Encoding encoding)
+{
+    // Wide characters are written as 32-bit integers, which may be as short as a single byte when compact
+    return (encoding == sf::Packet::Encoding::Compact) ? 1 : sizeof(std::uint32_t);
+}
+} // namespace
+
+
 namespace sf
 {
+////////////////////////////////////////////////////////////
+Packet::Packet(PacketBufferPool& pool) : m_data(&pool)
+{
+}
+
+
 ////////////////////////////////////////////////////////////
 void Packet::append(const void* data, std::size_t sizeInBytes)
 {
     if (data && (sizeInBytes > 0))
-    {
-        const auto* begin = reinterpret_cast<const std::byte*>(data);
-        const auto* end   = begin + sizeInBytes;
-        m_data.insert(m_data.end(), begin, end);
-    }
+        m_data.append(reinterpret_cast<const std::byte*>(data), sizeInBytes);
+}
+
+
+////////////////////////////////////////////////////////////
+void Packet::reserve(std::size_t sizeInBytes)
+{
+    m_data.reserve(sizeInBytes);
 }
 
 
@@ -63,8 +103,10 @@ std::size_t Packet::getReadPosition() const
 void Packet::clear()
 {
     m_data.clear();
-    m_readPos = 0;
-    m_isValid = true;
+    m_readPos   = 0;
+    m_isValid   = true;
+    m_writeBits = {};
+    m_readBits  = {};
 }
 
 
@@ -96,9 +138,143 @@ Packet::operator bool() const
 }
 
 
+////////////////////////////////////////////////////////////
+void Packet::setEncoding(Encoding encoding)
+{
+    m_encoding = encoding;
+}
+
+
+////////////////////////////////////////////////////////////
+Packet::Encoding Packet::getEncoding() const
+{
+    return m_encoding;
+}
+
+
+////////////////////////////////////////////////////////////
+void Packet::readFrom(const void* data, std::size_t sizeInBytes)
+{
+    clear();
+
+    // The storage never writes past the size when the capacity is the same
+    m_data.attach(static_cast<std::byte*>(const_cast<void*>(data)), sizeInBytes, sizeInBytes);
+}
+
+
+////////////////////////////////////////////////////////////
+void Packet::writeInto(void* buffer, std::size_t capacity)
+{
+    clear();
+    m_data.attach(static_cast<std::byte*>(buffer), 0, capacity);
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::writeBits(std::uint32_t value, unsigned int bitCount)
+{
+    assert(bitCount >= 1 && bitCount <= 32 && "Packet::writeBits Bit count must be between 1 and 32");
+
+    while (bitCount > 0)
+    {
+        // Start a new byte once the current one is full
+        if (m_writeBits.count == 8)
+        {
+            m_writeBits.position = m_data.size();
+            m_writeBits.count    = 0;
+            *this << std::uint8_t{0};
+        }
+
+        const unsigned int chunk = std::min(bitCount, 8u - m_writeBits.count);
+        const unsigned int bits  = value & ((1u << chunk) - 1u);
+
+        m_data.data()[m_writeBits.position] |= static_cast<std::byte>(bits << m_writeBits.count);
+
+        m_writeBits.count += chunk;
+        bitCount -= chunk;
+        value >>= chunk;
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::readBits(std::uint32_t& value, unsigned int bitCount)
+{
+    assert(bitCount >= 1 && bitCount <= 32 && "Packet::readBits Bit count must be between 1 and 32");
+
+    std::uint32_t result = 0;
+    unsigned int  shift  = 0;
+
+    while (bitCount > 0)
+    {
+        // Move on to the next byte once the current one is consumed
+        if (m_readBits.count == 8)
+        {
+            if (!checkSize(1))
+                return *this;
+
+            m_readBits.position = m_readPos++;
+            m_readBits.count    = 0;
+        }
+
+        const unsigned int chunk = std::min(bitCount, 8u - m_readBits.count);
+        const auto         byte  = std::to_integer<unsigned int>(m_data.data()[m_readBits.position]);
+
+        result |= ((byte >> m_readBits.count) & ((1u << chunk) - 1u)) << shift;
+
+        m_readBits.count += chunk;
+        bitCount -= chunk;
+        shift += chunk;
+    }
+
+    value = result;
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::writeQuantized(float value, float min, float max, unsigned int bitCount)
+{
+    assert(min < max && "Packet::writeQuantized Range must not be empty");
+
+    const auto lowest     = static_cast<double>(min);
+    const auto highest    = static_cast<double>(max);
+    const auto steps      = static_cast<double>((std::uint64_t{1} << bitCount) - 1);
+    const auto normalized = (std::clamp(static_cast<double>(value), lowest, highest) - lowest) / (highest - lowest);
+    const auto quantized  = static_cast<std::uint32_t>(std::llround(normalized * steps));
+
+    return writeBits(quantized, bitCount);
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::readQuantized(float& value, float min, float max, unsigned int bitCount)
+{
+    if (std::uint32_t quantized = 0; readBits(quantized, bitCount))
+    {
+        const auto lowest  = static_cast<double>(min);
+        const auto highest = static_cast<double>(max);
+        const auto steps   = static_cast<double>((std::uint64_t{1} << bitCount) - 1);
+        value              = static_cast<float>(lowest + (highest - lowest) * (quantized / steps));
+    }
+
+    return *this;
+}
+
+
 ////////////////////////////////////////////////////////////
 Packet& Packet::operator>>(bool& data)
 {
+    if (m_encoding == Encoding::Compact)
+    {
+        if (std::uint32_t bit = 0; readBits(bit, 1))
+            data = (bit != 0);
+
+        return *this;
+    }
+
     std::uint8_t value = 0;
     if (*this >> value)
         data = (value != 0);
@@ -112,7 +288,7 @@ Packet& Packet::operator>>(std::int8_t& data)
 {
     if (checkSize(sizeof(data)))
     {
-        std::memcpy(&data, &m_data[m_readPos], sizeof(data));
+        std::memcpy(&data, m_data.data() + m_readPos, sizeof(data));
         m_readPos += sizeof(data);
     }
 
@@ -125,7 +301,7 @@ Packet& Packet::operator>>(std::uint8_t& data)
 {
     if (checkSize(sizeof(data)))
     {
-        std::memcpy(&data, &m_data[m_readPos], sizeof(data));
+        std::memcpy(&data, m_data.data() + m_readPos, sizeof(data));
         m_readPos += sizeof(data);
     }
 
@@ -136,9 +312,17 @@ Packet& Packet::operator>>(std::uint8_t& data)
 ////////////////////////////////////////////////////////////
 Packet& Packet::operator>>(std::int16_t& data)
 {
+    if (m_encoding == Encoding::Compact)
+    {
+        if (std::uint64_t value = 0; readVarint(value, std::numeric_limits<std::uint16_t>::max()))
+            data = static_cast<std::int16_t>(zigZagDecode(value));
+
+        return *this;
+    }
+
     if (checkSize(sizeof(data)))
     {
-        std::memcpy(&data, &m_data[m_readPos], sizeof(data));
+        std::memcpy(&data, m_data.data() + m_readPos, sizeof(data));
         data = static_cast<std::int16_t>(ntohs(static_cast<std::uint16_t>(data)));
         m_readPos += sizeof(data);
     }
@@ -150,9 +334,17 @@ Packet& Packet::operator>>(std::int16_t& data)
 ////////////////////////////////////////////////////////////
 Packet& Packet::operator>>(std::uint16_t& data)
 {
+    if (m_encoding == Encoding::Compact)
+    {
+        if (std::uint64_t value = 0; readVarint(value, std::numeric_limits<std::uint16_t>::max()))
+            data = static_cast<std::uint16_t>(value);
+
+        return *this;
+    }
+
     if (checkSize(sizeof(data)))
     {
-        std::memcpy(&data, &m_data[m_readPos], sizeof(data));
+        std::memcpy(&data, m_data.data() + m_readPos, sizeof(data));
         data = ntohs(data);
         m_readPos += sizeof(data);
     }
@@ -164,9 +356,17 @@ Packet& Packet::operator>>(std::uint16_t& data)
 ////////////////////////////////////////////////////////////
 Packet& Packet::operator>>(std::int32_t& data)
 {
+    if (m_encoding == Encoding::Compact)
+    {
+        if (std::uint64_t value = 0; readVarint(value, std::numeric_limits<std::uint32_t>::max()))
+            data = static_cast<std::int32_t>(zigZagDecode(value));
+
+        return *this;
+    }
+
     if (checkSize(sizeof(data)))
     {
-        std::memcpy(&data, &m_data[m_readPos], sizeof(data));
+        std::memcpy(&data, m_data.data() + m_readPos, sizeof(data));
         data = static_cast<std::int32_t>(ntohl(static_cast<std::uint32_t>(data)));
         m_readPos += sizeof(data);
     }
@@ -178,9 +378,17 @@ Packet& Packet::operator>>(std::int32_t& data)
 ////////////////////////////////////////////////////////////
 Packet& Packet::operator>>(std::uint32_t& data)
 {
+    if (m_encoding == Encoding::Compact)
+    {
+        if (std::uint64_t value = 0; readVarint(value, std::numeric_limits<std::uint32_t>::max()))
+            data = static_cast<std::uint32_t>(value);
+
+        return *this;
+    }
+
     if (checkSize(sizeof(data)))
     {
-        std::memcpy(&data, &m_data[m_readPos], sizeof(data));
+        std::memcpy(&data, m_data.data() + m_readPos, sizeof(data));
         data = ntohl(data);
         m_readPos += sizeof(data);
     }
@@ -192,12 +400,20 @@ Packet& Packet::operator>>(std::uint32_t& data)
 ////////////////////////////////////////////////////////////
 Packet& Packet::operator>>(std::int64_t& data)
 {
+    if (m_encoding == Encoding::Compact)
+    {
+        if (std::uint64_t value = 0; readVarint(value, std::numeric_limits<std::uint64_t>::max()))
+            data = zigZagDecode(value);
+
+        return *this;
+    }
+
     if (checkSize(sizeof(data)))
     {
         // Since ntohll is not available everywhere, we have to convert
         // to network byte order (big endian) manually
         std::array<std::byte, sizeof(data)> bytes{};
-        std::memcpy(bytes.data(), &m_data[m_readPos], bytes.size());
+        std::memcpy(bytes.data(), m_data.data() + m_readPos, bytes.size());
 
         data = toInteger<std::int64_t>(bytes[7], bytes[6], bytes[5], bytes[4], bytes[3], bytes[2], bytes[1], bytes[0]);
 
@@ -211,12 +427,20 @@ Packet& Packet::operator>>(std::int64_t& data)
 ////////////////////////////////////////////////////////////
 Packet& Packet::operator>>(std::uint64_t& data)
 {
+    if (m_encoding == Encoding::Compact)
+    {
+        if (std::uint64_t value = 0; readVarint(value, std::numeric_limits<std::uint64_t>::max()))
+            data = value;
+
+        return *this;
+    }
+
     if (checkSize(sizeof(data)))
     {
         // Since ntohll is not available everywhere, we have to convert
         // to network byte order (big endian) manually
         std::array<std::byte, sizeof(data)> bytes{};
-        std::memcpy(bytes.data(), &m_data[m_readPos], sizeof(data));
+        std::memcpy(bytes.data(), m_data.data() + m_readPos, sizeof(data));
 
         data = toInteger<std::uint64_t>(bytes[7], bytes[6], bytes[5], bytes[4], bytes[3], bytes[2], bytes[1], bytes[0]);
 
@@ -232,7 +456,7 @@ Packet& Packet::operator>>(float& data)
 {
     if (checkSize(sizeof(data)))
     {
-        std::memcpy(&data, &m_data[m_readPos], sizeof(data));
+        std::memcpy(&data, m_data.data() + m_readPos, sizeof(data));
         m_readPos += sizeof(data);
     }
 
@@ -245,7 +469,7 @@ Packet& Packet::operator>>(double& data)
 {
     if (checkSize(sizeof(data)))
     {
-        std::memcpy(&data, &m_data[m_readPos], sizeof(data));
+        std::memcpy(&data, m_data.data() + m_readPos, sizeof(data));
         m_readPos += sizeof(data);
     }
 
@@ -265,7 +489,7 @@ Packet& Packet::operator>>(char* data)
     if ((length > 0) && checkSize(length))
     {
         // Then extract characters
-        std::memcpy(data, &m_data[m_readPos], length);
+        std::memcpy(data, m_data.data() + m_readPos, length);
         data[length] = '\0';
 
         // Update reading position
@@ -287,7 +511,7 @@ Packet& Packet::operator>>(std::string& data)
     if ((length > 0) && checkSize(length))
     {
         // Then extract characters
-        data.assign(reinterpret_cast<char*>(&m_data[m_readPos]), length);
+        data.assign(reinterpret_cast<char*>(m_data.data() + m_readPos), length);
 
         // Update reading position
         m_readPos += length;
@@ -306,7 +530,7 @@ Packet& Packet::operator>>(wchar_t* data)
     std::uint32_t length = 0;
     *this >> length;
 
-    if ((length > 0) && checkSize(length * sizeof(std::uint32_t)))
+    if ((length > 0) && checkSize(length * minCharacterSize(m_encoding)))
     {
         // Then extract characters
         for (std::uint32_t i = 0; i < length; ++i)
@@ -330,7 +554,7 @@ Packet& Packet::operator>>(std::wstring& data)
     *this >> length;
 
     data.clear();
-    if ((length > 0) && checkSize(length * sizeof(std::uint32_t)))
+    if ((length > 0) && checkSize(length * minCharacterSize(m_encoding)))
     {
         // Then extract characters
         for (std::uint32_t i = 0; i < length; ++i)
@@ -353,7 +577,7 @@ Packet& Packet::operator>>(String& data)
     *this >> length;
 
     data.clear();
-    if ((length > 0) && checkSize(length * sizeof(std::uint32_t)))
+    if ((length > 0) && checkSize(length * minCharacterSize(m_encoding)))
     {
         // Then extract characters
         for (std::uint32_t i = 0; i < length; ++i)
@@ -371,6 +595,9 @@ Packet& Packet::operator>>(String& data)
 ////////////////////////////////////////////////////////////
 Packet& Packet::operator<<(bool data)
 {
+    if (m_encoding == Encoding::Compact)
+        return writeBits(data ? 1u : 0u, 1);
+
     *this << static_cast<std::uint8_t>(data);
     return *this;
 }
@@ -395,6 +622,12 @@ Packet& Packet::operator<<(std::uint8_t data)
 ////////////////////////////////////////////////////////////
 Packet& Packet::operator<<(std::int16_t data)
 {
+    if (m_encoding == Encoding::Compact)
+    {
+        writeVarint(zigZagEncode(data));
+        return *this;
+    }
+
     const auto toWrite = static_cast<std::int16_t>(htons(static_cast<std::uint16_t>(data)));
     append(&toWrite, sizeof(toWrite));
     return *this;
@@ -404,6 +637,12 @@ Packet& Packet::operator<<(std::int16_t data)
 ////////////////////////////////////////////////////////////
 Packet& Packet::operator<<(std::uint16_t data)
 {
+    if (m_encoding == Encoding::Compact)
+    {
+        writeVarint(data);
+        return *this;
+    }
+
     const std::uint16_t toWrite = htons(data);
     append(&toWrite, sizeof(toWrite));
     return *this;
@@ -413,6 +652,12 @@ Packet& Packet::operator<<(std::uint16_t data)
 ////////////////////////////////////////////////////////////
 Packet& Packet::operator<<(std::int32_t data)
 {
+    if (m_encoding == Encoding::Compact)
+    {
+        writeVarint(zigZagEncode(data));
+        return *this;
+    }
+
     const auto toWrite = static_cast<std::int32_t>(htonl(static_cast<std::uint32_t>(data)));
     append(&toWrite, sizeof(toWrite));
     return *this;
@@ -422,6 +667,12 @@ Packet& Packet::operator<<(std::int32_t data)
 ////////////////////////////////////////////////////////////
 Packet& Packet::operator<<(std::uint32_t data)
 {
+    if (m_encoding == Encoding::Compact)
+    {
+        writeVarint(data);
+        return *this;
+    }
+
     const std::uint32_t toWrite = htonl(data);
     append(&toWrite, sizeof(toWrite));
     return *this;
@@ -431,6 +682,12 @@ Packet& Packet::operator<<(std::uint32_t data)
 ////////////////////////////////////////////////////////////
 Packet& Packet::operator<<(std::int64_t data)
 {
+    if (m_encoding == Encoding::Compact)
+    {
+        writeVarint(zigZagEncode(data));
+        return *this;
+    }
+
     // Since htonll is not available everywhere, we have to convert
     // to network byte order (big endian) manually
 
@@ -451,6 +708,12 @@ Packet& Packet::operator<<(std::int64_t data)
 ////////////////////////////////////////////////////////////
 Packet& Packet::operator<<(std::uint64_t data)
 {
+    if (m_encoding == Encoding::Compact)
+    {
+        writeVarint(data);
+        return *this;
+    }
+
     // Since htonll is not available everywhere, we have to convert
     // to network byte order (big endian) manually
 
@@ -568,6 +831,60 @@ Packet& Packet::operator<<(const String& data)
 }
 
 
+////////////////////////////////////////////////////////////
+void Packet::writeVarint(std::uint64_t value)
+{
+    // 7 bits per byte, least significant group first, high bit set on all bytes but the last
+    std::array<std::uint8_t, 10> bytes{};
+    std::size_t                  count = 0;
+
+    do
+    {
+        bytes[count] = static_cast<std::uint8_t>(value & 0x7F);
+        value >>= 7;
+
+        if (value != 0)
+            bytes[count] |= 0x80;
+
+        ++count;
+    } while (value != 0);
+
+    append(bytes.data(), count);
+}
+
+
+////////////////////////////////////////////////////////////
+bool Packet::readVarint(std::uint64_t& value, std::uint64_t maxValue)
+{
+    std::uint64_t result = 0;
+
+    for (unsigned int shift = 0; shift < 64; shift += 7)
+    {
+        if (!checkSize(1))
+            return false;
+
+        const auto byte = std::to_integer<std::uint64_t>(m_data.data()[m_readPos++]);
+        result |= (byte & 0x7F) << shift;
+
+        if ((byte & 0x80) == 0)
+        {
+            // Reject values which don't fit in 64 bits or in the requested type
+            const bool overflowDetected = (shift == 63) && ((byte & 0x7E) != 0);
+            m_isValid                   = !overflowDetected && (result <= maxValue);
+
+            if (m_isValid)
+                value = result;
+
+            return m_isValid;
+        }
+    }
+
+    // More than 10 bytes can't be a valid 64-bit varint
+    m_isValid = false;
+    return false;
+}
+
+
 ////////////////////////////////////////////////////////////
 bool Packet::checkSize(std::size_t size)
 {
@@ -590,7 +907,222 @@ const void* Packet::onSend(std::size_t& size)
 ////////////////////////////////////////////////////////////
 void Packet::onReceive(const void* data, std::size_t size)
 {
+    // Take over the receive buffer instead of copying it when we are given all of it,
+    // unless it is small enough to be copied to the inline storage
+    if (m_receiveBuffer && m_data.empty() && (data == m_receiveBuffer->data()) &&
+        (size == m_receiveBuffer->size()) && (size > Storage::inlineCapacity))
+    {
+        m_data.swap(*m_receiveBuffer);
+        return;
+    }
+
     append(data, size);
 }
 
+
+////////////////////////////////////////////////////////////
+void Packet::invalidate()
+{
+    m_isValid = false;
+}
+
+
+////////////////////////////////////////////////////////////
+void Packet::receiveBuffer(std::vector<std::byte>& buffer)
+{
+    m_receiveBuffer = &buffer;
+    onReceive(buffer.data(), buffer.size());
+    m_receiveBuffer = nullptr;
+}
+
+
+////////////////////////////////////////////////////////////
+Packet::Storage::Storage(PacketBufferPool* pool) : m_pool(pool)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+Packet::Storage::~Storage()
+{
+    releaseHeap();
+}
+
+
+////////////////////////////////////////////////////////////
+Packet::Storage::Storage(const Storage& other) : m_pool(other.m_pool)
+{
+    append(other.data(), other.size());
+}
+
+
+////////////////////////////////////////////////////////////
+Packet::Storage& Packet::Storage::operator=(const Storage& other)
+{
+    if (this != &other)
+    {
+        // Reuse the memory we already have
+        clear();
+        append(other.data(), other.size());
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+Packet::Storage& Packet::Storage::operator=(Storage&& other) noexcept
+{
+    if (this != &other)
+    {
+        releaseHeap();
+
+        m_inline           = other.m_inline;
+        m_size             = other.m_size;
+        m_heap             = std::move(other.m_heap);
+        m_external         = other.m_external;
+        m_externalCapacity = other.m_externalCapacity;
+        m_location         = other.m_location;
+        m_pool             = other.m_pool;
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+std::byte* Packet::Storage::data()
+{
+    switch (m_location)
+    {
+        case Location::Inline:
+            return m_inline.data();
+        case Location::Heap:
+            return m_heap.data();
+        case Location::External:
+            return m_external;
+    }
+
+    return nullptr;
+}
+
+
+////////////////////////////////////////////////////////////
+const std::byte* Packet::Storage::data() const
+{
+    return const_cast<Storage*>(this)->data();
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t Packet::Storage::size() const
+{
+    return (m_location == Location::Heap) ? m_heap.size() : m_size;
+}
+
+
+////////////////////////////////////////////////////////////
+bool Packet::Storage::empty() const
+{
+    return size() == 0;
+}
+
+
+////////////////////////////////////////////////////////////
+void Packet::Storage::append(const std::byte* data, std::size_t size)
+{
+    if (size == 0)
+        return;
+
+    if (m_location != Location::Heap)
+    {
+        const std::size_t capacity = (m_location == Location::Inline) ? m_inline.size() : m_externalCapacity;
+
+        if (m_size + size <= capacity)
+        {
+            std::memcpy(this->data() + m_size, data, size);
+            m_size += size;
+            return;
+        }
+
+        moveToHeap(std::max(2 * capacity, m_size + size));
+    }
+
+    m_heap.insert(m_heap.end(), data, data + size);
+}
+
+
+////////////////////////////////////////////////////////////
+void Packet::Storage::reserve(std::size_t capacity)
+{
+    if (m_location == Location::Heap)
+        m_heap.reserve(capacity);
+    else if (capacity > ((m_location == Location::Inline) ? m_inline.size() : m_externalCapacity))
+        moveToHeap(capacity);
+}
+
+
+////////////////////////////////////////////////////////////
+void Packet::Storage::clear()
+{
+    // Keep the heap storage (if any) to reuse its memory, but forget about external memory
+    if (m_location == Location::External)
+        m_location = m_heap.capacity() > 0 ? Location::Heap : Location::Inline;
+
+    m_size = 0;
+    m_heap.clear();
+}
+
+
+////////////////////////////////////////////////////////////
+void Packet::Storage::swap(std::vector<std::byte>& buffer)
+{
+    assert(empty() && "Packet::Storage::swap Storage must be empty");
+
+    m_location = Location::Heap;
+    m_size     = 0;
+    std::swap(m_heap, buffer);
+}
+
+
+////////////////////////////////////////////////////////////
+void Packet::Storage::attach(std::byte* data, std::size_t size, std::size_t capacity)
+{
+    m_heap.clear();
+    m_external         = data;
+    m_size             = size;
+    m_externalCapacity = capacity;
+    m_location         = Location::External;
+}
+
+
+////////////////////////////////////////////////////////////
+void Packet::Storage::moveToHeap(std::size_t capacity)
+{
+    if (m_pool && (m_heap.capacity() < capacity))
+    {
+        // The heap storage kept while writing into external memory is too small, give it back to the pool
+        std::vector<std::byte> buffer = m_pool->acquire(capacity);
+        releaseHeap();
+        m_heap = std::move(buffer);
+    }
+    else
+    {
+        m_heap.reserve(capacity);
+    }
+
+    const std::byte* begin = data();
+    m_heap.assign(begin, begin + m_size);
+    m_location = Location::Heap;
+    m_size     = 0;
+}
+
+
+////////////////////////////////////////////////////////////
+void Packet::Storage::releaseHeap()
+{
+    if (m_pool && (m_heap.capacity() > 0))
+        m_pool->release(std::move(m_heap));
+}
+
 } // namespace sf
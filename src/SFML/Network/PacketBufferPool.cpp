@@ -0,0 +1,86 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Network/PacketBufferPool.hpp>
+
+#include <utility>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+PacketBufferPool::PacketBufferPool(std::size_t maxBufferCount) : m_maxBufferCount(maxBufferCount)
+{
+    // Make sure releasing a buffer never has to allocate
+    m_buffers.reserve(m_maxBufferCount);
+}
+
+
+////////////////////////////////////////////////////////////
+std::vector<std::byte> PacketBufferPool::acquire(std::size_t capacity)
+{
+    std::vector<std::byte> buffer;
+
+    {
+        const std::lock_guard lock(m_mutex);
+
+        if (!m_buffers.empty())
+        {
+            buffer = std::move(m_buffers.back());
+            m_buffers.pop_back();
+        }
+    }
+
+    buffer.reserve(capacity);
+    return buffer;
+}
+
+
+////////////////////////////////////////////////////////////
+void PacketBufferPool::release(std::vector<std::byte>&& buffer)
+{
+    if (buffer.capacity() == 0)
+        return;
+
+    buffer.clear();
+
+    const std::lock_guard lock(m_mutex);
+
+    if (m_buffers.size() < m_maxBufferCount)
+        m_buffers.push_back(std::move(buffer));
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t PacketBufferPool::getBufferCount() const
+{
+    const std::lock_guard lock(m_mutex);
+    return m_buffers.size();
+}
+
+} // namespace sf
@@ -25,14 +25,61 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <SFML/Network/BufferedSockets.hpp>
 #include <SFML/Network/Socket.hpp>
 #include <SFML/Network/SocketImpl.hpp>
 
 #include <SFML/System/Err.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <limits>
 #include <ostream>
 #include <utility>
 
+#include <cmath>
+#include <cstdint>
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+bool setIntegerOption(sf::SocketHandle handle, int level, int name, int value)
+{
+    return setsockopt(handle, level, name, reinterpret_cast<char*>(&value), sizeof(value)) != -1;
+}
+
+
+////////////////////////////////////////////////////////////
+int toOptionValue(std::size_t size)
+{
+    return static_cast<int>(std::min(size, static_cast<std::size_t>(std::numeric_limits<int>::max())));
+}
+
+
+////////////////////////////////////////////////////////////
+int toWholeSeconds(sf::Time time)
+{
+    // Keep-alive parameters are in whole seconds, and 0 is rejected
+    return std::max(1, static_cast<int>(std::ceil(time.asSeconds())));
+}
+
+
+////////////////////////////////////////////////////////////
+// Number of traffic counters of a socket
+constexpr std::size_t globalCounterCount{
+    static_cast<std::size_t>(sf::priv::SocketImpl::SocketAccess::Counter::TlsHandshakeTime) + 1};
+
+// Program-wide traffic counters
+struct GlobalCounters
+{
+    std::atomic<bool>                                          enabled{};
+    std::array<std::atomic<std::uint64_t>, globalCounterCount> values{};
+};
+
+GlobalCounters globalCounters;
+} // namespace
+
 
 namespace sf
 {
@@ -54,7 +101,11 @@ Socket::~Socket()
 Socket::Socket(Socket&& socket) noexcept :
     m_type(socket.m_type),
     m_socket(std::exchange(socket.m_socket, priv::SocketImpl::invalidSocket())),
-    m_isBlocking(socket.m_isBlocking)
+    m_isBlocking(socket.m_isBlocking),
+    m_addressType(socket.m_addressType),
+    m_options(socket.m_options),
+    m_counters(socket.m_counters),
+    m_hasBufferedData(std::exchange(socket.m_hasBufferedData, false))
 {
 }
 
@@ -67,9 +118,13 @@ Socket& Socket::operator=(Socket&& socket) noexcept
 
     close();
 
-    m_type       = socket.m_type;
-    m_socket     = std::exchange(socket.m_socket, priv::SocketImpl::invalidSocket());
-    m_isBlocking = socket.m_isBlocking;
+    m_type            = socket.m_type;
+    m_socket          = std::exchange(socket.m_socket, priv::SocketImpl::invalidSocket());
+    m_isBlocking      = socket.m_isBlocking;
+    m_addressType     = socket.m_addressType;
+    m_options         = socket.m_options;
+    m_counters        = socket.m_counters;
+    m_hasBufferedData = std::exchange(socket.m_hasBufferedData, false);
     return *this;
 }
 
@@ -100,12 +155,21 @@ SocketHandle Socket::getNativeHandle() const
 
 
 ////////////////////////////////////////////////////////////
-void Socket::create()
+IpAddress::Type Socket::getAddressType() const
+{
+    return m_addressType;
+}
+
+
+////////////////////////////////////////////////////////////
+void Socket::create(IpAddress::Type addressType)
 {
     // Don't create the socket if it already exists
     if (m_socket == priv::SocketImpl::invalidSocket())
     {
-        const SocketHandle handle = socket(PF_INET, m_type == Type::Tcp ? SOCK_STREAM : SOCK_DGRAM, 0);
+        const SocketHandle handle = socket(priv::SocketImpl::getProtocolFamily(addressType),
+                                           m_type == Type::Tcp ? SOCK_STREAM : SOCK_DGRAM,
+                                           0);
 
         if (handle == priv::SocketImpl::invalidSocket())
         {
@@ -113,35 +177,60 @@ void Socket::create()
             return;
         }
 
-        create(handle);
+        if (addressType == IpAddress::Type::IpV6)
+        {
+            // Make IPv6 sockets dual-stack, whatever the default of the system is
+            // (this must happen before binding or connecting, so accepted sockets are left alone)
+            int no = 0;
+            if (setsockopt(handle, IPPROTO_IPV6, IPV6_V6ONLY, reinterpret_cast<char*>(&no), sizeof(no)) == -1)
+            {
+                err() << "Failed to set socket option \"IPV6_V6ONLY\" ; "
+                      << "the socket won't communicate with IPv4 peers" << std::endl;
+            }
+        }
+
+        create(handle, addressType);
     }
 }
 
 
 ////////////////////////////////////////////////////////////
-void Socket::create(SocketHandle handle)
+void Socket::create(SocketHandle handle, IpAddress::Type addressType, bool blockingSet)
 {
     // Don't create the socket if it already exists
     if (m_socket == priv::SocketImpl::invalidSocket())
     {
         // Assign the new handle
-        m_socket = handle;
+        m_socket      = handle;
+        m_addressType = addressType;
 
         // Set the current blocking state
-        setBlocking(m_isBlocking);
+        if (!blockingSet)
+            setBlocking(m_isBlocking);
+
+        // Apply the options which differ from the system defaults
+        if (m_options.sendBufferSize > 0)
+            applyOption(Option::SendBufferSize);
+        if (m_options.receiveBufferSize > 0)
+            applyOption(Option::ReceiveBufferSize);
+        if (m_options.reusePort)
+            applyOption(Option::ReusePort);
+        if (m_options.busyPoll > Time::Zero)
+            applyOption(Option::BusyPoll);
 
         if (m_type == Type::Tcp)
         {
-            // Disable the Nagle algorithm (i.e. removes buffering of TCP packets)
-            int yes = 1;
-            if (setsockopt(m_socket, IPPROTO_TCP, TCP_NODELAY, reinterpret_cast<char*>(&yes), sizeof(yes)) == -1)
-            {
-                err() << "Failed to set socket option \"TCP_NODELAY\" ; "
-                      << "all your TCP packets will be buffered" << std::endl;
-            }
+            // Disable the Nagle algorithm (i.e. removes buffering of TCP packets) unless told otherwise
+            if (m_options.noDelay)
+                applyOption(Option::NoDelay);
+            if (m_options.linger)
+                applyOption(Option::Linger);
+            if (m_options.keepAlive)
+                applyOption(Option::KeepAlive);
 
 // On macOS, disable the SIGPIPE signal on disconnection
 #ifdef SFML_SYSTEM_MACOS
+            int yes = 1;
             if (setsockopt(m_socket, SOL_SOCKET, SO_NOSIGPIPE, reinterpret_cast<char*>(&yes), sizeof(yes)) == -1)
             {
                 err() << "Failed to set socket option \"SO_NOSIGPIPE\"" << std::endl;
@@ -167,9 +256,314 @@ void Socket::close()
     // Close the socket
     if (m_socket != priv::SocketImpl::invalidSocket())
     {
+        // Nothing can be received from a closed socket, and its handle may be reused
+        setBufferedData(false);
+
         priv::SocketImpl::close(m_socket);
         m_socket = priv::SocketImpl::invalidSocket();
     }
 }
 
+
+////////////////////////////////////////////////////////////
+void Socket::setBufferedData(bool buffered)
+{
+    // Only sockets which exist can be watched by a selector
+    if ((buffered == m_hasBufferedData) || (m_socket == priv::SocketImpl::invalidSocket()))
+        return;
+
+    m_hasBufferedData = buffered;
+    priv::setSocketBuffered(m_socket, buffered);
+}
+
+
+////////////////////////////////////////////////////////////
+void Socket::setSendBufferSize(std::size_t size)
+{
+    m_options.sendBufferSize = size;
+    applyOption(Option::SendBufferSize);
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t Socket::getSendBufferSize() const
+{
+    return m_options.sendBufferSize;
+}
+
+
+////////////////////////////////////////////////////////////
+void Socket::setReceiveBufferSize(std::size_t size)
+{
+    m_options.receiveBufferSize = size;
+    applyOption(Option::ReceiveBufferSize);
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t Socket::getReceiveBufferSize() const
+{
+    return m_options.receiveBufferSize;
+}
+
+
+////////////////////////////////////////////////////////////
+Socket::Statistics Socket::getStatistics() const
+{
+    return toStatistics(m_counters);
+}
+
+
+////////////////////////////////////////////////////////////
+void Socket::resetStatistics()
+{
+    m_counters = {};
+}
+
+
+////////////////////////////////////////////////////////////
+void Socket::setGlobalStatisticsEnabled(bool enabled)
+{
+    globalCounters.enabled.store(enabled, std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+bool Socket::isGlobalStatisticsEnabled()
+{
+    return globalCounters.enabled.load(std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+Socket::Statistics Socket::getGlobalStatistics()
+{
+    Counters counters{};
+    for (std::size_t i = 0; i < counterCount; ++i)
+        counters[i] = globalCounters.values[i].load(std::memory_order_relaxed);
+
+    return toStatistics(counters);
+}
+
+
+////////////////////////////////////////////////////////////
+void Socket::resetGlobalStatistics()
+{
+    for (auto& value : globalCounters.values)
+        value.store(0, std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+void Socket::countTraffic(Counter counter, std::uint64_t value)
+{
+    static_assert(globalCounterCount == counterCount, "Every traffic counter must have a global counterpart");
+
+    const auto index = static_cast<std::size_t>(counter);
+    m_counters[index] += value;
+
+    if (globalCounters.enabled.load(std::memory_order_relaxed))
+        globalCounters.values[index].fetch_add(value, std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+Socket::Statistics Socket::toStatistics(const Counters& counters)
+{
+    const auto get = [&counters](Counter counter) { return counters[static_cast<std::size_t>(counter)]; };
+
+    Statistics statistics;
+    statistics.bytesSent            = get(Counter::BytesSent);
+    statistics.bytesReceived        = get(Counter::BytesReceived);
+    statistics.messagesSent         = get(Counter::MessagesSent);
+    statistics.messagesReceived     = get(Counter::MessagesReceived);
+    statistics.sendCalls            = get(Counter::SendCalls);
+    statistics.receiveCalls         = get(Counter::ReceiveCalls);
+    statistics.partialSends         = get(Counter::PartialSends);
+    statistics.notReadySends        = get(Counter::NotReadySends);
+    statistics.notReadyReceives     = get(Counter::NotReadyReceives);
+    statistics.tlsRecordsSent       = get(Counter::TlsRecordsSent);
+    statistics.tlsRecordsReceived   = get(Counter::TlsRecordsReceived);
+    statistics.tlsHandshakes        = get(Counter::TlsHandshakes);
+    statistics.tlsResumedHandshakes = get(Counter::TlsResumedHandshakes);
+    statistics.tlsHandshakeTime     = microseconds(static_cast<std::int64_t>(get(Counter::TlsHandshakeTime)));
+    return statistics;
+}
+
+
+////////////////////////////////////////////////////////////
+void Socket::setNoDelay(bool noDelay)
+{
+    m_options.noDelay = noDelay;
+    applyOption(Option::NoDelay);
+}
+
+
+////////////////////////////////////////////////////////////
+bool Socket::isNoDelay() const
+{
+    return m_options.noDelay;
+}
+
+
+////////////////////////////////////////////////////////////
+void Socket::setReusePort(bool reusePort)
+{
+    m_options.reusePort = reusePort;
+    applyOption(Option::ReusePort);
+}
+
+
+////////////////////////////////////////////////////////////
+bool Socket::isReusePort() const
+{
+    return m_options.reusePort;
+}
+
+
+////////////////////////////////////////////////////////////
+void Socket::setLinger(std::optional<Time> linger)
+{
+    m_options.linger = linger;
+    applyOption(Option::Linger);
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<Time> Socket::getLinger() const
+{
+    return m_options.linger;
+}
+
+
+////////////////////////////////////////////////////////////
+void Socket::setKeepAlive(std::optional<KeepAlive> keepAlive)
+{
+    m_options.keepAlive = keepAlive;
+    applyOption(Option::KeepAlive);
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<Socket::KeepAlive> Socket::getKeepAlive() const
+{
+    return m_options.keepAlive;
+}
+
+
+////////////////////////////////////////////////////////////
+void Socket::setBusyPoll(Time busyPoll)
+{
+    m_options.busyPoll = std::max(busyPoll, Time::Zero);
+    applyOption(Option::BusyPoll);
+}
+
+
+////////////////////////////////////////////////////////////
+Time Socket::getBusyPoll() const
+{
+    return m_options.busyPoll;
+}
+
+
+////////////////////////////////////////////////////////////
+void Socket::applyOption(Option option) const
+{
+    // Options of sockets which don't exist yet are applied when they are created
+    if (m_socket == priv::SocketImpl::invalidSocket())
+        return;
+
+    switch (option)
+    {
+        case Option::SendBufferSize:
+        {
+            if ((m_options.sendBufferSize > 0) &&
+                !setIntegerOption(m_socket, SOL_SOCKET, SO_SNDBUF, toOptionValue(m_options.sendBufferSize)))
+                err() << "Failed to set socket option \"SO_SNDBUF\"" << std::endl;
+            break;
+        }
+        case Option::ReceiveBufferSize:
+        {
+            if ((m_options.receiveBufferSize > 0) &&
+                !setIntegerOption(m_socket, SOL_SOCKET, SO_RCVBUF, toOptionValue(m_options.receiveBufferSize)))
+                err() << "Failed to set socket option \"SO_RCVBUF\"" << std::endl;
+            break;
+        }
+        case Option::NoDelay:
+        {
+            if ((m_type == Type::Tcp) &&
+                !setIntegerOption(m_socket, IPPROTO_TCP, TCP_NODELAY, m_options.noDelay ? 1 : 0))
+            {
+                err() << "Failed to set socket option \"TCP_NODELAY\" ; "
+                      << "all your TCP packets will be buffered" << std::endl;
+            }
+            break;
+        }
+        case Option::ReusePort:
+        {
+#ifdef SO_REUSEPORT
+            if (!setIntegerOption(m_socket, SOL_SOCKET, SO_REUSEPORT, m_options.reusePort ? 1 : 0))
+                err() << "Failed to set socket option \"SO_REUSEPORT\"" << std::endl;
+#else
+            if (m_options.reusePort)
+                err() << "Socket option \"SO_REUSEPORT\" is not supported on this system" << std::endl;
+#endif
+            break;
+        }
+        case Option::Linger:
+        {
+            linger value{};
+            if (m_options.linger)
+            {
+                value.l_onoff  = 1;
+                value.l_linger = static_cast<decltype(value.l_linger)>(std::ceil(m_options.linger->asSeconds()));
+            }
+
+            if (setsockopt(m_socket, SOL_SOCKET, SO_LINGER, reinterpret_cast<char*>(&value), sizeof(value)) == -1)
+                err() << "Failed to set socket option \"SO_LINGER\"" << std::endl;
+            break;
+        }
+        case Option::KeepAlive:
+        {
+            bool success = setIntegerOption(m_socket, SOL_SOCKET, SO_KEEPALIVE, m_options.keepAlive ? 1 : 0);
+
+            // Tune the probes where the system allows it, otherwise keep its defaults
+            if (success && m_options.keepAlive)
+            {
+                const KeepAlive& keepAlive = *m_options.keepAlive;
+#if defined(TCP_KEEPIDLE)
+                success = setIntegerOption(m_socket, IPPROTO_TCP, TCP_KEEPIDLE, toWholeSeconds(keepAlive.idle));
+#elif defined(TCP_KEEPALIVE)
+                success = setIntegerOption(m_socket, IPPROTO_TCP, TCP_KEEPALIVE, toWholeSeconds(keepAlive.idle));
+#endif
+#if defined(TCP_KEEPINTVL)
+                success = success &&
+                          setIntegerOption(m_socket, IPPROTO_TCP, TCP_KEEPINTVL, toWholeSeconds(keepAlive.interval));
+#endif
+#if defined(TCP_KEEPCNT)
+                const auto probeCount = static_cast<int>(std::clamp(keepAlive.probeCount, 1u, 127u));
+                success               = success && setIntegerOption(m_socket, IPPROTO_TCP, TCP_KEEPCNT, probeCount);
+#endif
+            }
+
+            if (!success)
+                err() << "Failed to set socket option \"SO_KEEPALIVE\"" << std::endl;
+            break;
+        }
+        case Option::BusyPoll:
+        {
+#ifdef SO_BUSY_POLL
+            const auto microseconds = std::min(m_options.busyPoll.asMicroseconds(),
+                                               std::int64_t{std::numeric_limits<int>::max()});
+            if (!setIntegerOption(m_socket, SOL_SOCKET, SO_BUSY_POLL, static_cast<int>(microseconds)))
+                err() << "Failed to set socket option \"SO_BUSY_POLL\"" << std::endl;
+#else
+            if (m_options.busyPoll > Time::Zero)
+                err() << "Socket option \"SO_BUSY_POLL\" is not supported on this system" << std::endl;
+#endif
+            break;
+        }
+    }
+}
+
 } // namespace sf
@@ -30,6 +30,8 @@
 #include <SFML/Network/Socket.hpp>
 #include <SFML/Network/SocketHandle.hpp>
 
+#include <SFML/System/Time.hpp>
+
 #if defined(SFML_SYSTEM_WINDOWS)
 
 #include <SFML/System/Win32/WindowsHeader.hpp>
@@ -43,14 +45,18 @@
 #include <netdb.h>
 #include <netinet/in.h>
 #include <netinet/tcp.h>
+#include <poll.h>
 #include <sys/socket.h>
 #include <sys/types.h>
 #include <unistd.h>
 
-#include <cstddef>
-
 #endif
 
+#include <algorithm>
+#include <limits>
+#include <optional>
+
+#include <cstddef>
 #include <cstdint>
 
 
@@ -68,13 +74,61 @@ public:
     // Types
     ////////////////////////////////////////////////////////////
 #if defined(SFML_SYSTEM_WINDOWS)
-    using AddrLength = int;
-    using Size       = int;
+    using AddrLength     = int;
+    using Size           = int;
+    using PollDescriptor = WSAPOLLFD;
 #else
-    using AddrLength = socklen_t;
-    using Size       = std::size_t;
+    using AddrLength     = socklen_t;
+    using Size           = std::size_t;
+    using PollDescriptor = pollfd;
 #endif
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Contiguous block of bytes to be sent by `sendBuffers`
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Buffer
+    {
+        const void* data{}; //!< Start of the block
+        std::size_t size{}; //!< Size of the block, in bytes
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Maximum number of buffers handled by a single call to `sendBuffers`
+    ///
+    ////////////////////////////////////////////////////////////
+    static constexpr std::size_t maxBuffers = 64;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Socket exposing the members which `sf::Socket`
+    ///        only gives to derived classes
+    ///
+    /// Only used to name these members from the classes of the
+    /// module which aren't sockets, never instantiated.
+    ///
+    ////////////////////////////////////////////////////////////
+    struct SocketAccess : Socket
+    {
+        using Socket::Counter;
+        using Socket::countTraffic;
+        using Socket::getNativeHandle;
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Socket address of either family, as passed to the socket functions
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Address
+    {
+        sockaddr_storage storage{};                        //!< Holds either a sockaddr_in or a sockaddr_in6
+        AddrLength       length{sizeof(sockaddr_storage)}; //!< Size of the address held by `storage`
+
+        [[nodiscard]] sockaddr* get()
+        {
+            return reinterpret_cast<sockaddr*>(&storage);
+        }
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Create an internal sockaddr_in address
     ///
@@ -86,6 +140,88 @@ public:
     ////////////////////////////////////////////////////////////
     static sockaddr_in createAddress(std::uint32_t address, unsigned short port);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Create an internal address for a socket of the given family
+    ///
+    /// IPv4 addresses are converted to IPv4-mapped IPv6
+    /// addresses for IPv6 sockets, which are dual-stack.
+    ///
+    /// \param address Target address
+    /// \param port    Target port
+    /// \param family  Family of the socket that will use the address
+    ///
+    /// \return Address ready to be used by socket functions, with a length of 0 if
+    ///         an IPv6 address is given for an IPv4 socket
+    ///
+    ////////////////////////////////////////////////////////////
+    static Address createAddress(IpAddress address, unsigned short port, IpAddress::Type family);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Extract the IP address of an internal address
+    ///
+    /// IPv4-mapped IPv6 addresses, used for the IPv4 peers of
+    /// dual-stack sockets, are converted back to IPv4 addresses.
+    ///
+    /// \param address Internal address, either a sockaddr_in or a sockaddr_in6
+    ///
+    /// \return IP address, or `std::nullopt` if the family of the address is not supported
+    ///
+    ////////////////////////////////////////////////////////////
+    static std::optional<IpAddress> getIpAddress(const sockaddr& address);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Extract the port of an internal address
+    ///
+    /// \param address Internal address, either a sockaddr_in or a sockaddr_in6
+    ///
+    /// \return Port, or 0 if the family of the address is not supported
+    ///
+    ////////////////////////////////////////////////////////////
+    static unsigned short getPort(const sockaddr& address);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the protocol family to create sockets of the given address family
+    ///
+    /// \param type Address family
+    ///
+    /// \return PF_INET or PF_INET6
+    ///
+    ////////////////////////////////////////////////////////////
+    static int getProtocolFamily(IpAddress::Type type);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the handle of a socket
+    ///
+    /// This lets the classes of the module which aren't sockets,
+    /// e.g. `sf::Ftp`, pass the handle to system calls.
+    ///
+    /// \param socket Socket to get the handle of
+    ///
+    /// \return OS-specific handle of the socket
+    ///
+    ////////////////////////////////////////////////////////////
+    static SocketHandle getNativeHandle(const Socket& socket)
+    {
+        return (socket.*&SocketAccess::getNativeHandle)();
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add to a traffic counter of a socket
+    ///
+    /// This lets the classes of the module which send or receive
+    /// data through a socket's handle, e.g. `sf::Ftp`, keep its
+    /// statistics up to date.
+    ///
+    /// \param socket  Socket whose counter to increase
+    /// \param counter Counter to increase
+    /// \param value   Value to add to the counter
+    ///
+    ////////////////////////////////////////////////////////////
+    static void countTraffic(Socket& socket, SocketAccess::Counter counter, std::uint64_t value = 1)
+    {
+        (socket.*&SocketAccess::countTraffic)(counter, value);
+    }
+
     ////////////////////////////////////////////////////////////
     /// \brief Return the value of the invalid socket
     ///
@@ -111,6 +247,22 @@ public:
     ////////////////////////////////////////////////////////////
     static void setBlocking(SocketHandle sock, bool block);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Accept a new connection on a listening socket
+    ///
+    /// The new socket is created close-on-exec (where the system
+    /// supports it) and in the requested blocking mode. Where
+    /// `accept4` is available, this takes a single system call.
+    ///
+    /// \param listener Handle of the listening socket
+    /// \param address  Filled with the address of the peer
+    /// \param block    Blocking state of the new socket
+    ///
+    /// \return Handle of the new socket, or the invalid socket if accepting failed
+    ///
+    ////////////////////////////////////////////////////////////
+    static SocketHandle accept(SocketHandle listener, Address& address, bool block);
+
     ////////////////////////////////////////////////////////////
     /// Get the last socket error status
     ///
@@ -118,6 +270,59 @@ public:
     ///
     ////////////////////////////////////////////////////////////
     static Socket::Status getErrorStatus();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Send several buffers with a single system call
+    ///
+    /// The buffers are sent in order as if they were a single
+    /// contiguous block (sendmsg on POSIX, WSASend on Windows).
+    /// Only the first `maxBuffers` buffers are considered.
+    ///
+    /// \param sock    Handle of the socket
+    /// \param buffers Buffers to send
+    /// \param count   Number of buffers
+    /// \param flags   Flags passed to the system call
+    ///
+    /// \return Number of bytes sent, or -1 on error
+    ///
+    ////////////////////////////////////////////////////////////
+    static std::int64_t sendBuffers(SocketHandle sock, const Buffer* buffers, std::size_t count, int flags);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Wait for events on several sockets
+    ///
+    /// The descriptors are those of poll on POSIX and WSAPoll on
+    /// Windows, their `revents` member receives the events which
+    /// occurred.
+    ///
+    /// \param descriptors Sockets to watch and events to wait for
+    /// \param count       Number of descriptors
+    /// \param timeout     Maximum time to wait, in milliseconds (-1 for infinity)
+    ///
+    /// \return Number of descriptors with events, 0 on timeout or -1 on error
+    ///
+    ////////////////////////////////////////////////////////////
+    static int poll(PollDescriptor* descriptors, std::size_t count, int timeout);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Convert a timeout to the milliseconds expected by `poll`
+    ///
+    /// The timeout is rounded up, so that short timeouts don't
+    /// turn into busy polling.
+    ///
+    /// \param timeout Timeout to convert, `Time::Zero` for infinity
+    ///
+    /// \return Timeout in milliseconds, -1 for infinity
+    ///
+    ////////////////////////////////////////////////////////////
+    static int getPollTimeout(Time timeout)
+    {
+        if (timeout == Time::Zero)
+            return -1;
+
+        const auto milliseconds = (timeout.asMicroseconds() + 999) / 1000;
+        return static_cast<int>(std::clamp<std::int64_t>(milliseconds, 0, std::numeric_limits<int>::max()));
+    }
 };
 
 } // namespace sf::priv
@@ -25,6 +25,7 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <SFML/Network/BufferedSockets.hpp>
 #include <SFML/Network/Socket.hpp>
 #include <SFML/Network/SocketImpl.hpp>
 #include <SFML/Network/SocketSelector.hpp>
@@ -32,31 +33,299 @@
 #include <SFML/System/Err.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <ostream>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
-#ifdef _MSC_VER
-#pragma warning(disable : 4127) // "conditional expression is constant" generated by the FD_SET macro
+#if defined(SFML_SYSTEM_LINUX) || defined(SFML_SYSTEM_ANDROID)
+#define SFML_SOCKET_SELECTOR_EPOLL
+#include <sys/epoll.h>
+
+#include <cerrno>
 #endif
 
 
+namespace
+{
+// Sockets holding data already read from the operating system, shared by all the selectors
+struct BufferedSockets
+{
+    std::mutex                    mutex;
+    std::vector<sf::SocketHandle> handles;
+    std::atomic<bool>             empty{true}; //!< Lets waits skip the lock in the usual case
+};
+
+BufferedSockets& getBufferedSocketsRegistry()
+{
+    static BufferedSockets bufferedSockets;
+    return bufferedSockets;
+}
+
+} // namespace
+
+
 namespace sf
 {
+namespace priv
+{
+////////////////////////////////////////////////////////////
+void setSocketBuffered(SocketHandle handle, bool buffered)
+{
+    auto&                 registry = getBufferedSocketsRegistry();
+    const std::lock_guard lock(registry.mutex);
+
+    const auto iter = std::find(registry.handles.begin(), registry.handles.end(), handle);
+    if (buffered && (iter == registry.handles.end()))
+        registry.handles.push_back(handle);
+    else if (!buffered && (iter != registry.handles.end()))
+        registry.handles.erase(iter);
+
+    registry.empty = registry.handles.empty();
+}
+
+
+////////////////////////////////////////////////////////////
+void getBufferedSockets(std::vector<SocketHandle>& handles)
+{
+    handles.clear();
+
+    auto& registry = getBufferedSocketsRegistry();
+    if (registry.empty)
+        return;
+
+    const std::lock_guard lock(registry.mutex);
+    handles = registry.handles;
+}
+
+} // namespace priv
+
+
 ////////////////////////////////////////////////////////////
 struct SocketSelector::SocketSelectorImpl
 {
-    fd_set allSockets{};   //!< Set containing all the sockets handles
-    fd_set socketsReady{}; //!< Set containing handles of the sockets that are ready
-    int    maxSocket{};    //!< Maximum socket handle
-    int    socketCount{};  //!< Number of socket handles
+    struct Entry
+    {
+        Socket*     socket{}; //!< Socket as it was passed to add
+        bool        ready{};  //!< Whether the last wait reported the socket as ready
+#if !defined(SFML_SOCKET_SELECTOR_EPOLL)
+        std::size_t index{}; //!< Position of the socket in the poll descriptors
+#endif
+    };
+
+    SocketSelectorImpl()
+    {
+#if defined(SFML_SOCKET_SELECTOR_EPOLL)
+        epollHandle = epoll_create1(EPOLL_CLOEXEC);
+
+        if (epollHandle == -1)
+            err() << "Failed to create the socket selector's epoll instance" << std::endl;
+#endif
+    }
+
+    SocketSelectorImpl(const SocketSelectorImpl& copy) : SocketSelectorImpl()
+    {
+        edgeTriggered = copy.edgeTriggered;
+
+        for (const auto& [handle, entry] : copy.sockets)
+            add(handle, *entry.socket);
+
+        for (const auto handle : copy.readyHandles)
+            markReady(handle);
+    }
+
+    SocketSelectorImpl& operator=(const SocketSelectorImpl&) = delete;
+
+    ~SocketSelectorImpl()
+    {
+#if defined(SFML_SOCKET_SELECTOR_EPOLL)
+        if (epollHandle != -1)
+            ::close(epollHandle);
+#endif
+    }
+
+    void add(SocketHandle handle, Socket& socket)
+    {
+        const auto [iter, inserted] = sockets.try_emplace(handle);
+
+        // A socket with the same handle may have been closed without being removed
+        iter->second.socket = &socket;
+
+#if defined(SFML_SOCKET_SELECTOR_EPOLL)
+        epoll_event event = makeEvent(handle);
+
+        // Register the handle even if it is already known: when a socket is closed without being removed,
+        // the kernel drops it from the interest list and its handle may be reused by the socket added now.
+        // If the socket was simply added twice, epoll still knows it.
+        if ((epoll_ctl(epollHandle, EPOLL_CTL_ADD, handle, &event) == -1) &&
+            ((errno != EEXIST) || (epoll_ctl(epollHandle, EPOLL_CTL_MOD, handle, &event) == -1)))
+        {
+            err() << "The socket can't be added to the selector" << std::endl;
+            remove(handle);
+        }
+#else
+        // poll watches the handle itself, whichever socket it belongs to now
+        if (!inserted)
+            return;
+
+        iter->second.index = pollDescriptors.size();
+
+        priv::SocketImpl::PollDescriptor descriptor{};
+        descriptor.fd     = handle;
+        descriptor.events = POLLIN;
+        pollDescriptors.push_back(descriptor);
+#endif
+    }
+
+    void remove(SocketHandle handle)
+    {
+        const auto iter = sockets.find(handle);
+        if (iter == sockets.end())
+            return;
+
+        if (iter->second.ready)
+        {
+            const auto index = std::find(readyHandles.begin(), readyHandles.end(), handle) - readyHandles.begin();
+            readyHandles.erase(readyHandles.begin() + index);
+            readySockets.erase(readySockets.begin() + index);
+        }
+
+#if defined(SFML_SOCKET_SELECTOR_EPOLL)
+        // This fails if the handle was already closed, in which case epoll forgot it anyway
+        epoll_event event{};
+        epoll_ctl(epollHandle, EPOLL_CTL_DEL, handle, &event);
+#else
+        // Move the last descriptor into the freed slot
+        const auto index = iter->second.index;
+        if (index + 1 != pollDescriptors.size())
+        {
+            pollDescriptors[index]                   = pollDescriptors.back();
+            sockets[pollDescriptors[index].fd].index = index;
+        }
+
+        pollDescriptors.pop_back();
+#endif
+
+        sockets.erase(iter);
+    }
+
+    void clear()
+    {
+#if defined(SFML_SOCKET_SELECTOR_EPOLL)
+        for (const auto& [handle, entry] : sockets)
+        {
+            epoll_event event{};
+            epoll_ctl(epollHandle, EPOLL_CTL_DEL, handle, &event);
+        }
+#else
+        pollDescriptors.clear();
+#endif
+
+        sockets.clear();
+        readySockets.clear();
+        readyHandles.clear();
+    }
+
+    bool wait(Time timeout)
+    {
+        // Forget the result of the previous wait
+        for (const auto handle : readyHandles)
+            sockets[handle].ready = false;
+
+        readySockets.clear();
+        readyHandles.clear();
+
+        // Sockets holding data they already read from the operating system (e.g. TLS records)
+        // are ready even if the operating system doesn't say so, don't block if we watch any
+        priv::getBufferedSockets(bufferedHandles);
+        for (const auto handle : bufferedHandles)
+            markReady(handle);
+
+        const int milliseconds = readySockets.empty() ? priv::SocketImpl::getPollTimeout(timeout) : 0;
+
+#if defined(SFML_SOCKET_SELECTOR_EPOLL)
+        if (epollHandle == -1)
+            return !readySockets.empty();
+
+        events.resize(std::max<std::size_t>(sockets.size(), 1));
+
+        const int count = epoll_wait(epollHandle, events.data(), static_cast<int>(events.size()), milliseconds);
+
+        for (int i = 0; i < count; ++i)
+            markReady(events[static_cast<std::size_t>(i)].data.fd);
+#else
+        const int count = priv::SocketImpl::poll(pollDescriptors.data(), pollDescriptors.size(), milliseconds);
+
+        for (std::size_t i = 0; (count > 0) && (i < pollDescriptors.size()); ++i)
+        {
+            // Closed handles are reported as invalid, they are never ready
+            if ((pollDescriptors[i].revents != 0) && !(pollDescriptors[i].revents & POLLNVAL))
+                markReady(pollDescriptors[i].fd);
+        }
+#endif
+
+        return !readySockets.empty();
+    }
+
+    void markReady(SocketHandle handle)
+    {
+        const auto iter = sockets.find(handle);
+        if (iter == sockets.end() || iter->second.ready)
+            return;
+
+        iter->second.ready = true;
+        readySockets.push_back(iter->second.socket);
+        readyHandles.push_back(handle);
+    }
+
+#if defined(SFML_SOCKET_SELECTOR_EPOLL)
+    [[nodiscard]] epoll_event makeEvent(SocketHandle handle) const
+    {
+        epoll_event event{};
+        event.events  = EPOLLIN | (edgeTriggered ? EPOLLET : 0u);
+        event.data.fd = handle;
+        return event;
+    }
+
+    void setEdgeTriggered(bool enabled)
+    {
+        edgeTriggered = enabled;
+
+        for (const auto& [handle, entry] : sockets)
+        {
+            epoll_event event = makeEvent(handle);
+            if (epoll_ctl(epollHandle, EPOLL_CTL_MOD, handle, &event) == -1)
+                err() << "Failed to change the readiness mode of a socket in the selector" << std::endl;
+        }
+    }
+#else
+    void setEdgeTriggered(bool enabled)
+    {
+        // poll has no edge-triggered mode, level-triggered readiness is a superset of it
+        edgeTriggered = enabled;
+    }
+#endif
+
+    std::unordered_map<SocketHandle, Entry> sockets;         //!< Sockets in the selector, by handle
+    std::vector<Socket*>                    readySockets;    //!< Sockets reported as ready by the last wait
+    std::vector<SocketHandle>               readyHandles;    //!< Handles of the ready sockets, in the same order
+    std::vector<SocketHandle>               bufferedHandles; //!< Handles of the sockets holding buffered data
+    bool                                    edgeTriggered{}; //!< Only report sockets when they become ready
+#if defined(SFML_SOCKET_SELECTOR_EPOLL)
+    int                      epollHandle{-1}; //!< The epoll instance watching the sockets
+    std::vector<epoll_event> events;          //!< Buffer receiving the events of a wait
+#else
+    std::vector<priv::SocketImpl::PollDescriptor> pollDescriptors; //!< Descriptors passed to poll, one per socket
+#endif
 };
 
 
 ////////////////////////////////////////////////////////////
 SocketSelector::SocketSelector() : m_impl(std::make_unique<SocketSelectorImpl>())
 {
-    clear();
 }
 
 
@@ -92,40 +361,7 @@ void SocketSelector::add(Socket& socket)
 {
     const SocketHandle handle = socket.getNativeHandle();
     if (handle != priv::SocketImpl::invalidSocket())
-    {
-
-#if defined(SFML_SYSTEM_WINDOWS)
-
-        if (m_impl->socketCount >= FD_SETSIZE)
-        {
-            err() << "The socket can't be added to the selector because the "
-                  << "selector is full. This is a limitation of your operating "
-                  << "system's FD_SETSIZE setting.";
-            return;
-        }
-
-        if (FD_ISSET(handle, &m_impl->allSockets))
-            return;
-
-        ++m_impl->socketCount;
-
-#else
-
-        if (handle >= FD_SETSIZE)
-        {
-            err() << "The socket can't be added to the selector because its "
-                  << "ID is too high. This is a limitation of your operating "
-                  << "system's FD_SETSIZE setting.";
-            return;
-        }
-
-        // SocketHandle is an int in POSIX
-        m_impl->maxSocket = std::max(m_impl->maxSocket, handle);
-
-#endif
-
-        FD_SET(handle, &m_impl->allSockets);
-    }
+        m_impl->add(handle, socket);
 }
 
 
@@ -134,55 +370,35 @@ void SocketSelector::remove(Socket& socket)
 {
     const SocketHandle handle = socket.getNativeHandle();
     if (handle != priv::SocketImpl::invalidSocket())
-    {
-
-#if defined(SFML_SYSTEM_WINDOWS)
-
-        if (!FD_ISSET(handle, &m_impl->allSockets))
-            return;
-
-        --m_impl->socketCount;
+        m_impl->remove(handle);
+}
 
-#else
 
-        if (handle >= FD_SETSIZE)
-            return;
+////////////////////////////////////////////////////////////
+void SocketSelector::clear()
+{
+    m_impl->clear();
+}
 
-#endif
 
-        FD_CLR(handle, &m_impl->allSockets);
-        FD_CLR(handle, &m_impl->socketsReady);
-    }
+////////////////////////////////////////////////////////////
+void SocketSelector::setEdgeTriggered(bool edgeTriggered)
+{
+    m_impl->setEdgeTriggered(edgeTriggered);
 }
 
 
 ////////////////////////////////////////////////////////////
-void SocketSelector::clear()
+bool SocketSelector::isEdgeTriggered() const
 {
-    FD_ZERO(&m_impl->allSockets);
-    FD_ZERO(&m_impl->socketsReady);
-
-    m_impl->maxSocket   = 0;
-    m_impl->socketCount = 0;
+    return m_impl->edgeTriggered;
 }
 
 
 ////////////////////////////////////////////////////////////
 bool SocketSelector::wait(Time timeout)
 {
-    // Setup the timeout
-    timeval time{};
-    time.tv_sec  = static_cast<long>(timeout.asMicroseconds() / 1'000'000);
-    time.tv_usec = static_cast<int>(timeout.asMicroseconds() % 1'000'000);
-
-    // Initialize the set that will contain the sockets that are ready
-    m_impl->socketsReady = m_impl->allSockets;
-
-    // Wait until one of the sockets is ready for reading, or timeout is reached
-    // The first parameter is ignored on Windows
-    const int count = select(m_impl->maxSocket + 1, &m_impl->socketsReady, nullptr, nullptr, timeout != Time::Zero ? &time : nullptr);
-
-    return count > 0;
+    return m_impl->wait(timeout);
 }
 
 
@@ -192,18 +408,18 @@ bool SocketSelector::isReady(Socket& socket) const
     const SocketHandle handle = socket.getNativeHandle();
     if (handle != priv::SocketImpl::invalidSocket())
     {
-
-#if !defined(SFML_SYSTEM_WINDOWS)
-
-        if (handle >= FD_SETSIZE)
-            return false;
-
-#endif
-
-        return FD_ISSET(handle, &m_impl->socketsReady) != 0;
+        const auto iter = m_impl->sockets.find(handle);
+        return (iter != m_impl->sockets.end()) && iter->second.ready;
     }
 
     return false;
 }
 
+
+////////////////////////////////////////////////////////////
+const std::vector<Socket*>& SocketSelector::getReadySockets() const
+{
+    return m_impl->readySockets;
+}
+
 } // namespace sf
@@ -31,6 +31,7 @@
 
 #include <SFML/System/Err.hpp>
 
+#include <algorithm>
 #include <ostream>
 
 
@@ -48,11 +49,10 @@ unsigned short TcpListener::getLocalPort() const
     if (getNativeHandle() != priv::SocketImpl::invalidSocket())
     {
         // Retrieve information about the local end of the socket
-        sockaddr_in                  address{};
-        priv::SocketImpl::AddrLength size = sizeof(address);
-        if (getsockname(getNativeHandle(), reinterpret_cast<sockaddr*>(&address), &size) != -1)
+        priv::SocketImpl::Address address;
+        if (getsockname(getNativeHandle(), address.get(), &address.length) != -1)
         {
-            return ntohs(address.sin_port);
+            return priv::SocketImpl::getPort(*address.get());
         }
     }
 
@@ -62,21 +62,21 @@ unsigned short TcpListener::getLocalPort() const
 
 
 ////////////////////////////////////////////////////////////
-Socket::Status TcpListener::listen(unsigned short port, IpAddress address)
+Socket::Status TcpListener::listen(unsigned short port, IpAddress address, int backlog)
 {
     // Close the socket if it is already bound
     close();
 
-    // Create the internal socket if it doesn't exist
-    create();
+    // Create the internal socket if it doesn't exist, using the family of the address
+    create(address.getType());
 
     // Check if the address is valid
     if (address == IpAddress::Broadcast)
         return Status::Error;
 
     // Bind the socket to the specified port
-    sockaddr_in addr = priv::SocketImpl::createAddress(address.toInteger(), port);
-    if (bind(getNativeHandle(), reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) == -1)
+    priv::SocketImpl::Address addr = priv::SocketImpl::createAddress(address, port, address.getType());
+    if (bind(getNativeHandle(), addr.get(), addr.length) == -1)
     {
         // Not likely to happen, but...
         err() << "Failed to bind listener socket to port " << port << std::endl;
@@ -84,7 +84,7 @@ Socket::Status TcpListener::listen(unsigned short port, IpAddress address)
     }
 
     // Listen to the bound port
-    if (::listen(getNativeHandle(), SOMAXCONN) == -1)
+    if (::listen(getNativeHandle(), backlog) == -1)
     {
         // Oops, socket is deaf
         err() << "Failed to listen to port " << port << std::endl;
@@ -95,6 +95,35 @@ Socket::Status TcpListener::listen(unsigned short port, IpAddress address)
 }
 
 
+////////////////////////////////////////////////////////////
+std::vector<TcpListener> TcpListener::createShards(std::size_t    count,
+                                                   unsigned short port,
+                                                   IpAddress      address,
+                                                   int            backlog)
+{
+#ifndef SO_REUSEPORT
+    // Without port reuse, only one listener can be bound to the port
+    count = std::min(count, std::size_t{1});
+#endif
+
+    std::vector<TcpListener> listeners(count);
+    for (TcpListener& listener : listeners)
+    {
+#ifdef SO_REUSEPORT
+        listener.setReusePort(true);
+#endif
+
+        if (listener.listen(port, address, backlog) != Status::Done)
+            return {};
+
+        // The next listeners share the port chosen for the first one
+        port = listener.getLocalPort();
+    }
+
+    return listeners;
+}
+
+
 ////////////////////////////////////////////////////////////
 void TcpListener::close()
 {
@@ -113,10 +142,9 @@ Socket::Status TcpListener::accept(TcpSocket& socket)
         return Status::Error;
     }
 
-    // Accept a new connection
-    sockaddr_in                  address{};
-    priv::SocketImpl::AddrLength length = sizeof(address);
-    const SocketHandle           remote = ::accept(getNativeHandle(), reinterpret_cast<sockaddr*>(&address), &length);
+    // Accept a new connection, directly in the blocking state of the target socket
+    priv::SocketImpl::Address address;
+    const SocketHandle        remote = priv::SocketImpl::accept(getNativeHandle(), address, socket.isBlocking());
 
     // Check for errors
     if (remote == priv::SocketImpl::invalidSocket())
@@ -124,7 +152,7 @@ Socket::Status TcpListener::accept(TcpSocket& socket)
 
     // Initialize the new connected socket
     socket.close();
-    socket.create(remote);
+    socket.create(remote, getAddressType(), true);
 
     return Status::Done;
 }
@@ -30,6 +30,7 @@
 #include <SFML/Network/SocketImpl.hpp>
 #include <SFML/Network/TcpSocket.hpp>
 
+#include <SFML/System/Clock.hpp>
 #include <SFML/System/Err.hpp>
 #include <SFML/System/String.hpp>
 
@@ -41,6 +42,14 @@
 #include <mbedtls/error.h>
 #include <mbedtls/net_sockets.h>
 #include <mbedtls/ssl.h>
+#if defined(MBEDTLS_SSL_CACHE_C)
+#include <mbedtls/ssl_cache.h>
+#endif
+// Session tickets are only set up with the Mbed TLS 3.x.x and earlier API
+#if defined(MBEDTLS_SSL_TICKET_C) && defined(MBEDTLS_SSL_SESSION_TICKETS) && (MBEDTLS_VERSION_MAJOR < 4)
+#define SFML_TLS_SESSION_TICKETS
+#include <mbedtls/ssl_ticket.h>
+#endif
 
 #if defined(SFML_SYSTEM_WINDOWS)
 #include <wincrypt.h>
@@ -54,9 +63,15 @@
 #include <algorithm>
 #include <array>
 #include <filesystem>
+#include <functional>
+#include <limits>
+#include <memory>
 #include <mutex>
 #include <optional>
 #include <ostream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
 
 #include <cassert>
 #include <cstring>
@@ -75,6 +90,115 @@ constexpr int flags = MSG_NOSIGNAL;
 constexpr int flags = 0;
 #endif
 
+////////////////////////////////////////////////////////////
+// A size-prefixed packet on its way to the remote peer
+////////////////////////////////////////////////////////////
+struct OutgoingPacket
+{
+    std::uint32_t    size{};     // Size of the packet data, in network byte order
+    const std::byte* data{};     // Packet data, as returned by Packet::onSend
+    std::size_t      dataSize{}; // Size of the packet data, in bytes
+};
+
+std::size_t wireSize(const OutgoingPacket& packet)
+{
+    return sizeof(packet.size) + packet.dataSize;
+}
+
+// Skip `count` bytes of the stream formed by [begin, end), `offset` being
+// the number of bytes of `*begin` which have already been sent
+void consume(const OutgoingPacket*& begin, const OutgoingPacket* end, std::size_t& offset, std::size_t count)
+{
+    while ((begin != end) && (count >= wireSize(*begin) - offset))
+    {
+        count -= wireSize(*begin) - offset;
+        offset = 0;
+        ++begin;
+    }
+
+    offset += count;
+}
+
+// Copy the unsent part of [begin, end) into a single contiguous block
+void flatten(std::vector<std::byte>& block, const OutgoingPacket* begin, const OutgoingPacket* end, std::size_t offset)
+{
+    std::size_t size = 0;
+    for (const auto* packet = begin; packet != end; ++packet)
+        size += wireSize(*packet);
+
+    block.resize(size);
+
+    std::byte* out = block.data();
+    for (const auto* packet = begin; packet != end; ++packet)
+    {
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wnull-dereference" // False positive.
+        std::memcpy(out, &packet->size, sizeof(packet->size));
+#pragma GCC diagnostic pop
+        if (packet->dataSize > 0)
+            std::memcpy(out + sizeof(packet->size), packet->data, packet->dataSize);
+
+        out += wireSize(*packet);
+    }
+
+    block.erase(block.begin(), block.begin() + static_cast<std::ptrdiff_t>(offset));
+}
+
+// Send the unsent part of [begin, end) straight from the packets' own memory,
+// gathering as many of them as possible into each system call
+sf::Socket::Status sendGathered(sf::SocketHandle       handle,
+                                const OutgoingPacket*& begin,
+                                const OutgoingPacket*  end,
+                                std::size_t&           offset,
+                                std::uint64_t&         calls,
+                                std::uint64_t&         bytes)
+{
+    using sf::priv::SocketImpl;
+
+    bool progress = false;
+
+    while (begin != end)
+    {
+        std::array<SocketImpl::Buffer, SocketImpl::maxBuffers> buffers;
+        std::size_t                                            count = 0;
+        std::size_t                                            skip  = offset;
+
+        for (const auto* packet = begin; (packet != end) && (count + 2 <= buffers.size()); ++packet)
+        {
+            const std::size_t headerSkip = std::min(skip, sizeof(packet->size));
+            const std::size_t dataSkip   = skip - headerSkip;
+
+            if (headerSkip < sizeof(packet->size))
+                buffers[count++] = {reinterpret_cast<const std::byte*>(&packet->size) + headerSkip,
+                                    sizeof(packet->size) - headerSkip};
+
+            if (dataSkip < packet->dataSize)
+                buffers[count++] = {packet->data + dataSkip, packet->dataSize - dataSkip};
+
+            skip = 0;
+        }
+
+        const std::int64_t result = SocketImpl::sendBuffers(handle, buffers.data(), count, flags);
+        ++calls;
+
+        if (result < 0)
+        {
+            const sf::Socket::Status status = SocketImpl::getErrorStatus();
+
+            if ((status == sf::Socket::Status::NotReady) && progress)
+                return sf::Socket::Status::Partial;
+
+            return status;
+        }
+
+        progress = progress || (result > 0);
+        bytes += static_cast<std::uint64_t>(result);
+        consume(begin, end, offset, static_cast<std::size_t>(result));
+    }
+
+    return sf::Socket::Status::Done;
+}
+
 std::string tlsErrorString(int errnum)
 {
     std::array<char, 1024> buffer{};
@@ -365,6 +489,346 @@ struct MbedTlsSharedState
 };
 
 [[maybe_unused]] MbedTlsSharedState mbedTlsSharedState;
+
+// Certificates of the system store, parsed by the first client socket which needs them and then shared by all
+// Once loaded they are never modified, so that any number of sockets can use them concurrently
+struct SystemCertificates
+{
+    SystemCertificates()
+    {
+        mbedtls_x509_crt_init(&x509Crt);
+        mbedtls_x509_crl_init(&x509Crl);
+    }
+
+    ~SystemCertificates()
+    {
+        mbedtls_x509_crl_free(&x509Crl);
+        mbedtls_x509_crt_free(&x509Crt);
+    }
+
+    bool load()
+    {
+        const std::lock_guard lock(mutex);
+
+        if (!loaded)
+        {
+            loaded = loadSystemCertificates(&x509Crt, &x509Crl);
+
+            // Drop whatever was partially loaded, the next socket will try again
+            if (!loaded)
+            {
+                mbedtls_x509_crl_free(&x509Crl);
+                mbedtls_x509_crt_free(&x509Crt);
+                mbedtls_x509_crt_init(&x509Crt);
+                mbedtls_x509_crl_init(&x509Crl);
+            }
+        }
+
+        return loaded;
+    }
+
+    std::mutex       mutex;
+    bool             loaded{};
+    mbedtls_x509_crt x509Crt{};
+    mbedtls_x509_crl x509Crl{};
+};
+
+SystemCertificates& getSystemCertificates()
+{
+    static SystemCertificates systemCertificates;
+    return systemCertificates;
+}
+
+// Sessions of client connections, kept to resume them when connecting to the same server again
+struct ClientSessionCache
+{
+    struct Session
+    {
+        Session()
+        {
+            mbedtls_ssl_session_init(&session);
+        }
+
+        ~Session()
+        {
+            mbedtls_ssl_session_free(&session);
+        }
+
+        Session(const Session&)            = delete;
+        Session& operator=(const Session&) = delete;
+
+        mbedtls_ssl_session session{};
+    };
+
+    static constexpr std::size_t maxSessions = 256;
+
+    void store(const std::string& key, const mbedtls_ssl_context& sslContext)
+    {
+        // This fails if there is nothing to resume, e.g. before a TLS 1.3 server sent a session ticket
+        auto session = std::make_unique<Session>();
+        if (mbedtls_ssl_get_session(&sslContext, &session->session) != 0)
+            return;
+
+        const std::lock_guard lock(mutex);
+
+        if ((sessions.size() >= maxSessions) && (sessions.find(key) == sessions.end()))
+            sessions.erase(sessions.begin());
+
+        sessions[key] = std::move(session);
+    }
+
+    void restore(const std::string& key, mbedtls_ssl_context& sslContext)
+    {
+        const std::lock_guard lock(mutex);
+
+        const auto iter = sessions.find(key);
+        if (iter == sessions.end())
+            return;
+
+        // The session is copied into the context, forget it if it can't be used anymore
+        if (mbedtls_ssl_set_session(&sslContext, &iter->second->session) != 0)
+            sessions.erase(iter);
+    }
+
+    std::mutex                                                mutex;
+    std::unordered_map<std::string, std::unique_ptr<Session>> sessions;
+};
+
+ClientSessionCache& getClientSessionCache()
+{
+    static ClientSessionCache clientSessionCache;
+    return clientSessionCache;
+}
+
+// A session must only be resumed by a connection which would have accepted the server that established it,
+// so the key identifies the server as well as how it was verified
+std::string makeSessionKey(const sf::String& hostname,
+                           unsigned short    port,
+                           bool              verifyPeer,
+                           const std::byte*  certificateChainData,
+                           std::size_t       certificateChainSize)
+{
+    const std::string_view certificateChain(reinterpret_cast<const char*>(certificateChainData), certificateChainSize);
+
+    std::string key(reinterpret_cast<const char*>(hostname.toUtf8().c_str()));
+    key += ':' + std::to_string(port) + (verifyPeer ? ":verified:" : ":unverified:");
+    key += std::to_string(std::hash<std::string_view>()(certificateChain));
+    return key;
+}
+
+// Parse a provided certificate chain, reporting why it couldn't be loaded entirely
+bool parseCertificateChain(mbedtls_x509_crt& x509Crt, const std::byte* data, std::size_t size)
+{
+    const auto result = mbedtls_x509_crt_parse(&x509Crt, reinterpret_cast<const unsigned char*>(data), size);
+
+    if (result < 0)
+    {
+        sf::err() << "Failed to load provided certificate chain: " << tlsErrorString(result) << std::endl;
+    }
+    else if (result == 1)
+    {
+        sf::err() << "Only 1 certificate could be loaded from provided certificate chain" << std::endl;
+    }
+    else if (result > 1)
+    {
+        sf::err() << "Only " << result << " certificates could be loaded from provided certificate chain" << std::endl;
+    }
+
+    return result == 0;
+}
+
+// Chains of trusted certificates made of a provided chain followed by the system certificates, built by the first
+// client socket which trusts the provided chain and then shared by all. Once built they are never modified.
+struct TrustedChainCache
+{
+    struct Chain
+    {
+        Chain()
+        {
+            mbedtls_x509_crt_init(&x509Crt);
+        }
+
+        ~Chain()
+        {
+            mbedtls_x509_crt_free(&x509Crt);
+        }
+
+        Chain(const Chain&)            = delete;
+        Chain& operator=(const Chain&) = delete;
+
+        mbedtls_x509_crt x509Crt{};
+    };
+
+    static constexpr std::size_t maxChains = 16;
+
+    std::shared_ptr<Chain> get(const std::byte* data, std::size_t size, const mbedtls_x509_crt& systemCertificates)
+    {
+        const std::string     key(reinterpret_cast<const char*>(data), size);
+        const std::lock_guard lock(mutex);
+
+        if (const auto iter = chains.find(key); iter != chains.end())
+            return iter->second;
+
+        auto chain = std::make_shared<Chain>();
+        if (!parseCertificateChain(chain->x509Crt, data, size))
+            return nullptr;
+
+        // Append the system certificates, referencing their shared data
+        for (const auto* certificate = &systemCertificates; (certificate != nullptr) && (certificate->raw.p != nullptr);
+             certificate             = certificate->next)
+            mbedtls_x509_crt_parse_der_nocopy(&chain->x509Crt, certificate->raw.p, certificate->raw.len);
+
+        // Sockets still using an evicted chain keep it alive
+        if (chains.size() >= maxChains)
+            chains.erase(chains.begin());
+
+        chains.emplace(key, chain);
+        return chain;
+    }
+
+    std::mutex                                              mutex;
+    std::unordered_map<std::string, std::shared_ptr<Chain>> chains;
+};
+
+TrustedChainCache& getTrustedChainCache()
+{
+    static TrustedChainCache trustedChainCache;
+    return trustedChainCache;
+}
+
+// Session state shared by all server sockets, so that clients can resume their session on any of them
+struct ServerSessionCache
+{
+    // Passed to the callbacks of each server connection, to tell whether it resumed a session
+    struct Connection
+    {
+        ServerSessionCache* cache{};
+        bool                resumed{};
+    };
+
+    ServerSessionCache()
+    {
+#if defined(MBEDTLS_SSL_CACHE_C)
+        mbedtls_ssl_cache_init(&cache);
+#endif
+
+#if defined(SFML_TLS_SESSION_TICKETS)
+        mbedtls_ssl_ticket_init(&ticketContext);
+
+        if (auto result = mbedtls_ssl_ticket_setup(&ticketContext,
+                                                   mbedtls_ctr_drbg_random,
+                                                   &mbedTlsSharedState.ctrDrbgContext,
+                                                   MBEDTLS_CIPHER_AES_256_GCM,
+                                                   ticketLifetime);
+            result != 0)
+        {
+            sf::err() << "Failed to set up TLS session tickets: " << tlsErrorString(result) << std::endl;
+        }
+        else
+        {
+            ticketsEnabled = true;
+        }
+#endif
+    }
+
+    ~ServerSessionCache()
+    {
+#if defined(SFML_TLS_SESSION_TICKETS)
+        mbedtls_ssl_ticket_free(&ticketContext);
+#endif
+
+#if defined(MBEDTLS_SSL_CACHE_C)
+        mbedtls_ssl_cache_free(&cache);
+#endif
+    }
+
+    void configure([[maybe_unused]] mbedtls_ssl_config& sslConfig, Connection& connection)
+    {
+        connection.cache = this;
+
+        // Look sessions up through the connection, so that it knows when one is found
+#if defined(MBEDTLS_SSL_CACHE_C)
+#if (MBEDTLS_VERSION_MAJOR >= 3)
+        mbedtls_ssl_conf_session_cache(
+            &sslConfig,
+            &connection,
+            [](void* data, const unsigned char* sessionId, std::size_t sessionIdLength, mbedtls_ssl_session* session)
+            {
+                auto&     context = *static_cast<Connection*>(data);
+                const int result  = mbedtls_ssl_cache_get(&context.cache->cache, sessionId, sessionIdLength, session);
+                context.resumed |= (result == 0);
+                return result;
+            },
+            [](void*                      data,
+               const unsigned char*       sessionId,
+               std::size_t                sessionIdLength,
+               const mbedtls_ssl_session* session)
+            {
+                auto& context = *static_cast<Connection*>(data);
+                return mbedtls_ssl_cache_set(&context.cache->cache, sessionId, sessionIdLength, session);
+            });
+#else
+        mbedtls_ssl_conf_session_cache(
+            &sslConfig,
+            &connection,
+            [](void* data, mbedtls_ssl_session* session)
+            {
+                auto&     context = *static_cast<Connection*>(data);
+                const int result  = mbedtls_ssl_cache_get(&context.cache->cache, session);
+                context.resumed |= (result == 0);
+                return result;
+            },
+            [](void* data, const mbedtls_ssl_session* session)
+            {
+                auto& context = *static_cast<Connection*>(data);
+                return mbedtls_ssl_cache_set(&context.cache->cache, session);
+            });
+#endif
+#endif
+
+#if defined(SFML_TLS_SESSION_TICKETS)
+        if (ticketsEnabled)
+            mbedtls_ssl_conf_session_tickets_cb(
+                &sslConfig,
+                [](void*                      data,
+                   const mbedtls_ssl_session* session,
+                   unsigned char*             start,
+                   const unsigned char*       end,
+                   std::size_t*               length,
+                   std::uint32_t*             lifetime)
+                {
+                    auto& tickets = static_cast<Connection*>(data)->cache->ticketContext;
+                    return mbedtls_ssl_ticket_write(&tickets, session, start, end, length, lifetime);
+                },
+                [](void* data, mbedtls_ssl_session* session, unsigned char* buffer, std::size_t length)
+                {
+                    auto&     context = *static_cast<Connection*>(data);
+                    auto&     tickets = context.cache->ticketContext;
+                    const int result  = mbedtls_ssl_ticket_parse(&tickets, session, buffer, length);
+                    context.resumed |= (result == 0);
+                    return result;
+                },
+                &connection);
+#endif
+    }
+
+#if defined(MBEDTLS_SSL_CACHE_C)
+    mbedtls_ssl_cache_context cache{};
+#endif
+
+#if defined(SFML_TLS_SESSION_TICKETS)
+    static constexpr std::uint32_t ticketLifetime = 86400; // Seconds
+
+    mbedtls_ssl_ticket_context ticketContext{};
+    bool                       ticketsEnabled{};
+#endif
+};
+
+ServerSessionCache& getServerSessionCache()
+{
+    static ServerSessionCache serverSessionCache;
+    return serverSessionCache;
+}
 } // namespace
 
 namespace sf
@@ -391,44 +855,41 @@ struct TcpSocket::Impl
             // Construct new TLS state
             auto& state = tlsState.emplace();
 
-            // Load user-provided certificate data
-            if (certificateChainData != nullptr && certificateChainSize > 0)
-            {
-                if (auto result = mbedtls_x509_crt_parse(&state.x509Crt,
-                                                         reinterpret_cast<const unsigned char*>(certificateChainData),
-                                                         certificateChainSize);
-                    result != 0)
-                {
-                    if (result < 0)
-                    {
-                        err() << "Failed to load provided certificate chain: " << tlsErrorString(result) << std::endl;
-                    }
-                    else if (result == 1)
-                    {
-                        err() << "Only 1 certificate could be loaded from provided certificate chain" << std::endl;
-                    }
-                    else
-                    {
-                        err() << "Only " << result << " certificates could be loaded from provided certificate chain"
-                              << std::endl;
-                    }
+            const auto isServer = privateKeyData != nullptr;
 
-                    tlsState.reset();
-                    return TlsStatus::Error;
-                }
+            // Load the user-provided certificate chain of a server
+            if (isServer && (certificateChainData != nullptr) && (certificateChainSize > 0) &&
+                !parseCertificateChain(state.x509Crt, certificateChainData, certificateChainSize))
+            {
+                tlsState.reset();
+                return TlsStatus::Error;
             }
 
-            const auto isServer = privateKeyData != nullptr;
+            // If we are a client, trust the system certificate store as well
+            auto& systemCertificates = getSystemCertificates();
 
-            // If we are a client, load certificates from the system certificate store
             if (!isServer)
             {
-                if (auto result = loadSystemCertificates(&state.x509Crt, &state.x509Crl); !result)
+                if (auto result = systemCertificates.load(); !result)
                 {
                     err() << "Failed to load system certificates" << std::endl;
                     tlsState.reset();
                     return TlsStatus::Error;
                 }
+
+                // Trust the user-provided chain in addition to the system certificates, sharing both
+                if ((certificateChainData != nullptr) && (certificateChainSize > 0))
+                {
+                    state.trustedChain = getTrustedChainCache().get(certificateChainData,
+                                                                    certificateChainSize,
+                                                                    systemCertificates.x509Crt);
+
+                    if (!state.trustedChain)
+                    {
+                        tlsState.reset();
+                        return TlsStatus::Error;
+                    }
+                }
             }
 
             // If we are a server, load private key
@@ -492,11 +953,15 @@ struct TcpSocket::Impl
                     tlsState.reset();
                     return TlsStatus::Error;
                 }
+
+                // Let clients resume their sessions
+                getServerSessionCache().configure(state.sslConfig, state.serverConnection);
             }
             else
             {
                 // If we are a client, make use of the CRL as well
-                mbedtls_ssl_conf_ca_chain(&state.sslConfig, &state.x509Crt, &state.x509Crl);
+                auto* caChain = state.trustedChain ? &state.trustedChain->x509Crt : &systemCertificates.x509Crt;
+                mbedtls_ssl_conf_ca_chain(&state.sslConfig, caChain, &systemCertificates.x509Crl);
             }
 
             if (auto result = mbedtls_ssl_setup(&state.sslContext, &state.sslConfig); result != 0)
@@ -517,6 +982,14 @@ struct TcpSocket::Impl
                     tlsState.reset();
                     return TlsStatus::Error;
                 }
+
+                // Resume the last session with this server if we have one, which skips most of the handshake
+                state.sessionKey = makeSessionKey(hostname,
+                                                  socket.getRemotePort(),
+                                                  verifyPeer,
+                                                  certificateChainData,
+                                                  certificateChainSize);
+                getClientSessionCache().restore(state.sessionKey, state.sslContext);
             }
 
             // Set up how the TLS implementation communicates with the underlying socket
@@ -537,6 +1010,10 @@ struct TcpSocket::Impl
                                static_cast<priv::SocketImpl::Size>(size),
                                flags));
 
+                    tcpSocket.countTraffic(Counter::SendCalls);
+                    if (result > 0)
+                        tcpSocket.countTraffic(Counter::BytesSent, static_cast<std::uint64_t>(result));
+
                     if ((result == -1) && (priv::SocketImpl::getErrorStatus() == sf::Socket::Status::NotReady))
                         return MBEDTLS_ERR_SSL_WANT_WRITE;
 
@@ -555,6 +1032,10 @@ struct TcpSocket::Impl
                              static_cast<priv::SocketImpl::Size>(size),
                              flags));
 
+                    tcpSocket.countTraffic(Counter::ReceiveCalls);
+                    if (result > 0)
+                        tcpSocket.countTraffic(Counter::BytesReceived, static_cast<std::uint64_t>(result));
+
                     if ((result == -1) && (priv::SocketImpl::getErrorStatus() == sf::Socket::Status::NotReady))
                         return MBEDTLS_ERR_SSL_WANT_READ;
 
@@ -569,7 +1050,12 @@ struct TcpSocket::Impl
         // Perform the TLS handshake if it isn't complete yet
         if (!state.handshakeComplete)
         {
-            if (auto result = mbedtls_ssl_handshake(&state.sslContext); result != 0)
+            const auto result = mbedtls_ssl_handshake(&state.sslContext);
+
+            // More handshake records than were processed may have been read
+            updateBufferedData(socket);
+
+            if (result != 0)
             {
                 if (result == MBEDTLS_ERR_SSL_WANT_READ || result == MBEDTLS_ERR_SSL_WANT_WRITE)
                     return TlsStatus::HandshakeStarted;
@@ -641,15 +1127,36 @@ struct TcpSocket::Impl
                 }
 
                 tlsState.reset();
+                updateBufferedData(socket);
                 return TlsStatus::Error;
             }
 
             state.handshakeComplete = true;
+            storeTlsSession();
+
+            socket.countTraffic(Counter::TlsHandshakes);
+            socket.countTraffic(Counter::TlsHandshakeTime,
+                                static_cast<std::uint64_t>(state.handshakeClock.getElapsedTime().asMicroseconds()));
+
+            if (state.serverConnection.resumed)
+                socket.countTraffic(Counter::TlsResumedHandshakes);
         }
 
         return TlsStatus::HandshakeComplete;
     }
 
+    void updateBufferedData(TcpSocket& socket) const
+    {
+        // Let the selectors know about the TLS records which were read but not received yet
+        socket.setBufferedData(tlsState && (mbedtls_ssl_check_pending(&tlsState->sslContext) != 0));
+    }
+
+    void storeTlsSession() const
+    {
+        if (tlsState && tlsState->handshakeComplete && !tlsState->sessionKey.empty())
+            getClientSessionCache().store(tlsState->sessionKey, tlsState->sslContext);
+    }
+
     struct TlsState
     {
         TlsState()
@@ -657,29 +1164,40 @@ struct TcpSocket::Impl
             mbedtls_ssl_init(&sslContext);
             mbedtls_ssl_config_init(&sslConfig);
             mbedtls_x509_crt_init(&x509Crt);
-            mbedtls_x509_crl_init(&x509Crl);
             mbedtls_pk_init(&privateKeyContext);
         }
 
         ~TlsState()
         {
             mbedtls_pk_free(&privateKeyContext);
-            mbedtls_x509_crl_free(&x509Crl);
             mbedtls_x509_crt_free(&x509Crt);
             mbedtls_ssl_config_free(&sslConfig);
             mbedtls_ssl_free(&sslContext);
         }
 
-        bool                handshakeComplete{};
-        mbedtls_net_context netContext{-1};
-        mbedtls_ssl_context sslContext{};
-        mbedtls_ssl_config  sslConfig{};
-        mbedtls_x509_crt    x509Crt{};
-        mbedtls_x509_crl    x509Crl{};
-        mbedtls_pk_context  privateKeyContext{};
+        bool                                      handshakeComplete{};
+        Clock                                     handshakeClock;   //!< Started when the handshake is set up
+        mbedtls_net_context                       netContext{-1};
+        mbedtls_ssl_context                       sslContext{};
+        mbedtls_ssl_config                        sslConfig{};
+        mbedtls_x509_crt                          x509Crt{};
+        mbedtls_pk_context                        privateKeyContext{};
+        std::string                               sessionKey;       //!< Client session cache key, empty for servers
+        std::shared_ptr<TrustedChainCache::Chain> trustedChain;     //!< Provided chain trusted by a client, if any
+        ServerSessionCache::Connection            serverConnection; //!< Tells whether a server resumed the session
     };
 
-    std::optional<TlsState> tlsState;
+    void clearSendQueue()
+    {
+        sendQueue.clear();
+        sendQueueFront  = 0;
+        sendQueueOffset = 0;
+    }
+
+    std::optional<TlsState>     tlsState;
+    std::vector<OutgoingPacket> sendQueue;         //!< Packets queued by `queue`, waiting for `flush`
+    std::size_t                 sendQueueFront{};  //!< Index of the first queued packet not completely sent
+    std::size_t                 sendQueueOffset{}; //!< Number of bytes of the front packet already sent
 };
 
 
@@ -690,7 +1208,12 @@ TcpSocket::TcpSocket() : Socket(Type::Tcp), m_impl(std::make_unique<Impl>())
 
 
 ////////////////////////////////////////////////////////////
-TcpSocket::~TcpSocket() = default;
+TcpSocket::~TcpSocket()
+{
+    // Keep the TLS session, a TLS 1.3 session ticket may only have arrived after the handshake
+    if (m_impl)
+        m_impl->storeTlsSession();
+}
 
 
 ////////////////////////////////////////////////////////////
@@ -707,11 +1230,10 @@ unsigned short TcpSocket::getLocalPort() const
     if (getNativeHandle() != priv::SocketImpl::invalidSocket())
     {
         // Retrieve information about the local end of the socket
-        sockaddr_in                  address{};
-        priv::SocketImpl::AddrLength size = sizeof(address);
-        if (getsockname(getNativeHandle(), reinterpret_cast<sockaddr*>(&address), &size) != -1)
+        priv::SocketImpl::Address address;
+        if (getsockname(getNativeHandle(), address.get(), &address.length) != -1)
         {
-            return ntohs(address.sin_port);
+            return priv::SocketImpl::getPort(*address.get());
         }
     }
 
@@ -726,11 +1248,10 @@ std::optional<IpAddress> TcpSocket::getRemoteAddress() const
     if (getNativeHandle() != priv::SocketImpl::invalidSocket())
     {
         // Retrieve information about the remote end of the socket
-        sockaddr_in                  address{};
-        priv::SocketImpl::AddrLength size = sizeof(address);
-        if (getpeername(getNativeHandle(), reinterpret_cast<sockaddr*>(&address), &size) != -1)
+        priv::SocketImpl::Address address;
+        if (getpeername(getNativeHandle(), address.get(), &address.length) != -1)
         {
-            return IpAddress(ntohl(address.sin_addr.s_addr));
+            return priv::SocketImpl::getIpAddress(*address.get());
         }
     }
 
@@ -745,11 +1266,10 @@ unsigned short TcpSocket::getRemotePort() const
     if (getNativeHandle() != priv::SocketImpl::invalidSocket())
     {
         // Retrieve information about the remote end of the socket
-        sockaddr_in                  address{};
-        priv::SocketImpl::AddrLength size = sizeof(address);
-        if (getpeername(getNativeHandle(), reinterpret_cast<sockaddr*>(&address), &size) != -1)
+        priv::SocketImpl::Address address;
+        if (getpeername(getNativeHandle(), address.get(), &address.length) != -1)
         {
-            return ntohs(address.sin_port);
+            return priv::SocketImpl::getPort(*address.get());
         }
     }
 
@@ -764,18 +1284,18 @@ Socket::Status TcpSocket::connect(IpAddress remoteAddress, unsigned short remote
     // Disconnect the socket if it is already connected
     disconnect();
 
-    // Create the internal socket if it doesn't exist
-    create();
+    // Create the internal socket if it doesn't exist, using the family of the remote address
+    create(remoteAddress.getType());
 
     // Create the remote address
-    sockaddr_in address = priv::SocketImpl::createAddress(remoteAddress.toInteger(), remotePort);
+    priv::SocketImpl::Address address = priv::SocketImpl::createAddress(remoteAddress, remotePort, getAddressType());
 
     if (timeout <= Time::Zero)
     {
         // ----- We're not using a timeout: just try to connect -----
 
         // Connect the socket
-        if (::connect(getNativeHandle(), reinterpret_cast<sockaddr*>(&address), sizeof(address)) == -1)
+        if (::connect(getNativeHandle(), address.get(), address.length) == -1)
             return priv::SocketImpl::getErrorStatus();
 
         // Connection succeeded
@@ -792,7 +1312,7 @@ Socket::Status TcpSocket::connect(IpAddress remoteAddress, unsigned short remote
         setBlocking(false);
 
     // Try to connect to the remote address
-    if (::connect(getNativeHandle(), reinterpret_cast<sockaddr*>(&address), sizeof(address)) >= 0)
+    if (::connect(getNativeHandle(), address.get(), address.length) >= 0)
     {
         // We got instantly connected! (it may no happen a lot...)
         setBlocking(blocking);
@@ -854,6 +1374,9 @@ void TcpSocket::disconnect()
 {
     if (m_impl->tlsState)
     {
+        // Keep the TLS session, a TLS 1.3 session ticket may only have arrived after the handshake
+        m_impl->storeTlsSession();
+
         if (m_impl->tlsState->handshakeComplete)
         {
             if (auto result = mbedtls_ssl_close_notify(&m_impl->tlsState->sslContext);
@@ -870,6 +1393,9 @@ void TcpSocket::disconnect()
 
     // Reset the pending packet data
     m_pendingPacket = PendingPacket();
+
+    // Drop the packets which were waiting to be sent
+    m_impl->clearSendQueue();
 }
 
 
@@ -1024,6 +1550,10 @@ Socket::Status TcpSocket::send(const void* data, std::size_t size, std::size_t&
                                        static_cast<const unsigned char*>(data) + sent,
                                        size - sent);
 
+            // Each successful write makes a single record
+            if (result > 0)
+                countTraffic(Counter::TlsRecordsSent);
+
             switch (result)
             {
                 case MBEDTLS_ERR_SSL_WANT_READ:
@@ -1037,6 +1567,7 @@ Socket::Status TcpSocket::send(const void* data, std::size_t size, std::size_t&
                     [[fallthrough]];
 #endif
                 case MBEDTLS_ERR_SSL_CRYPTO_IN_PROGRESS:
+                    countTraffic(Counter::PartialSends);
                     return Status::Partial;
                 case MBEDTLS_ERR_NET_CONN_RESET:
                     sent = 0;
@@ -1049,6 +1580,7 @@ Socket::Status TcpSocket::send(const void* data, std::size_t size, std::size_t&
             if (result < 0)
             {
                 m_impl->tlsState.reset();
+                setBufferedData(false);
                 return Status::Error;
             }
         }
@@ -1062,6 +1594,10 @@ Socket::Status TcpSocket::send(const void* data, std::size_t size, std::size_t&
                                              static_cast<priv::SocketImpl::Size>(size - sent),
                                              flags));
 #pragma GCC diagnostic pop
+
+            countTraffic(Counter::SendCalls);
+            if (result > 0)
+                countTraffic(Counter::BytesSent, static_cast<std::uint64_t>(result));
         }
 
         // Check for errors
@@ -1070,7 +1606,13 @@ Socket::Status TcpSocket::send(const void* data, std::size_t size, std::size_t&
             const Status status = priv::SocketImpl::getErrorStatus();
 
             if ((status == Status::NotReady) && sent)
+            {
+                countTraffic(Counter::PartialSends);
                 return Status::Partial;
+            }
+
+            if (status == Status::NotReady)
+                countTraffic(Counter::NotReadySends);
 
             return status;
         }
@@ -1106,7 +1648,14 @@ Socket::Status TcpSocket::receive(void* data, std::size_t size, std::size_t& rec
             return Status::Error;
         }
 
+        // A read starts on a new record when nothing is left of the previous one
+        const bool newRecord = mbedtls_ssl_get_bytes_avail(&m_impl->tlsState->sslContext) == 0;
+
         sizeReceived = mbedtls_ssl_read(&m_impl->tlsState->sslContext, static_cast<unsigned char*>(data), size);
+        m_impl->updateBufferedData(*this);
+
+        if ((sizeReceived > 0) && newRecord)
+            countTraffic(Counter::TlsRecordsReceived);
 
         switch (sizeReceived)
         {
@@ -1127,6 +1676,7 @@ Socket::Status TcpSocket::receive(void* data, std::size_t size, std::size_t& rec
 #endif
             case MBEDTLS_ERR_SSL_CRYPTO_IN_PROGRESS:
                 received = 0;
+                countTraffic(Counter::NotReadyReceives);
                 return Status::Partial;
             default:
                 break;
@@ -1136,11 +1686,15 @@ Socket::Status TcpSocket::receive(void* data, std::size_t size, std::size_t& rec
         if (sizeReceived < 0)
         {
             m_impl->tlsState.reset();
+            setBufferedData(false);
             return Status::Error;
         }
 
         if (sizeReceived == 0)
+        {
             m_impl->tlsState.reset();
+            setBufferedData(false);
+        }
     }
     else
     {
@@ -1150,6 +1704,10 @@ Socket::Status TcpSocket::receive(void* data, std::size_t size, std::size_t& rec
         sizeReceived = static_cast<int>(
             recv(getNativeHandle(), static_cast<char*>(data), static_cast<priv::SocketImpl::Size>(size), flags));
 #pragma GCC diagnostic pop
+
+        countTraffic(Counter::ReceiveCalls);
+        if (sizeReceived > 0)
+            countTraffic(Counter::BytesReceived, static_cast<std::uint64_t>(sizeReceived));
     }
 
     // Check the number of bytes received
@@ -1163,7 +1721,11 @@ Socket::Status TcpSocket::receive(void* data, std::size_t size, std::size_t& rec
         return Status::Disconnected;
     }
 
-    return priv::SocketImpl::getErrorStatus();
+    const Status status = priv::SocketImpl::getErrorStatus();
+    if (status == Status::NotReady)
+        countTraffic(Counter::NotReadyReceives);
+
+    return status;
 }
 
 
@@ -1174,54 +1736,102 @@ Socket::Status TcpSocket::send(Packet& packet)
     // This means that we have to send the packet size first, so that the
     // receiver knows the actual end of the packet in the data stream.
 
-    // We allocate an extra memory block so that the size can be sent
-    // together with the data in a single call. This may seem inefficient,
-    // but it is actually required to avoid partial send, which could cause
-    // data corruption on the receiving end.
-
     // Get the data to send from the packet
     std::size_t size = 0;
     const void* data = packet.onSend(size);
 
-    // First convert the packet size to network byte order
-    std::uint32_t packetSize = htonl(static_cast<std::uint32_t>(size));
+    // Convert the packet size to network byte order
+    const OutgoingPacket outgoing{htonl(static_cast<std::uint32_t>(size)), static_cast<const std::byte*>(data), size};
+    const auto*          begin = &outgoing;
 
-    // Allocate memory for the data block to send
-    m_blockToSendBuffer.resize(sizeof(packetSize) + size);
+    Status status = Status::Done;
 
-// Copy the packet size and data into the block to send
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wnull-dereference" // False positive.
-    std::memcpy(m_blockToSendBuffer.data(), &packetSize, sizeof(packetSize));
-#pragma GCC diagnostic pop
-    if (size > 0)
-        std::memcpy(m_blockToSendBuffer.data() + sizeof(packetSize), data, size);
+    if (!m_impl->tlsState)
+    {
+        // Hand the size and the data to the system in a single gathering call,
+        // so that they can't be split by a partial send without being copied
+        // into a common block first
+        std::uint64_t calls = 0;
+        std::uint64_t bytes = 0;
+        status              = sendGathered(getNativeHandle(), begin, begin + 1, packet.m_sendPos, calls, bytes);
+        countGathered(status, calls, bytes);
+    }
+    else
+    {
+        // TLS encrypts contiguous memory anyway, so copy the size and the data
+        // into a single block in order to have them end up in the same record
+        flatten(m_blockToSendBuffer, begin, begin + 1, packet.m_sendPos);
 
-// These warnings are ignored here for portability, as even on Windows the
-// signature of `send` might change depending on whether Win32 or MinGW is
-// being used.
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wuseless-cast"
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wsign-conversion"
-    // Send the data block
-    std::size_t  sent   = 0;
-    const Status status = send(m_blockToSendBuffer.data() + packet.m_sendPos,
-                               static_cast<priv::SocketImpl::Size>(m_blockToSendBuffer.size() - packet.m_sendPos),
-                               sent);
-#pragma GCC diagnostic pop
-#pragma GCC diagnostic pop
+        std::size_t sent = 0;
+        status           = send(m_blockToSendBuffer.data(), m_blockToSendBuffer.size(), sent);
 
-    // In the case of a partial send, record the location to resume from
-    if (status == Status::Partial)
-    {
-        packet.m_sendPos += sent;
+        // In the case of a partial send, record the location to resume from
+        if (status == Status::Partial)
+            packet.m_sendPos += sent;
     }
-    else if (status == Status::Done)
+
+    if (status == Status::Done)
     {
         packet.m_sendPos = 0;
+        countTraffic(Counter::MessagesSent);
+    }
+
+    return status;
+}
+
+
+////////////////////////////////////////////////////////////
+void TcpSocket::queue(Packet& packet)
+{
+    std::size_t size = 0;
+    const void* data = packet.onSend(size);
+
+    m_impl->sendQueue.push_back({htonl(static_cast<std::uint32_t>(size)), static_cast<const std::byte*>(data), size});
+}
+
+
+////////////////////////////////////////////////////////////
+Socket::Status TcpSocket::flush()
+{
+    auto& sendQueue = m_impl->sendQueue;
+
+    const OutgoingPacket* begin = sendQueue.data() + m_impl->sendQueueFront;
+    const OutgoingPacket* end   = sendQueue.data() + sendQueue.size();
+    const OutgoingPacket* first = begin;
+
+    Status status = Status::Done;
+
+    if (begin != end)
+    {
+        if (!m_impl->tlsState)
+        {
+            std::uint64_t calls = 0;
+            std::uint64_t bytes = 0;
+            status              = sendGathered(getNativeHandle(), begin, end, m_impl->sendQueueOffset, calls, bytes);
+            countGathered(status, calls, bytes);
+        }
+        else
+        {
+            // Coalesce the queued packets into a single block, so that they are
+            // encrypted into as few full-sized TLS records as possible instead
+            // of paying the per-record overhead for every small packet
+            flatten(m_blockToSendBuffer, begin, end, m_impl->sendQueueOffset);
+
+            std::size_t sent = 0;
+            status           = send(m_blockToSendBuffer.data(), m_blockToSendBuffer.size(), sent);
+            consume(begin, end, m_impl->sendQueueOffset, sent);
+        }
+
+        countTraffic(Counter::MessagesSent, static_cast<std::uint64_t>(begin - first));
     }
 
+    // Keep what is left for the next call if the socket just isn't ready,
+    // otherwise everything was either sent or can't be sent anymore
+    if ((status == Status::Partial) || (status == Status::NotReady))
+        m_impl->sendQueueFront = static_cast<std::size_t>(begin - sendQueue.data());
+    else
+        m_impl->clearSendQueue();
+
     return status;
 }
 
@@ -1258,33 +1868,52 @@ Socket::Status TcpSocket::receive(Packet& packet)
         packetSize = ntohl(m_pendingPacket.size);
     }
 
-    // Loop until we receive all the packet data
-    std::array<char, 1024> buffer{};
-    while (m_pendingPacket.data.size() < packetSize)
+    // Receive the data directly into the pending buffer, with reads as large as possible.
+    // The buffer only grows with the data actually received beyond the first block, so
+    // that a bogus packet size can't make us allocate a huge block up front
+    constexpr std::size_t initialBlockSize = 1024 * 1024;
+    constexpr std::size_t maxReadSize      = std::numeric_limits<int>::max();
+
+    auto& data = m_pendingPacket.data;
+    while (m_pendingPacket.dataReceived < packetSize)
     {
-        // Receive a chunk of data
-        const std::size_t sizeToGet = std::min(packetSize - m_pendingPacket.data.size(), buffer.size());
-        const Status      status    = receive(buffer.data(), sizeToGet, received);
+        if (m_pendingPacket.dataReceived == data.size())
+            data.resize(std::min<std::size_t>(packetSize, std::max(data.size() * 2, initialBlockSize)));
+
+        const std::size_t sizeToGet = std::min(data.size() - m_pendingPacket.dataReceived, maxReadSize);
+        const Status      status    = receive(data.data() + m_pendingPacket.dataReceived, sizeToGet, received);
+        m_pendingPacket.dataReceived += received;
+
         if (status != Status::Done)
             return status;
-
-        // Append it into the packet
-        if (received > 0)
-        {
-            m_pendingPacket.data.resize(m_pendingPacket.data.size() + received);
-            std::byte* begin = m_pendingPacket.data.data() + m_pendingPacket.data.size() - received;
-            std::memcpy(begin, buffer.data(), received);
-        }
     }
 
-    // We have received all the packet data: we can copy it to the user packet
-    if (!m_pendingPacket.data.empty())
-        packet.onReceive(m_pendingPacket.data.data(), m_pendingPacket.data.size());
+    // We have received all the packet data: hand it over to the user packet,
+    // which takes ownership of the buffer unless it transforms the data
+    if (packetSize > 0)
+        packet.receiveBuffer(data);
 
-    // Clear the pending packet data
-    m_pendingPacket = PendingPacket();
+    // Clear the pending packet data, keeping the buffer if it wasn't taken
+    data.clear();
+    m_pendingPacket.size         = 0;
+    m_pendingPacket.sizeReceived = 0;
+    m_pendingPacket.dataReceived = 0;
 
+    countTraffic(Counter::MessagesReceived);
     return Status::Done;
 }
 
+
+////////////////////////////////////////////////////////////
+void TcpSocket::countGathered(Status status, std::uint64_t calls, std::uint64_t bytes)
+{
+    countTraffic(Counter::SendCalls, calls);
+    countTraffic(Counter::BytesSent, bytes);
+
+    if (status == Status::Partial)
+        countTraffic(Counter::PartialSends);
+    else if (status == Status::NotReady)
+        countTraffic(Counter::NotReadySends);
+}
+
 } // namespace sf
@@ -0,0 +1,853 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Network/Packet.hpp>
+#include <SFML/Network/UdpConnection.hpp>
+#include <SFML/Network/UdpSocket.hpp>
+
+#include <SFML/System/Clock.hpp>
+#include <SFML/System/Err.hpp>
+
+#include <algorithm>
+#include <array>
+#include <deque>
+#include <map>
+#include <ostream>
+#include <random>
+#include <utility>
+#include <vector>
+
+
+namespace
+{
+// Every datagram starts with this value ("SFRU"), anything else is ignored
+constexpr std::uint32_t protocolId = 0x53465255;
+
+// Kinds of datagrams exchanged by the peers
+enum class DatagramType : std::uint8_t
+{
+    Connect,   // Connection request, repeated until accepted
+    Accept,    // Answer to a connection request
+    Data,      // Acks followed by any number of fragments
+    Disconnect // The sender closed the connection
+};
+
+// Datagrams stay below the MTU of common links, so that IP never fragments them
+constexpr std::size_t maxDatagramSize = 1200;
+
+// Protocol, type and session, followed by the base and the bits of the acks in data datagrams
+constexpr std::size_t dataHeaderSize = 4 + 1 + 4 + 4 + 8;
+
+// Channel, sequence, message, index, count and size of a fragment, followed by its bytes
+constexpr std::size_t fragmentHeaderSize = 1 + 4 + 4 + 2 + 2 + 2;
+
+static_assert(dataHeaderSize + fragmentHeaderSize + sf::UdpConnection::FragmentSize <= maxDatagramSize);
+
+// Number of reliable fragments which may be sent before the oldest one is acknowledged;
+// it is kept small enough for a full window to fit in the default socket receive buffers
+constexpr std::uint32_t reliableWindow = 256;
+
+// Number of reliable fragments following the ack base acknowledged individually
+constexpr std::uint32_t ackBitCount = 64;
+
+// Number of fragmented unreliable messages being reassembled at the same time
+constexpr std::size_t maxPartialUnreliableMessages = 16;
+
+// Number of times the disconnection notice is sent, as it is never acknowledged
+constexpr int disconnectRepeatCount = 3;
+
+constexpr sf::Time initialRetransmitTimeout = sf::milliseconds(100);
+constexpr sf::Time minRetransmitTimeout     = sf::milliseconds(10);
+constexpr sf::Time maxRetransmitTimeout     = sf::seconds(1);
+constexpr sf::Time heartbeatInterval        = sf::milliseconds(250);
+
+
+////////////////////////////////////////////////////////////
+// Tell whether a sequence number comes before another one,
+// allowing the sequence numbers to wrap around
+bool isBefore(std::uint32_t left, std::uint32_t right)
+{
+    return static_cast<std::int32_t>(left - right) < 0;
+}
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct UdpConnection::Impl
+{
+    ////////////////////////////////////////////////////////////
+    struct OutgoingFragment
+    {
+        Channel                channel{};   //!< Channel of the message
+        std::uint32_t          sequence{};  //!< Sequence number (reliable channels only)
+        std::uint32_t          messageId{}; //!< Number of the message in its channel
+        std::uint16_t          index{};     //!< Index of the fragment in the message
+        std::uint16_t          count{};     //!< Number of fragments in the message
+        std::vector<std::byte> data;        //!< Bytes of the message carried by the fragment
+        Time                   lastSent;    //!< Time of the last transmission
+        Time                   nextSend;    //!< Time of the next retransmission
+        unsigned int           sendCount{}; //!< Number of transmissions so far
+        bool                   acked{};     //!< Whether the peer acknowledged the fragment
+    };
+
+    ////////////////////////////////////////////////////////////
+    struct PartialMessage
+    {
+        std::vector<std::byte> data;      //!< Bytes of the fragments received so far, at their final position
+        std::vector<bool>      received;  //!< Which fragments were received
+        std::size_t            missing{}; //!< Number of fragments still missing
+    };
+
+    using PartialMessages = std::map<std::uint32_t, PartialMessage>;
+    using Message         = std::pair<Channel, std::vector<std::byte>>;
+
+    ////////////////////////////////////////////////////////////
+    Impl()
+    {
+        socket.setBlocking(false);
+    }
+
+    ////////////////////////////////////////////////////////////
+    void reset()
+    {
+        state = State::Disconnected;
+        remoteAddress.reset();
+        remotePort = 0;
+        session    = 0;
+
+        unreliableFragments.clear();
+        reliableFragments.clear();
+        nextSequence  = 0;
+        nextMessageId = {};
+
+        retransmitTimeout = initialRetransmitTimeout;
+        smoothedRtt       = Time::Zero;
+        rttVariance       = Time::Zero;
+        hasRtt            = false;
+
+        receiveBase = 0;
+        std::fill(receivedSequences.begin(), receivedSequences.end(), false);
+        ackPending = false;
+        for (PartialMessages& partials : partialMessages)
+            partials.clear();
+        orderedMessages.clear();
+        nextOrderedId = 0;
+    }
+
+    ////////////////////////////////////////////////////////////
+    void close()
+    {
+        reset();
+        socket.unbind();
+    }
+
+    ////////////////////////////////////////////////////////////
+    Socket::Status open(unsigned short port, IpAddress address)
+    {
+        close();
+        messages.clear();
+        statistics = {};
+
+        return socket.bind(port, address);
+    }
+
+    ////////////////////////////////////////////////////////////
+    void beginDatagram(DatagramType type)
+    {
+        datagram.clear();
+        datagram << protocolId << static_cast<std::uint8_t>(type) << session;
+
+        // Every data datagram acknowledges all the reliable fragments received so far
+        if (type == DatagramType::Data)
+        {
+            std::uint64_t ackBits = 0;
+            for (std::uint32_t i = 0; i < ackBitCount; ++i)
+            {
+                if (receivedSequences[(receiveBase + 1 + i) % reliableWindow])
+                    ackBits |= std::uint64_t{1} << i;
+            }
+
+            datagram << receiveBase << ackBits;
+            ackPending = false;
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    void sendDatagram()
+    {
+        lastSend = clock.getElapsedTime();
+
+        if ((simulatedLoss > 0.f) && (std::uniform_real_distribution<float>()(random) < simulatedLoss))
+        {
+            ++statistics.datagramsDropped;
+            return;
+        }
+
+        // Failures are handled like losses: reliable fragments are retransmitted, the rest is expendable
+        if (socket.send(datagram.getData(), datagram.getDataSize(), *remoteAddress, remotePort) == Socket::Status::Done)
+            ++statistics.datagramsSent;
+    }
+
+    ////////////////////////////////////////////////////////////
+    void sendControl(DatagramType type)
+    {
+        beginDatagram(type);
+        sendDatagram();
+    }
+
+    ////////////////////////////////////////////////////////////
+    void appendFragment(const OutgoingFragment& fragment, bool& hasFragments)
+    {
+        // Start a new datagram when the fragment doesn't fit in the current one
+        if (hasFragments && (datagram.getDataSize() + fragmentHeaderSize + fragment.data.size() > maxDatagramSize))
+        {
+            sendDatagram();
+            beginDatagram(DatagramType::Data);
+        }
+
+        datagram << static_cast<std::uint8_t>(fragment.channel) << fragment.sequence << fragment.messageId
+                 << fragment.index << fragment.count << static_cast<std::uint16_t>(fragment.data.size());
+        datagram.append(fragment.data.data(), fragment.data.size());
+
+        hasFragments = true;
+        ++statistics.fragmentsSent;
+    }
+
+    ////////////////////////////////////////////////////////////
+    void queue(Channel channel, const std::byte* data, std::size_t size)
+    {
+        const std::size_t   count     = std::max<std::size_t>(1, (size + FragmentSize - 1) / FragmentSize);
+        const std::uint32_t messageId = nextMessageId[static_cast<std::size_t>(channel)]++;
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const std::size_t begin = i * FragmentSize;
+            const std::size_t end   = std::min(begin + FragmentSize, size);
+
+            OutgoingFragment fragment;
+            fragment.channel   = channel;
+            fragment.messageId = messageId;
+            fragment.index     = static_cast<std::uint16_t>(i);
+            fragment.count     = static_cast<std::uint16_t>(count);
+            fragment.data.assign(data + begin, data + end);
+
+            if (channel == Channel::Unreliable)
+            {
+                unreliableFragments.push_back(std::move(fragment));
+            }
+            else
+            {
+                fragment.sequence = nextSequence++;
+                reliableFragments.push_back(std::move(fragment));
+            }
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    void transmit(Time now)
+    {
+        const bool isAckDue = ackPending;
+
+        beginDatagram(DatagramType::Data);
+        bool hasFragments = false;
+
+        // Send the reliable fragments which are new or whose ack is overdue, within the window
+        if (!reliableFragments.empty())
+        {
+            const std::uint32_t windowEnd = reliableFragments.front().sequence + reliableWindow;
+
+            for (OutgoingFragment& fragment : reliableFragments)
+            {
+                if (!isBefore(fragment.sequence, windowEnd))
+                    break;
+
+                if (fragment.acked || ((fragment.sendCount > 0) && (now < fragment.nextSend)))
+                    continue;
+
+                if (fragment.sendCount > 0)
+                    ++statistics.fragmentsRetransmitted;
+
+                // Back off exponentially while the fragment stays unacknowledged
+                const std::int64_t backoff = std::int64_t{1} << std::min(fragment.sendCount, 4u);
+                ++fragment.sendCount;
+                fragment.lastSent = now;
+                fragment.nextSend = now + retransmitTimeout * backoff;
+
+                appendFragment(fragment, hasFragments);
+            }
+        }
+
+        // Unreliable fragments are sent once
+        for (const OutgoingFragment& fragment : unreliableFragments)
+            appendFragment(fragment, hasFragments);
+
+        unreliableFragments.clear();
+
+        // Acks and heartbeats are sent on their own when there is no data to carry them
+        if (hasFragments || isAckDue || (now - lastSend >= heartbeatInterval))
+            sendDatagram();
+    }
+
+    ////////////////////////////////////////////////////////////
+    void updateRoundTripTime(Time sample)
+    {
+        // Estimate the round-trip time and the retransmission timeout like TCP does (RFC 6298)
+        if (!hasRtt)
+        {
+            smoothedRtt = sample;
+            rttVariance = sample / std::int64_t{2};
+            hasRtt      = true;
+        }
+        else
+        {
+            const Time deviation = (sample > smoothedRtt) ? (sample - smoothedRtt) : (smoothedRtt - sample);
+            rttVariance          = (rttVariance * std::int64_t{3} + deviation) / std::int64_t{4};
+            smoothedRtt          = (smoothedRtt * std::int64_t{7} + sample) / std::int64_t{8};
+        }
+
+        retransmitTimeout = std::clamp(smoothedRtt + rttVariance * std::int64_t{4},
+                                       minRetransmitTimeout,
+                                       maxRetransmitTimeout);
+    }
+
+    ////////////////////////////////////////////////////////////
+    void processAcks(std::uint32_t ackBase, std::uint64_t ackBits, Time now)
+    {
+        for (OutgoingFragment& fragment : reliableFragments)
+        {
+            // Fragments are sorted, the following ones can't be acknowledged by this datagram
+            const std::uint32_t offset = fragment.sequence - ackBase;
+            if (!isBefore(fragment.sequence, ackBase) && (offset > ackBitCount))
+                break;
+
+            if (fragment.acked || (fragment.sendCount == 0))
+                continue;
+
+            if (isBefore(fragment.sequence, ackBase) || ((offset > 0) && ((ackBits >> (offset - 1)) & 1u)))
+            {
+                fragment.acked = true;
+
+                // Only fragments sent once give an unambiguous measure of the round-trip time
+                if (fragment.sendCount == 1)
+                    updateRoundTripTime(now - fragment.lastSent);
+            }
+        }
+
+        while (!reliableFragments.empty() && reliableFragments.front().acked)
+            reliableFragments.pop_front();
+    }
+
+    ////////////////////////////////////////////////////////////
+    void deliver(Channel channel, std::uint32_t messageId, std::vector<std::byte>&& data)
+    {
+        if (channel != Channel::ReliableOrdered)
+        {
+            messages.emplace_back(channel, std::move(data));
+            return;
+        }
+
+        // Ordered messages wait for the previous ones
+        if (messageId != nextOrderedId)
+        {
+            orderedMessages.emplace(messageId, std::move(data));
+            return;
+        }
+
+        messages.emplace_back(channel, std::move(data));
+        ++nextOrderedId;
+
+        for (auto it = orderedMessages.find(nextOrderedId); it != orderedMessages.end();
+             it      = orderedMessages.find(nextOrderedId))
+        {
+            messages.emplace_back(channel, std::move(it->second));
+            orderedMessages.erase(it);
+            ++nextOrderedId;
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    void processFragment(Channel          channel,
+                         std::uint32_t    sequence,
+                         std::uint32_t    messageId,
+                         std::uint16_t    index,
+                         std::uint16_t    count,
+                         const std::byte* data,
+                         std::size_t      size)
+    {
+        if (channel != Channel::Unreliable)
+        {
+            // Acknowledge duplicates again, the previous ack may have been lost
+            ackPending = true;
+
+            if (isBefore(sequence, receiveBase) || (sequence - receiveBase >= reliableWindow) ||
+                receivedSequences[sequence % reliableWindow])
+                return;
+
+            receivedSequences[sequence % reliableWindow] = true;
+
+            while (receivedSequences[receiveBase % reliableWindow])
+            {
+                receivedSequences[receiveBase % reliableWindow] = false;
+                ++receiveBase;
+            }
+        }
+
+        if (count == 1)
+        {
+            deliver(channel, messageId, std::vector<std::byte>(data, data + size));
+            return;
+        }
+
+        // Reassemble fragmented messages
+        PartialMessages& partials = partialMessages[static_cast<std::size_t>(channel)];
+
+        const auto [it, inserted] = partials.try_emplace(messageId);
+        PartialMessage& partial   = it->second;
+
+        if (inserted)
+        {
+            // Unreliable messages missing a fragment never complete, give up on the oldest ones
+            if ((channel == Channel::Unreliable) && (partials.size() > maxPartialUnreliableMessages))
+            {
+                const bool isOldest = (partials.begin() == it);
+                partials.erase(partials.begin());
+                if (isOldest)
+                    return;
+            }
+
+            partial.received.resize(count);
+            partial.missing = count;
+        }
+        else if (partial.received.size() != count)
+        {
+            return;
+        }
+
+        if (partial.received[index])
+            return;
+
+        const std::size_t offset = std::size_t{index} * FragmentSize;
+        if (partial.data.size() < offset + size)
+            partial.data.resize(offset + size);
+
+        std::copy(data, data + size, partial.data.begin() + static_cast<std::ptrdiff_t>(offset));
+        partial.received[index] = true;
+
+        if (--partial.missing == 0)
+        {
+            std::vector<std::byte> message = std::move(partial.data);
+            partials.erase(it);
+            deliver(channel, messageId, std::move(message));
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    void processData(Time now)
+    {
+        std::uint32_t ackBase = 0;
+        std::uint64_t ackBits = 0;
+        if (!(incoming >> ackBase >> ackBits))
+            return;
+
+        processAcks(ackBase, ackBits, now);
+
+        while (!incoming.endOfPacket())
+        {
+            std::uint8_t  channel   = 0;
+            std::uint32_t sequence  = 0;
+            std::uint32_t messageId = 0;
+            std::uint16_t index     = 0;
+            std::uint16_t count     = 0;
+            std::uint16_t size      = 0;
+            if (!(incoming >> channel >> sequence >> messageId >> index >> count >> size))
+                return;
+
+            // Drop the rest of malformed datagrams
+            const std::size_t remaining = incoming.getDataSize() - incoming.getReadPosition();
+            if ((channel > static_cast<std::uint8_t>(Channel::ReliableOrdered)) || (index >= count) ||
+                (size > remaining) || (size > FragmentSize) || ((index + 1 < count) && (size != FragmentSize)))
+                return;
+
+            const auto* data = static_cast<const std::byte*>(incoming.getData()) + incoming.getReadPosition();
+            processFragment(static_cast<Channel>(channel), sequence, messageId, index, count, data, size);
+
+            // Continue reading after the bytes of the fragment
+            incoming.readFrom(data + size, remaining - size);
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    void processDatagram(std::size_t size, IpAddress address, unsigned short port, Time now)
+    {
+        incoming.readFrom(buffer.data(), size);
+
+        std::uint32_t id        = 0;
+        std::uint8_t  type      = 0;
+        std::uint32_t sessionId = 0;
+        if (!(incoming >> id >> type >> sessionId) || (id != protocolId))
+            return;
+
+        const bool isFromPeer = (remoteAddress == address) && (remotePort == port) && (session == sessionId);
+
+        if (type == static_cast<std::uint8_t>(DatagramType::Connect))
+        {
+            if (state == State::Listening)
+            {
+                // Accept the first peer
+                remoteAddress = address;
+                remotePort    = port;
+                session       = sessionId;
+                state         = State::Connected;
+            }
+            else if (!isFromPeer || (state != State::Connected))
+            {
+                return;
+            }
+
+            // Answer repeated requests too, the previous answer may have been lost
+            ++statistics.datagramsReceived;
+            lastReceive = now;
+            sendControl(DatagramType::Accept);
+            return;
+        }
+
+        if (!isFromPeer)
+            return;
+
+        ++statistics.datagramsReceived;
+        lastReceive = now;
+
+        switch (static_cast<DatagramType>(type))
+        {
+            case DatagramType::Accept:
+                if (state == State::Connecting)
+                    state = State::Connected;
+                break;
+
+            case DatagramType::Data:
+                // Data also means that the peer accepted the connection, even if its answer was lost
+                if (state == State::Connecting)
+                    state = State::Connected;
+                processData(now);
+                break;
+
+            case DatagramType::Disconnect:
+                close();
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    void update()
+    {
+        if (state == State::Disconnected)
+            return;
+
+        Time now = clock.getElapsedTime();
+
+        // Process every datagram already received
+        for (;;)
+        {
+            std::size_t              received = 0;
+            std::optional<IpAddress> address;
+            unsigned short           port = 0;
+            if (socket.receive(buffer.data(), buffer.size(), received, address, port) != Socket::Status::Done)
+                break;
+
+            if (address.has_value())
+                processDatagram(received, *address, port, now);
+
+            if (state == State::Disconnected)
+                return;
+        }
+
+        if (state == State::Listening)
+            return;
+
+        now = clock.getElapsedTime();
+
+        if (now - lastReceive > timeout)
+        {
+            close();
+            return;
+        }
+
+        if (state == State::Connecting)
+        {
+            if (now >= nextHandshake)
+            {
+                sendControl(DatagramType::Connect);
+                nextHandshake = now + retransmitTimeout;
+            }
+
+            return;
+        }
+
+        transmit(now);
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    UdpSocket                socket;                         //!< Socket exchanging the datagrams
+    State                    state{State::Disconnected};     //!< State of the connection
+    std::optional<IpAddress> remoteAddress;                  //!< Address of the peer
+    unsigned short           remotePort{};                   //!< Port of the peer
+    std::uint32_t            session{};                      //!< Random number identifying the connection
+    Time                     timeout{seconds(10)};           //!< Time after which a silent peer is disconnected
+    float                    simulatedLoss{};                //!< Probability to drop an outgoing datagram
+    std::minstd_rand         random{std::random_device()()}; //!< Generator of the sessions and the simulated loss
+    Clock                    clock;                          //!< Clock measuring all the times of the connection
+    Time                     lastReceive;                    //!< Time the last datagram was received from the peer
+    Time                     lastSend;                       //!< Time the last datagram was sent to the peer
+    Time                     nextHandshake;                  //!< Time the next connection request is due
+
+    std::deque<OutgoingFragment> unreliableFragments;                           //!< Unreliable fragments to send
+    std::deque<OutgoingFragment> reliableFragments;                             //!< Reliable fragments not acked yet
+    std::uint32_t                nextSequence{};                                //!< Sequence of the next fragment
+    std::array<std::uint32_t, 3> nextMessageId{};                               //!< Next message number, per channel
+    Time                         retransmitTimeout{initialRetransmitTimeout}; //!< Delay before retransmitting
+    Time                         smoothedRtt;                                   //!< Smoothed round-trip time
+    Time                         rttVariance;                                   //!< Variation of the round-trip time
+    bool                         hasRtt{};                                      //!< Whether the RTT was measured yet
+
+    std::uint32_t     receiveBase{};                                        //!< Sequence of the first missing fragment
+    std::vector<bool> receivedSequences{std::vector<bool>(reliableWindow)}; //!< Fragments received, modulo the window
+    bool              ackPending{};                                         //!< Whether fragments must be acked
+
+    std::array<PartialMessages, 3>                  partialMessages; //!< Messages being reassembled, per channel
+    std::map<std::uint32_t, std::vector<std::byte>> orderedMessages; //!< Ordered messages waiting for previous ones
+    std::uint32_t                                   nextOrderedId{}; //!< Number of the next ordered message
+    std::deque<Message>                             messages;        //!< Messages ready to be received
+
+    Statistics             statistics;                                                 //!< Traffic counters
+    Packet                 datagram;                                                   //!< Datagram being built
+    Packet                 incoming;                                                   //!< Datagram being read
+    std::vector<std::byte> buffer{std::vector<std::byte>(UdpSocket::MaxDatagramSize)}; //!< Receive buffer
+};
+
+
+////////////////////////////////////////////////////////////
+UdpConnection::UdpConnection() : m_impl(std::make_unique<Impl>())
+{
+}
+
+
+////////////////////////////////////////////////////////////
+UdpConnection::~UdpConnection() = default;
+
+
+////////////////////////////////////////////////////////////
+UdpConnection::UdpConnection(UdpConnection&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+UdpConnection& UdpConnection::operator=(UdpConnection&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+Socket::Status UdpConnection::listen(unsigned short port, IpAddress address)
+{
+    const Socket::Status status = m_impl->open(port, address);
+    if (status != Socket::Status::Done)
+        return status;
+
+    m_impl->state = State::Listening;
+    return Socket::Status::Done;
+}
+
+
+////////////////////////////////////////////////////////////
+Socket::Status UdpConnection::connect(IpAddress remoteAddress, unsigned short remotePort)
+{
+    const IpAddress      localAddress = (remoteAddress.getType() == IpAddress::Type::IpV6) ? IpAddress::AnyV6
+                                                                                            : IpAddress::Any;
+    const Socket::Status status       = m_impl->open(Socket::AnyPort, localAddress);
+    if (status != Socket::Status::Done)
+        return status;
+
+    const Time now        = m_impl->clock.getElapsedTime();
+    m_impl->remoteAddress = remoteAddress;
+    m_impl->remotePort    = remotePort;
+    m_impl->session       = std::uniform_int_distribution<std::uint32_t>()(m_impl->random);
+    m_impl->state         = State::Connecting;
+    m_impl->lastReceive   = now;
+    m_impl->nextHandshake = now;
+
+    return Socket::Status::Done;
+}
+
+
+////////////////////////////////////////////////////////////
+void UdpConnection::disconnect()
+{
+    if ((m_impl->state == State::Connecting) || (m_impl->state == State::Connected))
+    {
+        for (int i = 0; i < disconnectRepeatCount; ++i)
+            m_impl->sendControl(DatagramType::Disconnect);
+    }
+
+    m_impl->close();
+}
+
+
+////////////////////////////////////////////////////////////
+void UdpConnection::update()
+{
+    m_impl->update();
+}
+
+
+////////////////////////////////////////////////////////////
+Socket::Status UdpConnection::send(Packet& packet, Channel channel)
+{
+    if ((m_impl->state != State::Connecting) && (m_impl->state != State::Connected))
+        return Socket::Status::Disconnected;
+
+    // Get the data to send from the packet
+    std::size_t size = 0;
+    const void* data = packet.onSend(size);
+
+    if (size > MaxMessageSize)
+    {
+        err() << "Cannot send message over the connection "
+              << "(the number of bytes to send is greater than sf::UdpConnection::MaxMessageSize)" << std::endl;
+        return Socket::Status::Error;
+    }
+
+    m_impl->queue(channel, static_cast<const std::byte*>(data), size);
+    ++m_impl->statistics.messagesSent;
+
+    return Socket::Status::Done;
+}
+
+
+////////////////////////////////////////////////////////////
+Socket::Status UdpConnection::receive(Packet& packet)
+{
+    Channel channel{};
+    return receive(packet, channel);
+}
+
+
+////////////////////////////////////////////////////////////
+Socket::Status UdpConnection::receive(Packet& packet, Channel& channel)
+{
+    if (m_impl->messages.empty())
+        return (m_impl->state == State::Disconnected) ? Socket::Status::Disconnected : Socket::Status::NotReady;
+
+    auto& [messageChannel, data] = m_impl->messages.front();
+
+    packet.clear();
+    if (!data.empty())
+        packet.receiveBuffer(data);
+
+    channel = messageChannel;
+    m_impl->messages.pop_front();
+    ++m_impl->statistics.messagesReceived;
+
+    return Socket::Status::Done;
+}
+
+
+////////////////////////////////////////////////////////////
+UdpConnection::State UdpConnection::getState() const
+{
+    return m_impl->state;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned short UdpConnection::getLocalPort() const
+{
+    return m_impl->socket.getLocalPort();
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<IpAddress> UdpConnection::getRemoteAddress() const
+{
+    return m_impl->remoteAddress;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned short UdpConnection::getRemotePort() const
+{
+    return m_impl->remotePort;
+}
+
+
+////////////////////////////////////////////////////////////
+void UdpConnection::setTimeout(Time timeout)
+{
+    m_impl->timeout = timeout;
+}
+
+
+////////////////////////////////////////////////////////////
+Time UdpConnection::getTimeout() const
+{
+    return m_impl->timeout;
+}
+
+
+////////////////////////////////////////////////////////////
+void UdpConnection::setSimulatedLoss(float probability)
+{
+    m_impl->simulatedLoss = std::clamp(probability, 0.f, 1.f);
+}
+
+
+////////////////////////////////////////////////////////////
+float UdpConnection::getSimulatedLoss() const
+{
+    return m_impl->simulatedLoss;
+}
+
+
+////////////////////////////////////////////////////////////
+UdpConnection::Statistics UdpConnection::getStatistics() const
+{
+    Statistics statistics    = m_impl->statistics;
+    statistics.roundTripTime = m_impl->smoothedRtt;
+    return statistics;
+}
+
+
+////////////////////////////////////////////////////////////
+UdpSocket& UdpConnection::getSocket()
+{
+    return m_impl->socket;
+}
+
+} // namespace sf
@@ -32,9 +32,26 @@
 
 #include <SFML/System/Err.hpp>
 
+#if defined(SFML_SYSTEM_LINUX) || defined(SFML_SYSTEM_ANDROID)
+#define SFML_UDP_SOCKET_MMSG
+#include <sys/uio.h>
+#endif
+
+#include <algorithm>
+#include <array>
 #include <ostream>
 
 #include <cstddef>
+#include <cstring>
+
+
+namespace
+{
+#if defined(SFML_UDP_SOCKET_MMSG)
+// Maximum number of datagrams handled by a single sendmmsg/recvmmsg call
+constexpr std::size_t batchSize = 64;
+#endif
+} // namespace
 
 
 namespace sf
@@ -51,11 +68,10 @@ unsigned short UdpSocket::getLocalPort() const
     if (getNativeHandle() != priv::SocketImpl::invalidSocket())
     {
         // Retrieve information about the local end of the socket
-        sockaddr_in                  address{};
-        priv::SocketImpl::AddrLength size = sizeof(address);
-        if (getsockname(getNativeHandle(), reinterpret_cast<sockaddr*>(&address), &size) != -1)
+        priv::SocketImpl::Address address;
+        if (getsockname(getNativeHandle(), address.get(), &address.length) != -1)
         {
-            return ntohs(address.sin_port);
+            return priv::SocketImpl::getPort(*address.get());
         }
     }
 
@@ -70,16 +86,16 @@ Socket::Status UdpSocket::bind(unsigned short port, IpAddress address)
     // Close the socket if it is already bound
     close();
 
-    // Create the internal socket if it doesn't exist
-    create();
+    // Create the internal socket if it doesn't exist, using the family of the address
+    create(address.getType());
 
     // Check if the address is valid
     if (address == IpAddress::Broadcast)
         return Status::Error;
 
     // Bind the socket
-    sockaddr_in addr = priv::SocketImpl::createAddress(address.toInteger(), port);
-    if (::bind(getNativeHandle(), reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) == -1)
+    priv::SocketImpl::Address addr = priv::SocketImpl::createAddress(address, port, address.getType());
+    if (::bind(getNativeHandle(), addr.get(), addr.length) == -1)
     {
         err() << "Failed to bind socket to port " << port << std::endl;
         return Status::Error;
@@ -100,8 +116,8 @@ void UdpSocket::unbind()
 ////////////////////////////////////////////////////////////
 Socket::Status UdpSocket::send(const void* data, std::size_t size, IpAddress remoteAddress, unsigned short remotePort)
 {
-    // Create the internal socket if it doesn't exist
-    create();
+    // Create the internal socket if it doesn't exist, using the family of the remote address
+    create(remoteAddress.getType());
 
     // Make sure that all the data will fit in one datagram
     if (size > MaxDatagramSize)
@@ -112,7 +128,13 @@ Socket::Status UdpSocket::send(const void* data, std::size_t size, IpAddress rem
     }
 
     // Build the target address
-    sockaddr_in address = priv::SocketImpl::createAddress(remoteAddress.toInteger(), remotePort);
+    priv::SocketImpl::Address address = priv::SocketImpl::createAddress(remoteAddress, remotePort, getAddressType());
+    if (address.length == 0)
+    {
+        err() << "Cannot send data over the network "
+              << "(an IPv4 socket can't send to an IPv6 address)" << std::endl;
+        return Status::Error;
+    }
 
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wuseless-cast"
@@ -122,13 +144,24 @@ Socket::Status UdpSocket::send(const void* data, std::size_t size, IpAddress rem
                static_cast<const char*>(data),
                static_cast<priv::SocketImpl::Size>(size),
                0,
-               reinterpret_cast<sockaddr*>(&address),
-               sizeof(address)));
+               address.get(),
+               address.length));
 #pragma GCC diagnostic pop
 
+    countTraffic(Counter::SendCalls);
+
     // Check for errors
     if (sent < 0)
-        return priv::SocketImpl::getErrorStatus();
+    {
+        const Status status = priv::SocketImpl::getErrorStatus();
+        if (status == Status::NotReady)
+            countTraffic(Counter::NotReadySends);
+
+        return status;
+    }
+
+    countTraffic(Counter::BytesSent, static_cast<std::uint64_t>(sent));
+    countTraffic(Counter::MessagesSent);
 
     return Status::Done;
 }
@@ -154,29 +187,39 @@ Socket::Status UdpSocket::receive(void*                     data,
     }
 
     // Data that will be filled with the other computer's address
-    sockaddr_in address = priv::SocketImpl::createAddress(INADDR_ANY, 0);
+    priv::SocketImpl::Address address;
 
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wuseless-cast"
     // Receive a chunk of bytes
-    priv::SocketImpl::AddrLength addressSize  = sizeof(address);
-    const int                    sizeReceived = static_cast<int>(
+    const int sizeReceived = static_cast<int>(
         recvfrom(getNativeHandle(),
                  static_cast<char*>(data),
                  static_cast<priv::SocketImpl::Size>(size),
                  0,
-                 reinterpret_cast<sockaddr*>(&address),
-                 &addressSize));
+                 address.get(),
+                 &address.length));
 #pragma GCC diagnostic pop
 
+    countTraffic(Counter::ReceiveCalls);
+
     // Check for errors
     if (sizeReceived < 0)
-        return priv::SocketImpl::getErrorStatus();
+    {
+        const Status status = priv::SocketImpl::getErrorStatus();
+        if (status == Status::NotReady)
+            countTraffic(Counter::NotReadyReceives);
+
+        return status;
+    }
+
+    countTraffic(Counter::BytesReceived, static_cast<std::uint64_t>(sizeReceived));
+    countTraffic(Counter::MessagesReceived);
 
     // Fill the sender information
     received      = static_cast<std::size_t>(sizeReceived);
-    remoteAddress = IpAddress(ntohl(address.sin_addr.s_addr));
-    remotePort    = ntohs(address.sin_port);
+    remoteAddress = priv::SocketImpl::getIpAddress(*address.get());
+    remotePort    = priv::SocketImpl::getPort(*address.get());
 
     return Status::Done;
 }
@@ -220,4 +263,225 @@ Socket::Status UdpSocket::receive(Packet& packet, std::optional<IpAddress>& remo
 }
 
 
+////////////////////////////////////////////////////////////
+Socket::Status UdpSocket::send(const Datagram* datagrams, std::size_t count, std::size_t& sent)
+{
+    sent = 0;
+
+    // Create the internal socket if it doesn't exist, using the family of the first remote address
+    if (count > 0)
+        create(datagrams[0].remoteAddress.getType());
+
+    // Make sure that every datagram is valid before sending anything
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        if (datagrams[i].size > MaxDatagramSize)
+        {
+            err() << "Cannot send data over the network "
+                  << "(the number of bytes to send is greater than sf::UdpSocket::MaxDatagramSize)" << std::endl;
+            return Status::Error;
+        }
+
+        if ((getAddressType() == IpAddress::Type::IpV4) &&
+            (datagrams[i].remoteAddress.getType() == IpAddress::Type::IpV6))
+        {
+            err() << "Cannot send data over the network "
+                  << "(an IPv4 socket can't send to an IPv6 address)" << std::endl;
+            return Status::Error;
+        }
+    }
+
+#if defined(SFML_UDP_SOCKET_MMSG)
+    std::array<priv::SocketImpl::Address, batchSize> addresses{};
+    std::array<iovec, batchSize>                     vectors{};
+    std::array<mmsghdr, batchSize>                   messages{};
+
+    while (sent < count)
+    {
+        const std::size_t batch = std::min(count - sent, batchSize);
+
+        for (std::size_t i = 0; i < batch; ++i)
+        {
+            const Datagram& datagram = datagrams[sent + i];
+
+            addresses[i] = priv::SocketImpl::createAddress(datagram.remoteAddress,
+                                                           datagram.remotePort,
+                                                           getAddressType());
+            vectors[i]   = {const_cast<std::byte*>(datagram.data), datagram.size};
+            messages[i]  = {};
+
+            messages[i].msg_hdr.msg_name    = addresses[i].get();
+            messages[i].msg_hdr.msg_namelen = addresses[i].length;
+            messages[i].msg_hdr.msg_iov     = &vectors[i];
+            messages[i].msg_hdr.msg_iovlen  = 1;
+        }
+
+        const int result = sendmmsg(getNativeHandle(), messages.data(), static_cast<unsigned int>(batch), 0);
+        countTraffic(Counter::SendCalls);
+
+        if (result < 0)
+        {
+            const Status status = priv::SocketImpl::getErrorStatus();
+            if (status != Status::NotReady)
+                return status;
+
+            countTraffic((sent > 0) ? Counter::PartialSends : Counter::NotReadySends);
+            return (sent > 0) ? Status::Partial : status;
+        }
+
+        for (std::size_t i = 0; i < static_cast<std::size_t>(result); ++i)
+            countTraffic(Counter::BytesSent, datagrams[sent + i].size);
+
+        countTraffic(Counter::MessagesSent, static_cast<std::uint64_t>(result));
+        sent += static_cast<std::size_t>(result);
+    }
+#else
+    for (; sent < count; ++sent)
+    {
+        const Datagram& datagram = datagrams[sent];
+        const Status    status   = send(datagram.data, datagram.size, datagram.remoteAddress, datagram.remotePort);
+
+        if ((status == Status::NotReady) && (sent > 0))
+        {
+            countTraffic(Counter::PartialSends);
+            return Status::Partial;
+        }
+
+        if (status != Status::Done)
+            return status;
+    }
+#endif
+
+    return Status::Done;
+}
+
+
+////////////////////////////////////////////////////////////
+Socket::Status UdpSocket::receive(void*        arena,
+                                  std::size_t  arenaSize,
+                                  Datagram*    datagrams,
+                                  std::size_t  count,
+                                  std::size_t& received)
+{
+    received = 0;
+
+    // Check the destination buffers
+    const std::size_t slotSize = (count > 0) ? arenaSize / count : 0;
+    if (!arena || !datagrams || (slotSize == 0))
+    {
+        err() << "Cannot receive data from the network (the destination buffer is invalid)" << std::endl;
+        return Status::Error;
+    }
+
+    auto* const slots = static_cast<std::byte*>(arena);
+
+#if defined(SFML_UDP_SOCKET_MMSG)
+    std::array<priv::SocketImpl::Address, batchSize> addresses{};
+    std::array<iovec, batchSize>                     vectors{};
+    std::array<mmsghdr, batchSize>                   messages{};
+
+    std::size_t slot = 0;
+    while (slot < count)
+    {
+        const std::size_t batch = std::min(count - slot, batchSize);
+
+        for (std::size_t i = 0; i < batch; ++i)
+        {
+            vectors[i]  = {slots + (slot + i) * slotSize, slotSize};
+            messages[i] = {};
+
+            messages[i].msg_hdr.msg_name    = addresses[i].get();
+            messages[i].msg_hdr.msg_namelen = sizeof(addresses[i].storage);
+            messages[i].msg_hdr.msg_iov     = &vectors[i];
+            messages[i].msg_hdr.msg_iovlen  = 1;
+        }
+
+        // Wait until a datagram is accepted, then just collect what is already there
+        const int result = recvmmsg(getNativeHandle(),
+                                    messages.data(),
+                                    static_cast<unsigned int>(batch),
+                                    (received == 0) ? MSG_WAITFORONE : MSG_DONTWAIT,
+                                    nullptr);
+        countTraffic(Counter::ReceiveCalls);
+
+        if (result < 0)
+        {
+            if (received > 0)
+                break;
+
+            const Status status = priv::SocketImpl::getErrorStatus();
+            if (status == Status::NotReady)
+                countTraffic(Counter::NotReadyReceives);
+
+            return status;
+        }
+
+        for (std::size_t i = 0; i < static_cast<std::size_t>(result); ++i)
+        {
+            countTraffic(Counter::BytesReceived, messages[i].msg_len);
+
+            // Datagrams which didn't fit in their slot are lost
+            if (messages[i].msg_hdr.msg_flags & MSG_TRUNC)
+                continue;
+
+            countTraffic(Counter::MessagesReceived);
+
+            datagrams[received++] = {static_cast<const std::byte*>(vectors[i].iov_base),
+                                     messages[i].msg_len,
+                                     priv::SocketImpl::getIpAddress(*addresses[i].get()).value_or(IpAddress::Any),
+                                     priv::SocketImpl::getPort(*addresses[i].get())};
+        }
+
+        slot += static_cast<std::size_t>(result);
+
+        // If only truncated datagrams arrived so far, all the slots are free again: keep waiting
+        if (received == 0)
+        {
+            slot = 0;
+            continue;
+        }
+
+        if (static_cast<std::size_t>(result) < batch)
+            break;
+    }
+#else
+    const bool blocking = isBlocking();
+    Status     status   = Status::Done;
+
+    while (received < count)
+    {
+        std::size_t              size = 0;
+        std::optional<IpAddress> remoteAddress;
+        unsigned short           remotePort = 0;
+
+        // Receive into the internal buffer first, so that datagrams which don't fit in a slot
+        // are dropped like on Linux rather than truncated or reported as an error
+        status = receive(m_buffer.data(), m_buffer.size(), size, remoteAddress, remotePort);
+        if (status != Status::Done)
+            break;
+
+        if (size > slotSize)
+            continue;
+
+        std::byte* const data = slots + received * slotSize;
+        std::memcpy(data, m_buffer.data(), size);
+
+        datagrams[received++] = {data, size, *remoteAddress, remotePort};
+
+        // Only wait for the first accepted datagram, then just collect what is already there
+        if ((received == 1) && blocking)
+            priv::SocketImpl::setBlocking(getNativeHandle(), false);
+    }
+
+    if ((received > 0) && blocking)
+        priv::SocketImpl::setBlocking(getNativeHandle(), true);
+
+    if (received == 0)
+        return status;
+#endif
+
+    return Status::Done;
+}
+
+
 } // namespace sf
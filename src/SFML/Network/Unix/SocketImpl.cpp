@@ -31,8 +31,13 @@
 
 #include <fcntl.h>
 #include <ostream>
+#include <sys/uio.h>
+
+#include <algorithm>
+#include <array>
 
 #include <cerrno>
+#include <cstring>
 
 
 namespace sf::priv
@@ -53,6 +58,101 @@ sockaddr_in SocketImpl::createAddress(std::uint32_t address, unsigned short port
 }
 
 
+////////////////////////////////////////////////////////////
+SocketImpl::Address SocketImpl::createAddress(IpAddress address, unsigned short port, IpAddress::Type family)
+{
+    Address result;
+
+    if (family == IpAddress::Type::IpV4)
+    {
+        // IPv6 addresses can't be reached from an IPv4 socket
+        if (address.getType() != IpAddress::Type::IpV4)
+        {
+            result.length = 0;
+            return result;
+        }
+
+        const sockaddr_in addr = createAddress(address.toInteger(), port);
+        std::memcpy(&result.storage, &addr, sizeof(addr));
+        result.length = sizeof(addr);
+        return result;
+    }
+
+    // IPv4 addresses are reached through their IPv4-mapped form by IPv6 sockets
+    const std::array<std::uint8_t, 16> bytes = address.toBytes();
+
+    auto addr        = sockaddr_in6();
+    addr.sin6_family = AF_INET6;
+    addr.sin6_port   = htons(port);
+    std::memcpy(&addr.sin6_addr, bytes.data(), bytes.size());
+
+#if defined(SFML_SYSTEM_MACOS)
+    addr.sin6_len = sizeof(addr);
+#endif
+    std::memcpy(&result.storage, &addr, sizeof(addr));
+    result.length = sizeof(addr);
+    return result;
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<IpAddress> SocketImpl::getIpAddress(const sockaddr& address)
+{
+    if (address.sa_family == AF_INET)
+    {
+        sockaddr_in addr{};
+        std::memcpy(&addr, &address, sizeof(addr));
+        return IpAddress(ntohl(addr.sin_addr.s_addr));
+    }
+
+    if (address.sa_family == AF_INET6)
+    {
+        sockaddr_in6 addr{};
+        std::memcpy(&addr, &address, sizeof(addr));
+
+        std::array<std::uint8_t, 16> bytes{};
+        std::memcpy(bytes.data(), &addr.sin6_addr, bytes.size());
+
+        // Report the IPv4 peers of dual-stack sockets with their IPv4 address
+        constexpr std::array<std::uint8_t, 12> mappedPrefix{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xFF, 0xFF};
+        if (std::equal(mappedPrefix.begin(), mappedPrefix.end(), bytes.begin()))
+            return IpAddress(bytes[12], bytes[13], bytes[14], bytes[15]);
+
+        return IpAddress(bytes);
+    }
+
+    return std::nullopt;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned short SocketImpl::getPort(const sockaddr& address)
+{
+    if (address.sa_family == AF_INET)
+    {
+        sockaddr_in addr{};
+        std::memcpy(&addr, &address, sizeof(addr));
+        return ntohs(addr.sin_port);
+    }
+
+    if (address.sa_family == AF_INET6)
+    {
+        sockaddr_in6 addr{};
+        std::memcpy(&addr, &address, sizeof(addr));
+        return ntohs(addr.sin6_port);
+    }
+
+    return 0;
+}
+
+
+////////////////////////////////////////////////////////////
+int SocketImpl::getProtocolFamily(IpAddress::Type type)
+{
+    return (type == IpAddress::Type::IpV6) ? PF_INET6 : PF_INET;
+}
+
+
 ////////////////////////////////////////////////////////////
 SocketHandle SocketImpl::invalidSocket()
 {
@@ -84,6 +184,27 @@ void SocketImpl::setBlocking(SocketHandle sock, bool block)
 }
 
 
+////////////////////////////////////////////////////////////
+SocketHandle SocketImpl::accept(SocketHandle listener, Address& address, bool block)
+{
+#if defined(SFML_SYSTEM_LINUX) || defined(SFML_SYSTEM_ANDROID) || defined(SFML_SYSTEM_FREEBSD) || \
+    defined(SFML_SYSTEM_OPENBSD) || defined(SFML_SYSTEM_NETBSD)
+    // Set the flags of the new socket in the same system call
+    return ::accept4(listener, address.get(), &address.length, SOCK_CLOEXEC | (block ? 0 : SOCK_NONBLOCK));
+#else
+    // Accepted sockets may inherit the blocking state of the listener on some systems
+    const SocketHandle sock = ::accept(listener, address.get(), &address.length);
+    if (sock != invalidSocket())
+    {
+        fcntl(sock, F_SETFD, FD_CLOEXEC);
+        setBlocking(sock, block);
+    }
+
+    return sock;
+#endif
+}
+
+
 ////////////////////////////////////////////////////////////
 Socket::Status SocketImpl::getErrorStatus()
 {
@@ -108,4 +229,36 @@ Socket::Status SocketImpl::getErrorStatus()
     // clang-format on
 }
 
+
+////////////////////////////////////////////////////////////
+std::int64_t SocketImpl::sendBuffers(SocketHandle sock, const Buffer* buffers, std::size_t count, int flags)
+{
+    count = std::min(count, maxBuffers);
+
+    std::array<iovec, maxBuffers> vectors{};
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        vectors[i].iov_base = const_cast<void*>(buffers[i].data);
+        vectors[i].iov_len  = buffers[i].size;
+    }
+
+    msghdr message{};
+    message.msg_iov = vectors.data();
+
+// msg_iovlen is an int on some platforms and a size_t on others
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuseless-cast"
+    message.msg_iovlen = static_cast<decltype(message.msg_iovlen)>(count);
+#pragma GCC diagnostic pop
+
+    return ::sendmsg(sock, &message, flags);
+}
+
+
+////////////////////////////////////////////////////////////
+int SocketImpl::poll(PollDescriptor* descriptors, std::size_t count, int timeout)
+{
+    return ::poll(descriptors, static_cast<nfds_t>(count), timeout);
+}
+
 } // namespace sf::priv
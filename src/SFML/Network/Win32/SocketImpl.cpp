@@ -27,7 +27,12 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Network/SocketImpl.hpp>
 
+#include <algorithm>
+#include <array>
+#include <limits>
+
 #include <cstdint>
+#include <cstring>
 
 
 namespace
@@ -67,6 +72,97 @@ sockaddr_in SocketImpl::createAddress(std::uint32_t address, unsigned short port
 }
 
 
+////////////////////////////////////////////////////////////
+SocketImpl::Address SocketImpl::createAddress(IpAddress address, unsigned short port, IpAddress::Type family)
+{
+    Address result;
+
+    if (family == IpAddress::Type::IpV4)
+    {
+        // IPv6 addresses can't be reached from an IPv4 socket
+        if (address.getType() != IpAddress::Type::IpV4)
+        {
+            result.length = 0;
+            return result;
+        }
+
+        const sockaddr_in addr = createAddress(address.toInteger(), port);
+        std::memcpy(&result.storage, &addr, sizeof(addr));
+        result.length = static_cast<AddrLength>(sizeof(addr));
+        return result;
+    }
+
+    // IPv4 addresses are reached through their IPv4-mapped form by IPv6 sockets
+    const std::array<std::uint8_t, 16> bytes = address.toBytes();
+
+    auto addr        = sockaddr_in6();
+    addr.sin6_family = AF_INET6;
+    addr.sin6_port   = htons(port);
+    std::memcpy(&addr.sin6_addr, bytes.data(), bytes.size());
+    std::memcpy(&result.storage, &addr, sizeof(addr));
+    result.length = static_cast<AddrLength>(sizeof(addr));
+    return result;
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<IpAddress> SocketImpl::getIpAddress(const sockaddr& address)
+{
+    if (address.sa_family == AF_INET)
+    {
+        sockaddr_in addr{};
+        std::memcpy(&addr, &address, sizeof(addr));
+        return IpAddress(ntohl(addr.sin_addr.s_addr));
+    }
+
+    if (address.sa_family == AF_INET6)
+    {
+        sockaddr_in6 addr{};
+        std::memcpy(&addr, &address, sizeof(addr));
+
+        std::array<std::uint8_t, 16> bytes{};
+        std::memcpy(bytes.data(), &addr.sin6_addr, bytes.size());
+
+        // Report the IPv4 peers of dual-stack sockets with their IPv4 address
+        constexpr std::array<std::uint8_t, 12> mappedPrefix{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xFF, 0xFF};
+        if (std::equal(mappedPrefix.begin(), mappedPrefix.end(), bytes.begin()))
+            return IpAddress(bytes[12], bytes[13], bytes[14], bytes[15]);
+
+        return IpAddress(bytes);
+    }
+
+    return std::nullopt;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned short SocketImpl::getPort(const sockaddr& address)
+{
+    if (address.sa_family == AF_INET)
+    {
+        sockaddr_in addr{};
+        std::memcpy(&addr, &address, sizeof(addr));
+        return ntohs(addr.sin_port);
+    }
+
+    if (address.sa_family == AF_INET6)
+    {
+        sockaddr_in6 addr{};
+        std::memcpy(&addr, &address, sizeof(addr));
+        return ntohs(addr.sin6_port);
+    }
+
+    return 0;
+}
+
+
+////////////////////////////////////////////////////////////
+int SocketImpl::getProtocolFamily(IpAddress::Type type)
+{
+    return (type == IpAddress::Type::IpV6) ? PF_INET6 : PF_INET;
+}
+
+
 ////////////////////////////////////////////////////////////
 SocketHandle SocketImpl::invalidSocket()
 {
@@ -89,6 +185,18 @@ void SocketImpl::setBlocking(SocketHandle sock, bool block)
 }
 
 
+////////////////////////////////////////////////////////////
+SocketHandle SocketImpl::accept(SocketHandle listener, Address& address, bool block)
+{
+    // Accepted sockets inherit the blocking state of the listener
+    const SocketHandle sock = ::accept(listener, address.get(), &address.length);
+    if (sock != invalidSocket())
+        setBlocking(sock, block);
+
+    return sock;
+}
+
+
 ////////////////////////////////////////////////////////////
 Socket::Status SocketImpl::getErrorStatus()
 {
@@ -107,4 +215,40 @@ Socket::Status SocketImpl::getErrorStatus()
     }
     // clang-format on
 }
+
+
+////////////////////////////////////////////////////////////
+std::int64_t SocketImpl::sendBuffers(SocketHandle sock, const Buffer* buffers, std::size_t count, int flags)
+{
+    count = std::min(count, maxBuffers);
+
+    // WSABUF lengths are 32 bits wide, larger blocks simply result in a partial send
+    std::array<WSABUF, maxBuffers> vectors{};
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        vectors[i].buf = static_cast<CHAR*>(const_cast<void*>(buffers[i].data));
+        vectors[i].len = static_cast<ULONG>(std::min<std::size_t>(buffers[i].size, std::numeric_limits<ULONG>::max()));
+    }
+
+    DWORD sent = 0;
+    if (WSASend(sock, vectors.data(), static_cast<DWORD>(count), &sent, static_cast<DWORD>(flags), nullptr, nullptr) ==
+        SOCKET_ERROR)
+        return -1;
+
+    return static_cast<std::int64_t>(sent);
+}
+
+
+////////////////////////////////////////////////////////////
+int SocketImpl::poll(PollDescriptor* descriptors, std::size_t count, int timeout)
+{
+    // WSAPoll fails right away without descriptors, wait on our own instead
+    if (count == 0)
+    {
+        Sleep(timeout < 0 ? INFINITE : static_cast<DWORD>(timeout));
+        return 0;
+    }
+
+    return WSAPoll(descriptors, static_cast<ULONG>(count), timeout);
+}
 } // namespace sf::priv
@@ -0,0 +1,33 @@
+#include <SFML/Audio/AudioBlock.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <type_traits>
+
+TEST_CASE("[Audio] sf::AudioBlock")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_copy_constructible_v<sf::AudioBlock>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::AudioBlock>);
+        STATIC_CHECK(sf::AudioBlock::MaxFrameCount > 0);
+        STATIC_CHECK(sf::AudioBlock::Alignment % alignof(float) == 0);
+    }
+
+    SECTION("Construction")
+    {
+        std::array<float, 4>  left{};
+        std::array<float, 4>  right{};
+        std::array<float*, 2> channels{left.data(), right.data()};
+
+        const sf::AudioBlock block(channels.data(), 2, 3);
+        CHECK(block.getChannelCount() == 2);
+        CHECK(block.getFrameCount() == 3);
+        CHECK(block.getChannel(0) == left.data());
+        CHECK(block.getChannel(1) == right.data());
+
+        block.getChannel(1)[2] = 0.5f;
+        CHECK(right[2] == 0.5f);
+    }
+}
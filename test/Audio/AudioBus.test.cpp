@@ -0,0 +1,188 @@
+#include <SFML/Audio/AudioBus.hpp>
+
+// Other 1st party headers
+#include <SFML/Audio/AudioBlock.hpp>
+#include <SFML/Audio/AudioEffect.hpp>
+#include <SFML/Audio/GainEffect.hpp>
+#include <SFML/Audio/PlaybackDevice.hpp>
+#include <SFML/Audio/Sound.hpp>
+#include <SFML/Audio/SoundBuffer.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <AudioUtil.hpp>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <cstdint>
+
+namespace
+{
+class BlockCounter : public sf::AudioEffect
+{
+public:
+    void prepare(unsigned int sampleRate, unsigned int channelCount) override
+    {
+        preparedSampleRate   = sampleRate;
+        preparedChannelCount = channelCount;
+    }
+
+    void process(sf::AudioBlock& block) override
+    {
+        if (block.getFrameCount() > sf::AudioBlock::MaxFrameCount || block.getChannelCount() != preparedChannelCount)
+            invalidBlocks.fetch_add(1);
+
+        for (unsigned int channel = 0; channel < block.getChannelCount(); ++channel)
+        {
+            if (reinterpret_cast<std::uintptr_t>(block.getChannel(channel)) % sf::AudioBlock::Alignment != 0)
+                invalidBlocks.fetch_add(1);
+        }
+
+        blocks.fetch_add(1);
+    }
+
+    std::atomic<unsigned int> preparedSampleRate{};
+    std::atomic<unsigned int> preparedChannelCount{};
+    std::atomic<int>          blocks{};
+    std::atomic<int>          invalidBlocks{};
+};
+
+bool waitForBlocks(const BlockCounter& counter)
+{
+    for (int i = 0; i < 200 && counter.blocks == 0; ++i)
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+    return counter.blocks > 0;
+}
+} // namespace
+
+TEST_CASE("[Audio] sf::AudioBus", runAudioDeviceTests())
+{
+    [[maybe_unused]] auto result = sf::PlaybackDevice::setDeviceToNull();
+
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::AudioBus>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::AudioBus>);
+        STATIC_CHECK(!std::is_move_constructible_v<sf::AudioBus>);
+        STATIC_CHECK(!std::is_move_assignable_v<sf::AudioBus>);
+    }
+
+    SECTION("Construction")
+    {
+        const sf::AudioBus bus;
+        CHECK(bus.getEffectCount() == 0);
+        CHECK(bus.getOutput() == nullptr);
+        CHECK(bus.getVolume() == 100);
+    }
+
+    SECTION("Set/get volume")
+    {
+        sf::AudioBus bus;
+        bus.setVolume(50);
+        CHECK(bus.getVolume() == 50);
+    }
+
+    SECTION("Effects")
+    {
+        sf::AudioBus bus;
+        auto         gain    = std::make_shared<sf::GainEffect>(0.5f);
+        auto         counter = std::make_shared<BlockCounter>();
+        bus.addEffect(gain);
+        bus.addEffect(counter);
+        bus.addEffect(nullptr);
+        CHECK(bus.getEffectCount() == 2);
+
+        // Effects are prepared for the format of the bus
+        CHECK(counter->preparedSampleRate > 0);
+        CHECK(counter->preparedChannelCount > 0);
+
+        // Effects run even without any input so that their tails ring out
+        CHECK(waitForBlocks(*counter));
+        CHECK(counter->invalidBlocks == 0);
+
+        bus.removeEffect(*gain);
+        CHECK(bus.getEffectCount() == 1);
+        bus.clearEffects();
+        CHECK(bus.getEffectCount() == 0);
+    }
+
+    SECTION("Output")
+    {
+        sf::AudioBus master;
+        sf::AudioBus sfx;
+        sf::AudioBus reverb;
+
+        sfx.setOutput(&master);
+        reverb.setOutput(&sfx);
+        CHECK(sfx.getOutput() == &master);
+        CHECK(reverb.getOutput() == &sfx);
+
+        // Loops are rejected
+        master.setOutput(&reverb);
+        CHECK(master.getOutput() == nullptr);
+        master.setOutput(&master);
+        CHECK(master.getOutput() == nullptr);
+
+        // Processing flows through the chain of buses
+        auto counter = std::make_shared<BlockCounter>();
+        master.addEffect(counter);
+        CHECK(waitForBlocks(*counter));
+
+        {
+            sf::AudioBus temporary;
+            reverb.setOutput(&temporary);
+            CHECK(reverb.getOutput() == &temporary);
+        }
+
+        // Destroying a bus routes its inputs to the playback device
+        CHECK(reverb.getOutput() == nullptr);
+    }
+
+    SECTION("Sound routing")
+    {
+        const std::vector<std::int16_t> samples(44100, 1000);
+        const sf::SoundBuffer           soundBuffer(samples.data(), samples.size(), 1, 44100, {sf::SoundChannel::Mono});
+
+        sf::Sound sound(soundBuffer);
+        CHECK(sound.getBus() == nullptr);
+
+        sf::AudioBus bus;
+        sound.setBus(&bus);
+        CHECK(sound.getBus() == &bus);
+
+        // Copies are routed into the same bus
+        const sf::Sound copy(sound);
+        CHECK(copy.getBus() == &bus);
+
+        sound.play();
+        sound.setBus(nullptr);
+        CHECK(sound.getBus() == nullptr);
+        sound.setBus(&bus);
+
+        {
+            sf::AudioBus temporary;
+            sound.setBus(&temporary);
+        }
+
+        CHECK(sound.getBus() == nullptr);
+        CHECK(sound.getStatus() == sf::Sound::Status::Playing);
+    }
+
+    SECTION("Device change")
+    {
+        sf::AudioBus bus;
+        auto         counter = std::make_shared<BlockCounter>();
+        bus.addEffect(counter);
+
+        // Effects are prepared again when the bus is recreated for the new device
+        counter->preparedChannelCount = 0;
+        CHECK(sf::PlaybackDevice::setDeviceToNull());
+        CHECK(counter->preparedChannelCount > 0);
+        CHECK(bus.getEffectCount() == 1);
+    }
+}
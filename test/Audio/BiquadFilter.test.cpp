@@ -0,0 +1,96 @@
+#include <SFML/Audio/BiquadFilter.hpp>
+
+// Other 1st party headers
+#include <SFML/Audio/AudioBlock.hpp>
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <array>
+#include <type_traits>
+
+#include <cmath>
+
+namespace
+{
+// Feed a sine wave through the filter and return the peak amplitude once the filter has settled
+float measureGain(sf::BiquadFilter& filter, float frequency)
+{
+    filter.prepare(48000, 1);
+
+    std::array<float, sf::AudioBlock::MaxFrameCount> samples{};
+    std::array<float*, 1>                            channels{samples.data()};
+    float                                            peak = 0.f;
+
+    for (std::size_t blockIndex = 0; blockIndex < 100; ++blockIndex)
+    {
+        for (std::size_t i = 0; i < samples.size(); ++i)
+        {
+            const auto frame = static_cast<float>(blockIndex * samples.size() + i);
+            samples[i]       = std::sin(2.f * 3.14159265f * frequency * frame / 48000.f);
+        }
+
+        sf::AudioBlock block(channels.data(), 1, samples.size());
+        filter.process(block);
+
+        if (blockIndex >= 50)
+            for (const float sample : samples)
+                peak = std::max(peak, std::abs(sample));
+    }
+
+    return peak;
+}
+} // namespace
+
+TEST_CASE("[Audio] sf::BiquadFilter")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_base_of_v<sf::AudioEffect, sf::BiquadFilter>);
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::BiquadFilter>);
+    }
+
+    SECTION("Construction")
+    {
+        const sf::BiquadFilter filter;
+        CHECK(filter.getType() == sf::BiquadFilter::Type::LowPass);
+        CHECK(filter.getFrequency() == 1000.f);
+        CHECK(filter.getQuality() == 0.7071f);
+        CHECK(filter.getGain() == 0.f);
+    }
+
+    SECTION("Set/get parameters")
+    {
+        sf::BiquadFilter filter;
+        filter.setType(sf::BiquadFilter::Type::Peak);
+        filter.setFrequency(440.f);
+        filter.setQuality(2.f);
+        filter.setGain(-6.f);
+        CHECK(filter.getType() == sf::BiquadFilter::Type::Peak);
+        CHECK(filter.getFrequency() == 440.f);
+        CHECK(filter.getQuality() == 2.f);
+        CHECK(filter.getGain() == -6.f);
+    }
+
+    SECTION("Low pass")
+    {
+        sf::BiquadFilter filter(sf::BiquadFilter::Type::LowPass, 1000.f);
+        CHECK(measureGain(filter, 100.f) == Catch::Approx(1.f).margin(0.01));
+        CHECK(measureGain(filter, 10000.f) < 0.02f);
+    }
+
+    SECTION("High pass")
+    {
+        sf::BiquadFilter filter(sf::BiquadFilter::Type::HighPass, 1000.f);
+        CHECK(measureGain(filter, 100.f) < 0.02f);
+        CHECK(measureGain(filter, 10000.f) == Catch::Approx(1.f).margin(0.01));
+    }
+
+    SECTION("Peak")
+    {
+        sf::BiquadFilter filter(sf::BiquadFilter::Type::Peak, 1000.f, 1.f, 6.f);
+        CHECK(measureGain(filter, 1000.f) == Catch::Approx(std::pow(10.f, 6.f / 20.f)).margin(0.01));
+        CHECK(measureGain(filter, 20.f) == Catch::Approx(1.f).margin(0.01));
+    }
+}
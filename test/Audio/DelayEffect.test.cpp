@@ -0,0 +1,61 @@
+#include <SFML/Audio/DelayEffect.hpp>
+
+// Other 1st party headers
+#include <SFML/Audio/AudioBlock.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <SystemUtil.hpp>
+#include <array>
+#include <type_traits>
+
+TEST_CASE("[Audio] sf::DelayEffect")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_base_of_v<sf::AudioEffect, sf::DelayEffect>);
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::DelayEffect>);
+    }
+
+    SECTION("Construction")
+    {
+        const sf::DelayEffect delay;
+        CHECK(delay.getDelay() == sf::milliseconds(500));
+        CHECK(delay.getFeedback() == 0.5f);
+        CHECK(delay.getMix() == 0.5f);
+    }
+
+    SECTION("Set/get parameters")
+    {
+        sf::DelayEffect delay(sf::seconds(2));
+        delay.setDelay(sf::seconds(3));
+        CHECK(delay.getDelay() == sf::seconds(2));
+        delay.setDelay(sf::milliseconds(250));
+        CHECK(delay.getDelay() == sf::milliseconds(250));
+        delay.setFeedback(2.f);
+        CHECK(delay.getFeedback() == 0.99f);
+        delay.setMix(-1.f);
+        CHECK(delay.getMix() == 0.f);
+    }
+
+    SECTION("Process")
+    {
+        // One frame per millisecond makes the delay easy to reason about
+        sf::DelayEffect delay(sf::milliseconds(10));
+        delay.setDelay(sf::milliseconds(3));
+        delay.setFeedback(0.5f);
+        delay.setMix(1.f);
+        delay.prepare(1000, 1);
+
+        std::array<float, 8>  samples{1.f};
+        std::array<float*, 1> channels{samples.data()};
+        sf::AudioBlock        block(channels.data(), 1, samples.size());
+        delay.process(block);
+        CHECK(samples == std::array{0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.5f, 0.f});
+
+        // The echoes carry over into the next block
+        samples.fill(0.f);
+        delay.process(block);
+        CHECK(samples == std::array{0.f, 0.25f, 0.f, 0.f, 0.125f, 0.f, 0.f, 0.0625f});
+    }
+}
@@ -0,0 +1,47 @@
+#include <SFML/Audio/GainEffect.hpp>
+
+// Other 1st party headers
+#include <SFML/Audio/AudioBlock.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <type_traits>
+
+TEST_CASE("[Audio] sf::GainEffect")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_base_of_v<sf::AudioEffect, sf::GainEffect>);
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::GainEffect>);
+    }
+
+    SECTION("Construction")
+    {
+        CHECK(sf::GainEffect().getGain() == 1.f);
+        CHECK(sf::GainEffect(0.5f).getGain() == 0.5f);
+    }
+
+    SECTION("Process")
+    {
+        std::array<float, 4>  samples{1.f, 1.f, 1.f, 1.f};
+        std::array<float*, 1> channels{samples.data()};
+        sf::AudioBlock        block(channels.data(), 1, samples.size());
+
+        sf::GainEffect gain(0.5f);
+        gain.prepare(44100, 1);
+        gain.process(block);
+        CHECK(samples == std::array{0.5f, 0.5f, 0.5f, 0.5f});
+
+        // Changes are ramped over the next block
+        samples.fill(1.f);
+        gain.setGain(0.f);
+        CHECK(gain.getGain() == 0.f);
+        gain.process(block);
+        CHECK(samples == std::array{0.375f, 0.25f, 0.125f, 0.f});
+
+        samples.fill(1.f);
+        gain.process(block);
+        CHECK(samples == std::array{0.f, 0.f, 0.f, 0.f});
+    }
+}
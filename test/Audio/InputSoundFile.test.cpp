@@ -10,6 +10,8 @@
 
 #include <SystemUtil.hpp>
 #include <array>
+#include <filesystem>
+#include <optional>
 #include <type_traits>
 
 TEST_CASE("[Audio] sf::InputSoundFile")
@@ -396,6 +398,88 @@ TEST_CASE("[Audio] sf::InputSoundFile")
         }
     }
 
+    SECTION("getSeekIndex()")
+    {
+        SECTION("No file")
+        {
+            const sf::InputSoundFile inputSoundFile;
+            CHECK(!inputSoundFile.getSeekIndex());
+        }
+
+        SECTION("flac")
+        {
+            const sf::InputSoundFile inputSoundFile("ding.flac");
+            CHECK(!inputSoundFile.getSeekIndex());
+        }
+
+        SECTION("mp3")
+        {
+            const sf::InputSoundFile           inputSoundFile("ding.mp3");
+            const std::optional<sf::SeekIndex> seekIndex = inputSoundFile.getSeekIndex();
+            REQUIRE(seekIndex);
+            CHECK(seekIndex->getStreamSize() == std::filesystem::file_size("ding.mp3"));
+            CHECK(seekIndex->getSampleCount() == 87'798);
+            REQUIRE(!seekIndex->getPoints().empty());
+            CHECK(seekIndex->getPoints().front().sampleOffset == 0);
+        }
+
+        SECTION("ogg")
+        {
+            sf::InputSoundFile inputSoundFile("doodle_pop.ogg");
+            CHECK(!inputSoundFile.getSeekIndex());
+
+            // Points are recorded while reading
+            std::array<std::int16_t, 4'096> samples{};
+            while (inputSoundFile.read(samples.data(), samples.size()) > 0)
+                ;
+
+            const std::optional<sf::SeekIndex> seekIndex = inputSoundFile.getSeekIndex();
+            REQUIRE(seekIndex);
+            CHECK(seekIndex->getSampleCount() == 2'116'992);
+            CHECK(seekIndex->getPoints().size() >= 20);
+        }
+    }
+
+    SECTION("setSeekIndex()")
+    {
+        const std::filesystem::path filename = GENERATE("ding.mp3", "doodle_pop.ogg");
+        INFO("Filename: " << filename.string());
+
+        // Build the index once, by reading the file through
+        sf::InputSoundFile              reference(filename);
+        std::array<std::int16_t, 4'096> samples{};
+        while (reference.read(samples.data(), samples.size()) > 0)
+            ;
+        const std::optional<sf::SeekIndex> seekIndex = reference.getSeekIndex();
+        REQUIRE(seekIndex);
+
+        sf::InputSoundFile inputSoundFile;
+        inputSoundFile.setSeekIndex(*seekIndex);
+        REQUIRE(inputSoundFile.openFromFile(filename));
+        CHECK(inputSoundFile.getSampleCount() == reference.getSampleCount());
+        CHECK(inputSoundFile.getSeekIndex()->getPoints().size() == seekIndex->getPoints().size());
+
+        // Seeking with the index gives the same samples as seeking without it
+        const std::uint64_t sampleCount = reference.getSampleCount();
+        for (const std::uint64_t offset : {sampleCount / 2, sampleCount / 8, sampleCount * 7 / 8})
+        {
+            std::array<std::int16_t, 64> expected{};
+            std::array<std::int16_t, 64> actual{};
+            reference.seek(offset);
+            inputSoundFile.seek(offset);
+            CHECK(reference.read(expected.data(), expected.size()) == expected.size());
+            CHECK(inputSoundFile.read(actual.data(), actual.size()) == actual.size());
+            CHECK(actual == expected);
+        }
+
+        SECTION("Index of another file")
+        {
+            inputSoundFile.setSeekIndex(sf::SeekIndex(1, 2, {{0, 0}}));
+            REQUIRE(inputSoundFile.openFromFile(filename));
+            CHECK(inputSoundFile.getSampleCount() == reference.getSampleCount());
+        }
+    }
+
     SECTION("close()")
     {
         sf::InputSoundFile inputSoundFile("ding.flac");
@@ -0,0 +1,70 @@
+#include <SFML/Audio/LimiterEffect.hpp>
+
+// Other 1st party headers
+#include <SFML/Audio/AudioBlock.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <SystemUtil.hpp>
+#include <array>
+#include <type_traits>
+
+TEST_CASE("[Audio] sf::LimiterEffect")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_base_of_v<sf::AudioEffect, sf::LimiterEffect>);
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::LimiterEffect>);
+    }
+
+    SECTION("Construction")
+    {
+        const sf::LimiterEffect limiter;
+        CHECK(limiter.getThreshold() == 1.f);
+        CHECK(limiter.getRelease() == sf::milliseconds(100));
+        CHECK(limiter.getCurrentGain() == 1.f);
+    }
+
+    SECTION("Set/get parameters")
+    {
+        sf::LimiterEffect limiter;
+        limiter.setThreshold(0.5f);
+        CHECK(limiter.getThreshold() == 0.5f);
+        limiter.setThreshold(-1.f);
+        CHECK(limiter.getThreshold() == 0.f);
+        limiter.setRelease(sf::seconds(1));
+        CHECK(limiter.getRelease() == sf::seconds(1));
+    }
+
+    SECTION("Process")
+    {
+        sf::LimiterEffect limiter(0.5f, sf::milliseconds(10));
+        limiter.prepare(1000, 2);
+
+        std::array<float, 4>  left{0.25f, 1.f, 0.25f, 0.25f};
+        std::array<float, 4>  right{0.25f, -0.25f, 0.25f, 0.25f};
+        std::array<float*, 2> channels{left.data(), right.data()};
+        sf::AudioBlock        block(channels.data(), 2, left.size());
+        limiter.process(block);
+
+        // The peak is brought down to the threshold instantly and both channels share the gain
+        CHECK(left[0] == 0.25f);
+        CHECK(left[1] == Approx(0.5f));
+        CHECK(right[1] == Approx(-0.125f));
+        CHECK(left[2] > 0.125f);
+        CHECK(left[2] < 0.25f);
+        CHECK(left[3] > left[2]);
+        CHECK(limiter.getCurrentGain() < 1.f);
+
+        // The gain fully recovers after a while
+        for (int i = 0; i < 100; ++i)
+        {
+            left.fill(0.25f);
+            right.fill(0.25f);
+            limiter.process(block);
+        }
+
+        CHECK(left[3] == Approx(0.25f));
+        CHECK(limiter.getCurrentGain() == Approx(1.f));
+    }
+}
@@ -40,4 +40,14 @@ TEST_CASE("[Audio] sf::OutputSoundFile")
         outputSoundFile.close();
         CHECK(std::filesystem::remove(filename));
     }
+
+    SECTION("setQuality()")
+    {
+        sf::OutputSoundFile outputSoundFile;
+        outputSoundFile.setQuality(GENERATE(0.f, 1.f));
+        CHECK(outputSoundFile.openFromFile(filename, 44'100, static_cast<unsigned int>(channelMap.size()), channelMap));
+        CHECK(std::filesystem::exists(filename));
+        outputSoundFile.close();
+        CHECK(std::filesystem::remove(filename));
+    }
 }
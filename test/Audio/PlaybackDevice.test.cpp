@@ -0,0 +1,100 @@
+#include <SFML/Audio/PlaybackDevice.hpp>
+
+// Other 1st party headers
+#include <SFML/Audio/InputSoundFile.hpp>
+#include <SFML/Audio/OutputSoundFile.hpp>
+#include <SFML/Audio/Sound.hpp>
+#include <SFML/Audio/SoundBuffer.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <AudioUtil.hpp>
+#include <SystemUtil.hpp>
+#include <algorithm>
+#include <filesystem>
+#include <vector>
+
+#include <cstdint>
+
+namespace
+{
+std::vector<std::int16_t> renderKilldeer(std::uint64_t frameCount)
+{
+    const sf::SoundBuffer soundBuffer("killdeer.wav");
+    sf::Sound             sound(soundBuffer);
+    sound.play();
+
+    std::vector<std::int16_t> samples(frameCount * 2);
+    CHECK(sf::PlaybackDevice::render(samples.data(), frameCount));
+    return samples;
+}
+} // namespace
+
+TEST_CASE("[Audio] sf::PlaybackDevice", runAudioDeviceTests())
+{
+    SECTION("setDeviceToOffline()")
+    {
+        CHECK(!sf::PlaybackDevice::setDeviceToOffline(0, 44100));
+        CHECK(!sf::PlaybackDevice::setDeviceToOffline(2, 0));
+
+        REQUIRE(sf::PlaybackDevice::setDeviceToOffline(2, 48000));
+        CHECK(sf::PlaybackDevice::isOffline());
+        CHECK(sf::PlaybackDevice::getDeviceSampleRate() == 48000);
+        CHECK(sf::PlaybackDevice::getDeviceChannelCount() == 2);
+
+        REQUIRE(sf::PlaybackDevice::setDeviceToNull());
+        CHECK(!sf::PlaybackDevice::isOffline());
+    }
+
+    SECTION("render()")
+    {
+        SECTION("Not offline")
+        {
+            REQUIRE(sf::PlaybackDevice::setDeviceToNull());
+            std::vector<std::int16_t> samples(64);
+            CHECK(!sf::PlaybackDevice::render(samples.data(), 32));
+        }
+
+        REQUIRE(sf::PlaybackDevice::setDeviceToOffline(2, 44100));
+
+        SECTION("Silence")
+        {
+            std::vector<std::int16_t> samples(2048, 1);
+            CHECK(sf::PlaybackDevice::render(samples.data(), 1024));
+            CHECK(std::all_of(samples.begin(), samples.end(), [](std::int16_t sample) { return sample == 0; }));
+        }
+
+        SECTION("Deterministic")
+        {
+            const auto first  = renderKilldeer(44100);
+            const auto second = renderKilldeer(44100);
+            CHECK(std::any_of(first.begin(), first.end(), [](std::int16_t sample) { return sample != 0; }));
+            CHECK(first == second);
+        }
+
+        SECTION("To file")
+        {
+            const auto filename = std::filesystem::temp_directory_path() / "offline_render.wav";
+
+            {
+                const sf::SoundBuffer soundBuffer("killdeer.wav");
+                sf::Sound             sound(soundBuffer);
+                sf::OutputSoundFile   outputSoundFile(filename,
+                                                    44100,
+                                                    2,
+                                                    {sf::SoundChannel::FrontLeft, sf::SoundChannel::FrontRight});
+                sound.play();
+                CHECK(sf::PlaybackDevice::render(outputSoundFile, sf::seconds(0.5f)));
+            }
+
+            const sf::InputSoundFile inputSoundFile(filename);
+            CHECK(inputSoundFile.getSampleCount() == 44100);
+            CHECK(inputSoundFile.getChannelCount() == 2);
+            CHECK(inputSoundFile.getSampleRate() == 44100);
+
+            CHECK(std::filesystem::remove(filename));
+        }
+    }
+
+    [[maybe_unused]] const auto result = sf::PlaybackDevice::setDeviceToNull();
+}
@@ -0,0 +1,78 @@
+#include <SFML/Audio/ReverbEffect.hpp>
+
+// Other 1st party headers
+#include <SFML/Audio/AudioBlock.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <array>
+#include <type_traits>
+
+#include <cmath>
+
+TEST_CASE("[Audio] sf::ReverbEffect")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_base_of_v<sf::AudioEffect, sf::ReverbEffect>);
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::ReverbEffect>);
+    }
+
+    SECTION("Construction")
+    {
+        const sf::ReverbEffect reverb;
+        CHECK(reverb.getRoomSize() == 0.5f);
+        CHECK(reverb.getDamping() == 0.5f);
+        CHECK(reverb.getMix() == 0.3f);
+    }
+
+    SECTION("Set/get parameters")
+    {
+        sf::ReverbEffect reverb;
+        reverb.setRoomSize(0.8f);
+        CHECK(reverb.getRoomSize() == 0.8f);
+        reverb.setDamping(2.f);
+        CHECK(reverb.getDamping() == 1.f);
+        reverb.setMix(-1.f);
+        CHECK(reverb.getMix() == 0.f);
+    }
+
+    SECTION("Process")
+    {
+        sf::ReverbEffect reverb;
+        reverb.setMix(1.f);
+        reverb.prepare(44100, 2);
+
+        std::array<float, sf::AudioBlock::MaxFrameCount> left{1.f};
+        std::array<float, sf::AudioBlock::MaxFrameCount> right{1.f};
+        std::array<float*, 2>                            channels{left.data(), right.data()};
+        sf::AudioBlock                                   block(channels.data(), 2, left.size());
+
+        // An impulse produces a tail that starts after the shortest comb filter delay
+        bool  leftHeard  = false;
+        bool  rightHeard = false;
+        float difference = 0.f;
+
+        for (int i = 0; i < 20; ++i)
+        {
+            reverb.process(block);
+
+            for (std::size_t j = 0; j < left.size(); ++j)
+            {
+                leftHeard  = leftHeard || left[j] != 0.f;
+                rightHeard = rightHeard || right[j] != 0.f;
+                difference = std::max(difference, std::abs(left[j] - right[j]));
+            }
+
+            left.fill(0.f);
+            right.fill(0.f);
+        }
+
+        CHECK(leftHeard);
+        CHECK(rightHeard);
+
+        // The channels are decorrelated
+        CHECK(difference > 0.f);
+    }
+}
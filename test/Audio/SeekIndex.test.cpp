@@ -0,0 +1,95 @@
+#include <SFML/Audio/SeekIndex.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <type_traits>
+
+TEST_CASE("[Audio] sf::SeekIndex")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_copy_constructible_v<sf::SeekIndex>);
+        STATIC_CHECK(std::is_copy_assignable_v<sf::SeekIndex>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::SeekIndex>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::SeekIndex>);
+    }
+
+    SECTION("Construction")
+    {
+        SECTION("Default constructor")
+        {
+            const sf::SeekIndex seekIndex;
+            CHECK(seekIndex.getStreamSize() == 0);
+            CHECK(seekIndex.getSampleCount() == 0);
+            CHECK(seekIndex.getPoints().empty());
+        }
+
+        SECTION("Points constructor")
+        {
+            const sf::SeekIndex seekIndex(1'000, 4'608, {{0, 10}, {1'152, 400}});
+            CHECK(seekIndex.getStreamSize() == 1'000);
+            CHECK(seekIndex.getSampleCount() == 4'608);
+            REQUIRE(seekIndex.getPoints().size() == 2);
+            CHECK(seekIndex.getPoints()[1].sampleOffset == 1'152);
+            CHECK(seekIndex.getPoints()[1].byteOffset == 400);
+        }
+    }
+
+    const auto filename = std::filesystem::temp_directory_path() / "sfml-seek-index.idx";
+
+    SECTION("saveToFile() and loadFromFile()")
+    {
+        const sf::SeekIndex seekIndex(5'000'000'000,
+                                      6'000'000'000,
+                                      {{0, 10}, {1'152, 400}, {4'000'000'000, 4'999'999'999}});
+        REQUIRE(seekIndex.saveToFile(filename));
+
+        sf::SeekIndex loadedIndex;
+        REQUIRE(loadedIndex.loadFromFile(filename));
+        CHECK(loadedIndex.getStreamSize() == 5'000'000'000);
+        CHECK(loadedIndex.getSampleCount() == 6'000'000'000);
+        REQUIRE(loadedIndex.getPoints().size() == 3);
+        CHECK(loadedIndex.getPoints()[2].sampleOffset == 4'000'000'000);
+        CHECK(loadedIndex.getPoints()[2].byteOffset == 4'999'999'999);
+        CHECK(std::filesystem::remove(filename));
+    }
+
+    SECTION("loadFromFile()")
+    {
+        sf::SeekIndex seekIndex(1'000, 4'608, {{0, 10}});
+
+        SECTION("Invalid filename")
+        {
+            CHECK(!seekIndex.loadFromFile("does/not/exist.idx"));
+        }
+
+        SECTION("Invalid file")
+        {
+            std::ofstream(filename, std::ios_base::binary) << "not a seek index";
+            CHECK(!seekIndex.loadFromFile(filename));
+            CHECK(std::filesystem::remove(filename));
+        }
+
+        SECTION("Truncated file")
+        {
+            REQUIRE(sf::SeekIndex(1'000, 4'608, {{0, 10}, {1'152, 400}}).saveToFile(filename));
+            std::filesystem::resize_file(filename, std::filesystem::file_size(filename) - 1);
+            CHECK(!seekIndex.loadFromFile(filename));
+            CHECK(std::filesystem::remove(filename));
+        }
+
+        SECTION("Unsorted points")
+        {
+            REQUIRE(sf::SeekIndex(1'000, 4'608, {{1'152, 400}, {0, 10}}).saveToFile(filename));
+            CHECK(!seekIndex.loadFromFile(filename));
+            CHECK(std::filesystem::remove(filename));
+        }
+
+        // A failed load leaves the index untouched
+        CHECK(seekIndex.getStreamSize() == 1'000);
+        CHECK(seekIndex.getSampleCount() == 4'608);
+        CHECK(seekIndex.getPoints().size() == 1);
+    }
+}
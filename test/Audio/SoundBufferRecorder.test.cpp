@@ -1,8 +1,48 @@
 #include <SFML/Audio/SoundBufferRecorder.hpp>
 
+#include <SFML/System/Sleep.hpp>
+#include <SFML/System/Time.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <AudioUtil.hpp>
+#include <SystemUtil.hpp>
 #include <type_traits>
 
 static_assert(!std::is_copy_constructible_v<sf::SoundBufferRecorder>);
 static_assert(!std::is_copy_assignable_v<sf::SoundBufferRecorder>);
 static_assert(!std::is_nothrow_move_constructible_v<sf::SoundBufferRecorder>);
 static_assert(!std::is_nothrow_move_assignable_v<sf::SoundBufferRecorder>);
+
+TEST_CASE("[Audio] sf::SoundBufferRecorder", runAudioDeviceTests())
+{
+    SECTION("Construction")
+    {
+        const sf::SoundBufferRecorder recorder;
+        CHECK(recorder.getProcessingInterval() == sf::milliseconds(100));
+        CHECK(recorder.getOverrunCount() == 0);
+        CHECK(recorder.getDroppedSampleCount() == 0);
+        CHECK(recorder.getBuffer().getSampleCount() == 0);
+    }
+
+    SECTION("Set/get processing interval")
+    {
+        sf::SoundBufferRecorder recorder;
+        recorder.setProcessingInterval(sf::milliseconds(20));
+        CHECK(recorder.getProcessingInterval() == sf::milliseconds(20));
+    }
+
+    SECTION("start()/stop()")
+    {
+        if (!sf::SoundBufferRecorder::isAvailable())
+            return;
+
+        sf::SoundBufferRecorder recorder;
+        recorder.setProcessingInterval(sf::milliseconds(10));
+        REQUIRE(recorder.start());
+        sf::sleep(sf::milliseconds(100));
+        recorder.stop();
+        CHECK(recorder.getBuffer().getSampleRate() == 44100);
+        CHECK(recorder.getBuffer().getSampleCount() > 0);
+    }
+}
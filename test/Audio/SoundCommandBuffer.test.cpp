@@ -0,0 +1,109 @@
+#include <SFML/Audio/SoundCommandBuffer.hpp>
+
+// Other 1st party headers
+#include <SFML/Audio/PlaybackDevice.hpp>
+#include <SFML/Audio/Sound.hpp>
+#include <SFML/Audio/SoundBuffer.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <AudioUtil.hpp>
+#include <SystemUtil.hpp>
+#include <chrono>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <cstdint>
+
+TEST_CASE("[Audio] sf::SoundCommandBuffer", runAudioDeviceTests())
+{
+    [[maybe_unused]] auto result = sf::PlaybackDevice::setDeviceToNull();
+
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::SoundCommandBuffer>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::SoundCommandBuffer>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::SoundCommandBuffer>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::SoundCommandBuffer>);
+    }
+
+    const std::vector<std::int16_t> samples(44100, 1000);
+    const sf::SoundBuffer           soundBuffer(samples.data(), samples.size(), 1, 44100, {sf::SoundChannel::Mono});
+
+    SECTION("Construction")
+    {
+        const sf::SoundCommandBuffer commands;
+        CHECK(commands.getCommandCount() == 0);
+    }
+
+    SECTION("Record and clear")
+    {
+        sf::Sound              sound(soundBuffer);
+        sf::SoundCommandBuffer commands;
+        commands.setPitch(sound, 2);
+        commands.setVolume(sound, 50);
+        commands.setPosition(sound, {1, 2, 3});
+        CHECK(commands.getCommandCount() == 3);
+
+        // Nothing changes before the commands are submitted
+        CHECK(sound.getPitch() == 1);
+        CHECK(sound.getVolume() == 100);
+        CHECK(sound.getPosition() == sf::Vector3f());
+
+        commands.clear();
+        CHECK(commands.getCommandCount() == 0);
+    }
+
+    SECTION("Submit")
+    {
+        sf::Sound              first(soundBuffer);
+        sf::Sound              second(soundBuffer);
+        sf::SoundCommandBuffer commands;
+
+        // Submit several batches so storage gets recycled, later changes win
+        for (int i = 0; i < 3; ++i)
+        {
+            commands.setPitch(first, 0.5f);
+            commands.setPan(first, -1);
+            commands.setVolume(second, 50);
+            commands.setVolume(second, 25);
+            commands.setPosition(first, {1, 2, 3});
+            commands.setDirection(second, {0, 1, 0});
+            commands.setVelocity(second, {4, 5, 6});
+            commands.submit();
+            CHECK(commands.getCommandCount() == 0);
+        }
+
+        // The audio thread applies the batches at the start of its next cycle
+        for (int i = 0; i < 200 && second.getVelocity() != sf::Vector3f(4, 5, 6); ++i)
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+        CHECK(first.getPitch() == 0.5f);
+        CHECK(first.getPan() == -1);
+        CHECK(second.getVolume() == Approx(25.f));
+        CHECK(first.getPosition() == sf::Vector3f(1, 2, 3));
+        CHECK(second.getDirection() == sf::Vector3f(0, 1, 0));
+        CHECK(second.getVelocity() == sf::Vector3f(4, 5, 6));
+    }
+
+    SECTION("Destroy source after submit")
+    {
+        sf::SoundCommandBuffer commands;
+
+        {
+            sf::Sound sound(soundBuffer);
+            commands.setVolume(sound, 10);
+            commands.submit();
+        }
+
+        // Destroying the sound applied the pending commands, later batches still work
+        sf::Sound sound(soundBuffer);
+        commands.setVolume(sound, 10);
+        commands.submit();
+        for (int i = 0; i < 200 && sound.getVolume() == 100; ++i)
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+        CHECK(sound.getVolume() == Approx(10.f));
+    }
+}
@@ -0,0 +1,149 @@
+#include <SFML/Audio/SoundFileTranscoder.hpp>
+
+// Other 1st party headers
+#include <SFML/Audio/InputSoundFile.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <SystemUtil.hpp>
+#include <filesystem>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+namespace
+{
+std::vector<std::int16_t> readAll(const std::filesystem::path& filename)
+{
+    sf::InputSoundFile        file(filename);
+    std::vector<std::int16_t> samples(static_cast<std::size_t>(file.getSampleCount()));
+    samples.resize(static_cast<std::size_t>(file.read(samples.data(), samples.size())));
+    return samples;
+}
+} // namespace
+
+TEST_CASE("[Audio] sf::SoundFileTranscoder")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_default_constructible_v<sf::SoundFileTranscoder>);
+        STATIC_CHECK(std::is_copy_constructible_v<sf::SoundFileTranscoder>);
+        STATIC_CHECK(std::is_copy_assignable_v<sf::SoundFileTranscoder>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::SoundFileTranscoder>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::SoundFileTranscoder>);
+    }
+
+    SECTION("Construction")
+    {
+        const sf::SoundFileTranscoder transcoder;
+        CHECK(transcoder.getThreadCount() == 0);
+        CHECK(!transcoder.getQuality());
+        CHECK(transcoder.getChunkDuration() == sf::seconds(10));
+    }
+
+    SECTION("Set/get settings")
+    {
+        sf::SoundFileTranscoder transcoder;
+        transcoder.setThreadCount(3);
+        transcoder.setQuality(1.5f);
+        transcoder.setChunkDuration(sf::seconds(-1));
+        CHECK(transcoder.getThreadCount() == 3);
+        CHECK(transcoder.getQuality() == 1.f);
+        CHECK(transcoder.getChunkDuration() == sf::Time::Zero);
+    }
+
+    SECTION("run()")
+    {
+        const auto directory = std::filesystem::temp_directory_path();
+
+        std::mutex                                     mutex;
+        std::vector<sf::SoundFileTranscoder::Progress> finished;
+        sf::SoundFileTranscoder                        transcoder;
+        transcoder.setProgressCallback(
+            [&](const sf::SoundFileTranscoder::Progress& progress)
+            {
+                const std::lock_guard lock(mutex);
+                if (progress.status != sf::SoundFileTranscoder::Status::Running)
+                    finished.push_back(progress);
+            });
+
+        SECTION("No jobs")
+        {
+            CHECK(transcoder.run({}));
+            CHECK(finished.empty());
+        }
+
+        SECTION("Valid files")
+        {
+            // Split the files into many small chunks decoded in parallel
+            transcoder.setThreadCount(4);
+            transcoder.setChunkDuration(sf::milliseconds(100));
+
+            const std::vector<sf::SoundFileTranscoder::Job> jobs = {{"killdeer.wav",
+                                                                     directory / "transcoded-killdeer.wav"},
+                                                                    {"ding.mp3", directory / "transcoded-ding.wav"}};
+            CHECK(transcoder.run(jobs));
+
+            REQUIRE(finished.size() == 2);
+            for (const auto& progress : finished)
+            {
+                CHECK(progress.status == sf::SoundFileTranscoder::Status::Succeeded);
+                CHECK(progress.processedSamples == progress.sampleCount);
+            }
+
+            for (const auto& job : jobs)
+            {
+                CHECK(readAll(job.output) == readAll(job.input));
+                CHECK(std::filesystem::remove(job.output));
+            }
+        }
+
+        SECTION("Invalid file")
+        {
+            transcoder.setThreadCount(2);
+
+            const std::vector<sf::SoundFileTranscoder::Job> jobs = {{"does/not/exist.wav",
+                                                                     directory / "transcoded-missing.wav"},
+                                                                    {"ding.mp3", directory / "transcoded-ding.wav"}};
+            CHECK(!transcoder.run(jobs));
+
+            REQUIRE(finished.size() == 2);
+            for (const auto& progress : finished)
+            {
+                CHECK(progress.status == (progress.jobIndex == 0 ? sf::SoundFileTranscoder::Status::Failed
+                                                                 : sf::SoundFileTranscoder::Status::Succeeded));
+            }
+
+            CHECK(!std::filesystem::exists(jobs[0].output));
+            CHECK(std::filesystem::remove(jobs[1].output));
+        }
+
+        SECTION("Truncated file")
+        {
+            // The header announces more samples than the file holds
+            const auto truncated = directory / "truncated-killdeer.wav";
+            std::filesystem::copy_file("killdeer.wav", truncated, std::filesystem::copy_options::overwrite_existing);
+            std::filesystem::resize_file(truncated, std::filesystem::file_size(truncated) / 2);
+
+            SECTION("Split into chunks")
+            {
+                transcoder.setThreadCount(4);
+                transcoder.setChunkDuration(sf::milliseconds(100));
+            }
+
+            SECTION("Single thread")
+            {
+                transcoder.setThreadCount(1);
+            }
+
+            const std::vector<sf::SoundFileTranscoder::Job> jobs = {
+                {truncated, directory / "transcoded-truncated.wav"}};
+            CHECK(!transcoder.run(jobs));
+
+            REQUIRE(finished.size() == 1);
+            CHECK(finished[0].status == sf::SoundFileTranscoder::Status::Failed);
+            CHECK(!std::filesystem::exists(jobs[0].output));
+            CHECK(std::filesystem::remove(truncated));
+        }
+    }
+}
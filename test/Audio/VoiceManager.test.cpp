@@ -0,0 +1,166 @@
+#include <SFML/Audio/VoiceManager.hpp>
+
+// Other 1st party headers
+#include <SFML/Audio/Listener.hpp>
+#include <SFML/Audio/PlaybackDevice.hpp>
+#include <SFML/Audio/Sound.hpp>
+#include <SFML/Audio/SoundBuffer.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <AudioUtil.hpp>
+#include <limits>
+#include <vector>
+
+#include <cstdint>
+
+TEST_CASE("[Audio] sf::VoiceManager", runAudioDeviceTests())
+{
+    [[maybe_unused]] auto result = sf::PlaybackDevice::setDeviceToNull();
+
+    SECTION("Set/get max voices")
+    {
+        CHECK(sf::VoiceManager::getMaxVoices() == 0);
+        sf::VoiceManager::setMaxVoices(8);
+        CHECK(sf::VoiceManager::getMaxVoices() == 8);
+        sf::VoiceManager::setMaxVoices(0);
+    }
+
+    SECTION("Set/get cull distance")
+    {
+        CHECK(sf::VoiceManager::getCullDistance() == std::numeric_limits<float>::max());
+        sf::VoiceManager::setCullDistance(100);
+        CHECK(sf::VoiceManager::getCullDistance() == 100);
+        sf::VoiceManager::setCullDistance(std::numeric_limits<float>::max());
+    }
+
+    const std::vector<std::int16_t> samples(44100, 1000);
+    const sf::SoundBuffer           soundBuffer(samples.data(), samples.size(), 1, 44100, {sf::SoundChannel::Mono});
+
+    SECTION("Voice stealing")
+    {
+        sf::VoiceManager::setMaxVoices(2);
+
+        sf::Sound quiet(soundBuffer);
+        sf::Sound loud(soundBuffer);
+        sf::Sound important(soundBuffer);
+        quiet.setVolume(10);
+        important.setPriority(1);
+        CHECK(important.getPriority() == 1);
+
+        quiet.play();
+        loud.play();
+        CHECK(sf::VoiceManager::getActiveVoiceCount() == 2);
+        CHECK(sf::VoiceManager::getVirtualVoiceCount() == 0);
+
+        // The quietest voice of the lowest priority loses its voice
+        important.play();
+        CHECK(!important.isVirtual());
+        CHECK(!loud.isVirtual());
+        CHECK(quiet.isVirtual());
+        CHECK(quiet.getStatus() == sf::Sound::Status::Playing);
+        CHECK(sf::VoiceManager::getActiveVoiceCount() == 2);
+        CHECK(sf::VoiceManager::getVirtualVoiceCount() == 1);
+
+        // A voice that ranks below all playing voices starts out virtual
+        sf::Sound unimportant(soundBuffer);
+        unimportant.setPriority(-1);
+        unimportant.play();
+        CHECK(unimportant.isVirtual());
+        CHECK(sf::VoiceManager::getVirtualVoiceCount() == 2);
+
+        // Stopping a voice frees its slot for the next update
+        loud.stop();
+        CHECK(!loud.isVirtual());
+        sf::VoiceManager::update();
+        CHECK(!quiet.isVirtual());
+        CHECK(unimportant.isVirtual());
+        CHECK(sf::VoiceManager::getActiveVoiceCount() == 2);
+
+        sf::VoiceManager::setMaxVoices(0);
+        sf::VoiceManager::update();
+        CHECK(!unimportant.isVirtual());
+        CHECK(sf::VoiceManager::getVirtualVoiceCount() == 0);
+    }
+
+    SECTION("Virtual voices keep their playing offset")
+    {
+        sf::VoiceManager::setMaxVoices(1);
+
+        sf::Sound playing(soundBuffer);
+        sf::Sound waiting(soundBuffer);
+        playing.play();
+        waiting.play();
+        REQUIRE(waiting.isVirtual());
+
+        waiting.setPlayingOffset(sf::milliseconds(500));
+        CHECK(waiting.getPlayingOffset() >= sf::milliseconds(500));
+
+        waiting.pause();
+        CHECK(!waiting.isVirtual());
+        CHECK(waiting.getStatus() == sf::Sound::Status::Paused);
+        CHECK(waiting.getPlayingOffset() >= sf::milliseconds(500));
+
+        sf::VoiceManager::setMaxVoices(0);
+    }
+
+    SECTION("Inaudible sounds are mixed by default")
+    {
+        sf::Sound sound(soundBuffer);
+        sound.setVolume(0);
+        sound.play();
+        CHECK(!sound.isVirtual());
+
+        // Fading in works without updating the voice manager
+        sound.setVolume(100);
+        CHECK(!sound.isVirtual());
+        CHECK(sound.getStatus() == sf::Sound::Status::Playing);
+        CHECK(sf::VoiceManager::getActiveVoiceCount() == 1);
+    }
+
+    SECTION("Inaudible sounds are culled once voices are managed")
+    {
+        sf::VoiceManager::setMaxVoices(8);
+
+        sf::Sound sound(soundBuffer);
+        sound.setVolume(0);
+        sound.play();
+        CHECK(sound.isVirtual());
+
+        // Becoming audible again gives the sound its voice back right away
+        sound.setVolume(100);
+        CHECK(!sound.isVirtual());
+        CHECK(sound.getStatus() == sf::Sound::Status::Playing);
+        CHECK(sf::VoiceManager::getActiveVoiceCount() == 1);
+
+        sf::VoiceManager::setMaxVoices(0);
+    }
+
+    SECTION("Distance culling")
+    {
+        sf::VoiceManager::setCullDistance(10);
+
+        sf::Sound nearby(soundBuffer);
+        sf::Sound faraway(soundBuffer);
+        faraway.setPosition({100, 0, 0});
+
+        nearby.play();
+        faraway.play();
+        CHECK(!nearby.isVirtual());
+        CHECK(faraway.isVirtual());
+
+        faraway.setPosition({5, 0, 0});
+        CHECK(!faraway.isVirtual());
+
+        faraway.setPosition({100, 0, 0});
+        sf::VoiceManager::update();
+        CHECK(faraway.isVirtual());
+
+        sf::Listener::setPosition({90, 0, 0});
+        sf::VoiceManager::update();
+        CHECK(!faraway.isVirtual());
+        sf::Listener::setPosition({0, 0, 0});
+
+        sf::VoiceManager::setCullDistance(std::numeric_limits<float>::max());
+    }
+}
@@ -0,0 +1,273 @@
+#include <SFML/Network/CompressedPacket.hpp>
+
+// Other 1st party headers
+#include <SFML/Network/IpAddress.hpp>
+#include <SFML/Network/UdpSocket.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <NetworkUtil.hpp>
+#include <optional>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace
+{
+struct CompressedPacket : sf::CompressedPacket
+{
+    using sf::CompressedPacket::onReceive;
+    using sf::CompressedPacket::onSend;
+};
+
+// Get the bytes the packet would put on the wire
+std::vector<std::byte> transmit(CompressedPacket& sender)
+{
+    std::size_t size = 0;
+    const auto* data = static_cast<const std::byte*>(sender.onSend(size));
+    return {data, data + size};
+}
+
+bool sameData(const sf::Packet& left, const sf::Packet& right)
+{
+    return (left.getDataSize() == right.getDataSize()) &&
+           ((left.getDataSize() == 0) || (std::memcmp(left.getData(), right.getData(), left.getDataSize()) == 0));
+}
+} // namespace
+
+TEST_CASE("[Network] sf::CompressedPacket")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_base_of_v<sf::Packet, sf::CompressedPacket>);
+        STATIC_CHECK(std::is_copy_constructible_v<sf::CompressedPacket>);
+        STATIC_CHECK(std::is_copy_assignable_v<sf::CompressedPacket>);
+    }
+
+    SECTION("Default constructor")
+    {
+        const sf::CompressedPacket packet;
+        CHECK(packet.getDataSize() == 0);
+        CHECK(packet.getCompressionThreshold() == 64);
+        CHECK(!packet.hasBaseline());
+    }
+
+    SECTION("Compressible data")
+    {
+        CompressedPacket sender;
+        for (std::uint32_t i = 0; i < 1000; ++i)
+            sender << i % 10 << "player";
+
+        const auto wire = transmit(sender);
+        CHECK(wire.size() < sender.getDataSize() / 4);
+
+        CompressedPacket receiver;
+        receiver.onReceive(wire.data(), wire.size());
+        CHECK(sameData(sender, receiver));
+
+        std::uint32_t value = 0;
+        std::string   name;
+        receiver >> value >> name;
+        CHECK(value == 0);
+        CHECK(name == "player");
+    }
+
+    SECTION("Long matches and literal runs")
+    {
+        std::vector<std::byte> data(70'000, std::byte{7});
+        std::mt19937           generator(42);
+        for (std::size_t i = 20'000; i < 20'600; ++i)
+            data[i] = static_cast<std::byte>(generator());
+
+        CompressedPacket sender;
+        sender.append(data.data(), data.size());
+
+        const auto wire = transmit(sender);
+        CHECK(wire.size() < data.size() / 10);
+
+        CompressedPacket receiver;
+        receiver.onReceive(wire.data(), wire.size());
+        CHECK(sameData(sender, receiver));
+    }
+
+    SECTION("Small data is sent raw")
+    {
+        CompressedPacket sender;
+        sender << std::uint32_t{42};
+
+        const auto wire = transmit(sender);
+        CHECK(wire.size() == sender.getDataSize() + 1);
+
+        CompressedPacket receiver;
+        receiver.onReceive(wire.data(), wire.size());
+        CHECK(sameData(sender, receiver));
+    }
+
+    SECTION("Incompressible data is sent raw")
+    {
+        std::vector<std::uint8_t> data(4096);
+        std::mt19937              generator(1);
+        for (auto& byte : data)
+            byte = static_cast<std::uint8_t>(generator());
+
+        CompressedPacket sender;
+        sender.append(data.data(), data.size());
+
+        const auto wire = transmit(sender);
+        CHECK(wire.size() == data.size() + 1);
+
+        CompressedPacket receiver;
+        receiver.onReceive(wire.data(), wire.size());
+        CHECK(sameData(sender, receiver));
+    }
+
+    SECTION("Delta against a baseline")
+    {
+        sf::Packet baseline;
+        for (std::uint32_t i = 0; i < 256; ++i)
+            baseline << i << static_cast<float>(i) * 1.5f;
+
+        // Change a few entities and append a new one
+        CompressedPacket sender;
+        for (std::uint32_t i = 0; i < 256; ++i)
+            sender << i << static_cast<float>(i) * ((i % 64 == 0) ? 2.f : 1.5f);
+        sender << std::uint32_t{256} << 0.f;
+
+        sender.setBaseline(baseline);
+        CHECK(sender.hasBaseline());
+
+        CompressedPacket plain;
+        plain.append(sender.getData(), sender.getDataSize());
+
+        const auto delta = transmit(sender);
+        CHECK(delta.size() < transmit(plain).size() * 3 / 10);
+
+        CompressedPacket receiver;
+        receiver.setBaseline(baseline);
+        receiver.onReceive(delta.data(), delta.size());
+        CHECK(sameData(sender, receiver));
+
+        sender.clearBaseline();
+        CHECK(!sender.hasBaseline());
+    }
+
+    SECTION("Delta shorter than the baseline")
+    {
+        sf::Packet baseline;
+        baseline << "a rather long baseline string";
+
+        CompressedPacket sender;
+        sender << "a rather";
+        sender.setBaseline(baseline);
+
+        const auto wire = transmit(sender);
+
+        CompressedPacket receiver;
+        receiver.setBaseline(baseline);
+        receiver.onReceive(wire.data(), wire.size());
+        CHECK(sameData(sender, receiver));
+    }
+
+    SECTION("Delta without baseline")
+    {
+        sf::Packet baseline;
+        baseline << "baseline";
+
+        CompressedPacket sender;
+        sender << "baseline";
+        sender.setBaseline(baseline);
+
+        const auto wire = transmit(sender);
+
+        CompressedPacket receiver;
+        receiver.onReceive(wire.data(), wire.size());
+        CHECK(receiver.getDataSize() == 0);
+        CHECK_FALSE(receiver);
+    }
+
+    SECTION("Maximum decompressed size")
+    {
+        CompressedPacket sender;
+        const std::vector<std::byte> data(100'000);
+        sender.append(data.data(), data.size());
+
+        const auto wire = transmit(sender);
+
+        CompressedPacket receiver;
+        receiver.setMaxDecompressedSize(1000);
+        receiver.onReceive(wire.data(), wire.size());
+        CHECK(receiver.getDataSize() == 0);
+        CHECK_FALSE(receiver);
+    }
+
+    SECTION("Invalid data")
+    {
+        CompressedPacket sender;
+        for (std::uint32_t i = 0; i < 200; ++i)
+            sender << i % 7;
+
+        const auto   wire = transmit(sender);
+        std::mt19937 generator(7);
+
+        // Truncated and corrupted data must be rejected without crashing
+        for (std::size_t size = 0; size < wire.size(); ++size)
+        {
+            CompressedPacket receiver;
+            receiver.onReceive(wire.data(), size);
+            CHECK(receiver.getDataSize() <= sender.getDataSize());
+        }
+
+        for (int i = 0; i < 1000; ++i)
+        {
+            auto corrupted = wire;
+            corrupted[generator() % corrupted.size()] = static_cast<std::byte>(generator());
+
+            CompressedPacket receiver;
+            receiver.setBaseline(sender);
+            receiver.onReceive(corrupted.data(), corrupted.size());
+            CHECK(receiver.getDataSize() <= 16 * 1024 * 1024);
+        }
+
+        // A packet which failed to decode can't be read from until it is cleared
+        CompressedPacket receiver;
+        receiver.onReceive(wire.data(), wire.size() / 2);
+        CHECK(receiver.getDataSize() == 0);
+        CHECK_FALSE(receiver);
+
+        std::uint32_t value = 0;
+        CHECK_FALSE(receiver >> value);
+
+        receiver.clear();
+        CHECK(receiver);
+    }
+}
+
+TEST_CASE("[Network] sf::CompressedPacket Loopback", runLoopbackTests())
+{
+    sf::UdpSocket receiver;
+    REQUIRE(receiver.bind(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+
+    CompressedPacket packet;
+    for (std::uint32_t i = 0; i < 200; ++i)
+        packet << i % 7;
+
+    // Send the compressed bytes cut short, as a plain datagram
+    const auto    wire = transmit(packet);
+    sf::UdpSocket sender;
+    REQUIRE(sender.send(wire.data(), wire.size() / 2, sf::IpAddress::LocalHost, receiver.getLocalPort()) ==
+            sf::Socket::Status::Done);
+
+    sf::CompressedPacket         received;
+    std::optional<sf::IpAddress> remoteAddress;
+    unsigned short               remotePort = 0;
+    REQUIRE(receiver.receive(received, remoteAddress, remotePort) == sf::Socket::Status::Done);
+    CHECK_FALSE(received);
+
+    std::uint32_t value = 0;
+    CHECK_FALSE(received >> value);
+}
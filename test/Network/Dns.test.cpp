@@ -0,0 +1,144 @@
+#include <SFML/Network/Dns.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <SystemUtil.hpp>
+#include <chrono>
+#include <future>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+TEST_CASE("[Network] sf::Dns")
+{
+    // The cache and the host entries are shared by the whole program: start and end each section from a clean state
+    sf::Dns::clearCache();
+    sf::Dns::clearHostEntries();
+    sf::Dns::setCacheTimeToLive(sf::seconds(60));
+
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_aggregate_v<sf::Dns::CacheEntry>);
+        STATIC_CHECK(std::is_copy_constructible_v<sf::Dns::CacheEntry>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::Dns::CacheEntry>);
+    }
+
+    SECTION("setCacheTimeToLive()")
+    {
+        CHECK(sf::Dns::getCacheTimeToLive() == sf::seconds(60));
+
+        sf::Dns::setCacheTimeToLive(sf::seconds(5));
+        CHECK(sf::Dns::getCacheTimeToLive() == sf::seconds(5));
+
+        sf::Dns::setCacheTimeToLive(sf::seconds(-1));
+        CHECK(sf::Dns::getCacheTimeToLive() == sf::Time::Zero);
+    }
+
+    SECTION("Host entries")
+    {
+        sf::Dns::addHostEntry("Game.Example.com", sf::IpAddress(203, 0, 113, 7));
+
+        CHECK(sf::IpAddress::resolve("game.example.com") == sf::IpAddress(203, 0, 113, 7));
+        CHECK(sf::IpAddress::resolve("GAME.EXAMPLE.COM.") == sf::IpAddress(203, 0, 113, 7));
+        CHECK(sf::Dns::resolveAsync("game.example.com").get() == sf::IpAddress(203, 0, 113, 7));
+
+        // Host entries override the system resolver, and are not part of the cache
+        sf::Dns::addHostEntry("localhost", sf::IpAddress(203, 0, 113, 8));
+        CHECK(sf::IpAddress::resolve("localhost") == sf::IpAddress(203, 0, 113, 8));
+        CHECK(sf::Dns::getCacheEntries().empty());
+
+        sf::Dns::clearHostEntries();
+        CHECK(sf::IpAddress::resolve("localhost") == sf::IpAddress::LocalHost);
+    }
+
+    SECTION("Cache")
+    {
+        REQUIRE(sf::IpAddress::resolve("LocalHost") == sf::IpAddress::LocalHost);
+
+        const std::vector<sf::Dns::CacheEntry> entries = sf::Dns::getCacheEntries();
+        REQUIRE(entries.size() == 1);
+        CHECK(entries[0].name == "localhost");
+        CHECK(entries[0].address == sf::IpAddress::LocalHost);
+        CHECK(entries[0].timeToLive > sf::Time::Zero);
+        CHECK(entries[0].timeToLive <= sf::seconds(60));
+
+        // Literal addresses never reach the cache
+        CHECK(sf::IpAddress::resolve("203.0.113.2") == sf::IpAddress(203, 0, 113, 2));
+        CHECK(sf::IpAddress::resolve("2001:db8::2").has_value());
+        CHECK(sf::Dns::getCacheEntries().size() == 1);
+
+        SECTION("clearCache()")
+        {
+            sf::Dns::clearCache();
+            CHECK(sf::Dns::getCacheEntries().empty());
+        }
+
+        SECTION("Expiration")
+        {
+            sf::Dns::clearCache();
+            sf::Dns::setCacheTimeToLive(sf::milliseconds(20));
+            CHECK(sf::IpAddress::resolve("localhost") == sf::IpAddress::LocalHost);
+            CHECK(sf::Dns::getCacheEntries().size() == 1);
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            CHECK(sf::Dns::getCacheEntries().empty());
+        }
+
+        SECTION("Disabled")
+        {
+            sf::Dns::setCacheTimeToLive(sf::Time::Zero);
+            CHECK(sf::Dns::getCacheEntries().empty());
+
+            CHECK(sf::IpAddress::resolve("localhost") == sf::IpAddress::LocalHost);
+            CHECK(sf::Dns::getCacheEntries().empty());
+        }
+    }
+
+    SECTION("resolveAsync()")
+    {
+        SECTION("Future")
+        {
+            CHECK(sf::Dns::resolveAsync("localhost").get() == sf::IpAddress::LocalHost);
+            CHECK(sf::Dns::resolveAsync("203.0.113.2").get() == sf::IpAddress(203, 0, 113, 2));
+            CHECK(!sf::Dns::resolveAsync("").get().has_value());
+            CHECK(sf::Dns::getCacheEntries().size() == 1);
+        }
+
+        SECTION("Callback")
+        {
+            // Literal addresses and cached names are answered before the function returns
+            bool called = false;
+            sf::Dns::resolveAsync("203.0.113.2",
+                                  [&called](std::optional<sf::IpAddress> address)
+                                  { called = (address == sf::IpAddress(203, 0, 113, 2)); });
+            CHECK(called);
+
+            std::promise<std::optional<sf::IpAddress>> promise;
+            sf::Dns::resolveAsync("localhost",
+                                  [&promise](std::optional<sf::IpAddress> address) { promise.set_value(address); });
+            CHECK(promise.get_future().get() == sf::IpAddress::LocalHost);
+
+            called = false;
+            sf::Dns::resolveAsync("localhost",
+                                  [&called](std::optional<sf::IpAddress> address)
+                                  { called = (address == sf::IpAddress::LocalHost); });
+            CHECK(called);
+        }
+
+        SECTION("Concurrent requests")
+        {
+            std::vector<std::future<std::optional<sf::IpAddress>>> futures;
+            for (int i = 0; i < 32; ++i)
+                futures.push_back(sf::Dns::resolveAsync((i % 2) ? "localhost" : "LOCALHOST"));
+
+            for (std::future<std::optional<sf::IpAddress>>& future : futures)
+                CHECK(future.get() == sf::IpAddress::LocalHost);
+
+            CHECK(sf::Dns::getCacheEntries().size() == 1);
+        }
+    }
+
+    sf::Dns::clearCache();
+    sf::Dns::clearHostEntries();
+    sf::Dns::setCacheTimeToLive(sf::seconds(60));
+}
@@ -1,8 +1,198 @@
 #include <SFML/Network/Ftp.hpp>
 
+// Other 1st party headers
+#include <SFML/Network/IpAddress.hpp>
+#include <SFML/Network/TcpListener.hpp>
+#include <SFML/Network/TcpSocket.hpp>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 
+#include <NetworkUtil.hpp>
+#include <array>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
 #include <type_traits>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace
+{
+std::string makeFileContents(std::size_t size)
+{
+    std::string contents(size, '\0');
+    for (std::size_t i = 0; i < contents.size(); ++i)
+        contents[i] = static_cast<char>(i * 7 % 251);
+    return contents;
+}
+
+std::string readFile(const std::filesystem::path& path)
+{
+    std::ifstream file(path, std::ios_base::binary);
+    return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+}
+
+void writeFile(const std::filesystem::path& path, const std::string& contents)
+{
+    std::ofstream file(path, std::ios_base::binary | std::ios_base::trunc);
+    file.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+}
+
+////////////////////////////////////////////////////////////
+// Minimal FTP server answering a single client on the loopback interface, in passive mode only,
+// and storing its files in memory
+////////////////////////////////////////////////////////////
+class LoopbackFtpServer
+{
+public:
+    LoopbackFtpServer()
+    {
+        REQUIRE(m_listener.listen(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+        m_thread = std::thread([this] { run(); });
+    }
+
+    ~LoopbackFtpServer()
+    {
+        m_thread.join();
+    }
+
+    LoopbackFtpServer(const LoopbackFtpServer&)            = delete;
+    LoopbackFtpServer& operator=(const LoopbackFtpServer&) = delete;
+
+    [[nodiscard]] unsigned short getPort() const
+    {
+        return m_listener.getLocalPort();
+    }
+
+    void setFile(const std::string& name, std::string contents)
+    {
+        const std::lock_guard lock(m_mutex);
+        m_files[name] = std::move(contents);
+    }
+
+    [[nodiscard]] std::string getFile(const std::string& name)
+    {
+        const std::lock_guard lock(m_mutex);
+        return m_files[name];
+    }
+
+private:
+    void run()
+    {
+        sf::TcpSocket control;
+        if (m_listener.accept(control) != sf::Socket::Status::Done)
+            return;
+
+        sf::TcpListener dataListener;
+        sf::TcpSocket   data;
+        std::string     received;
+
+        reply(control, "220 Ready");
+
+        while (true)
+        {
+            const auto lineEnd = received.find("\r\n");
+            if (lineEnd == std::string::npos)
+            {
+                std::array<char, 1024> buffer{};
+                std::size_t            size = 0;
+                if (control.receive(buffer.data(), buffer.size(), size) != sf::Socket::Status::Done)
+                    return;
+
+                received.append(buffer.data(), size);
+                continue;
+            }
+
+            const std::string line = received.substr(0, lineEnd);
+            received.erase(0, lineEnd + 2);
+
+            const auto        separator = line.find(' ');
+            const std::string command   = line.substr(0, separator);
+            const std::string argument  = (separator == std::string::npos) ? "" : line.substr(separator + 1);
+
+            if (command == "USER")
+            {
+                reply(control, "331 Password required");
+            }
+            else if (command == "PASS" || command == "TYPE")
+            {
+                reply(control, "200 Ok");
+            }
+            else if (command == "PASV")
+            {
+                // The client connects right away, before sending its next command
+                (void)dataListener.listen(sf::Socket::AnyPort, sf::IpAddress::LocalHost);
+                const unsigned short port = dataListener.getLocalPort();
+                reply(control,
+                      "227 Entering Passive Mode (127,0,0,1," + std::to_string(port / 256) + "," +
+                          std::to_string(port % 256) + ")");
+                (void)dataListener.accept(data);
+                dataListener.close();
+            }
+            else if (command == "RETR" || command == "NLST")
+            {
+                const std::string contents = (command == "RETR") ? getFile(argument) : getListing();
+                reply(control, "150 Opening data connection (" + std::to_string(contents.size()) + " bytes)");
+                if (!contents.empty())
+                    (void)data.send(contents.data(), contents.size());
+                data.disconnect();
+                reply(control, "226 Transfer complete");
+            }
+            else if (command == "STOR")
+            {
+                reply(control, "150 Ready to receive");
+
+                std::string            contents;
+                std::array<char, 4096> buffer{};
+                std::size_t            size = 0;
+                while (data.receive(buffer.data(), buffer.size(), size) == sf::Socket::Status::Done)
+                    contents.append(buffer.data(), size);
+
+                data.disconnect();
+                setFile(argument, std::move(contents));
+                reply(control, "226 Transfer complete");
+            }
+            else if (command == "QUIT")
+            {
+                reply(control, "221 Goodbye");
+                return;
+            }
+            else
+            {
+                reply(control, "502 Command not implemented");
+            }
+        }
+    }
+
+    static void reply(sf::TcpSocket& control, const std::string& message)
+    {
+        const std::string line = message + "\r\n";
+        (void)control.send(line.data(), line.size());
+    }
+
+    std::string getListing()
+    {
+        const std::lock_guard lock(m_mutex);
+
+        std::string listing;
+        for (const auto& [name, contents] : m_files)
+            listing += name + "\r\n";
+        return listing;
+    }
+
+    sf::TcpListener                    m_listener;
+    std::thread                        m_thread;
+    std::mutex                         m_mutex;
+    std::map<std::string, std::string> m_files;
+};
+} // namespace
 
 TEST_CASE("[Network] sf::Ftp")
 {
@@ -14,6 +204,18 @@ TEST_CASE("[Network] sf::Ftp")
         static_assert(!std::is_nothrow_move_assignable_v<sf::Ftp>);
     }
 
+    SECTION("Transfer buffer size")
+    {
+        sf::Ftp ftp;
+        CHECK(ftp.getTransferBufferSize() == 256 * 1024);
+
+        ftp.setTransferBufferSize(4096);
+        CHECK(ftp.getTransferBufferSize() == 4096);
+
+        ftp.setTransferBufferSize(0);
+        CHECK(ftp.getTransferBufferSize() == 1);
+    }
+
     SECTION("Response")
     {
         SECTION("Type traits")
@@ -100,3 +302,134 @@ TEST_CASE("[Network] sf::Ftp")
         }
     }
 }
+
+TEST_CASE("[Network] sf::Ftp Loopback", runLoopbackTests())
+{
+    const std::filesystem::path directory = std::filesystem::temp_directory_path() / "sfml-ftp-test";
+    std::filesystem::create_directories(directory);
+
+    LoopbackFtpServer server;
+    sf::Ftp           ftp;
+    REQUIRE(ftp.connect(sf::IpAddress::LocalHost, server.getPort()).isOk());
+    REQUIRE(ftp.login("user", "password").isOk());
+
+    std::vector<sf::Ftp::TransferProgress> reports;
+    ftp.setProgressCallback([&reports](const sf::Ftp::TransferProgress& progress) { reports.push_back(progress); });
+
+    SECTION("download()")
+    {
+        const std::string contents = makeFileContents(1024 * 1024 + 17);
+        server.setFile("file.bin", contents);
+
+        SECTION("Default buffer size")
+        {
+            CHECK(ftp.download("file.bin", directory).isOk());
+        }
+
+        SECTION("Small buffer size")
+        {
+            ftp.setTransferBufferSize(1000);
+            CHECK(ftp.download("file.bin", directory).isOk());
+            CHECK(reports.size() >= contents.size() / 1000);
+        }
+
+        CHECK(readFile(directory / "file.bin") == contents);
+        REQUIRE(!reports.empty());
+        CHECK(reports.back().transferredBytes == contents.size());
+        CHECK(reports.back().totalBytes == contents.size());
+        CHECK(reports.back().bytesPerSecond >= 0.f);
+    }
+
+    SECTION("download() empty file")
+    {
+        server.setFile("empty.bin", "");
+        CHECK(ftp.download("empty.bin", directory).isOk());
+        CHECK(std::filesystem::file_size(directory / "empty.bin") == 0);
+        REQUIRE(reports.size() == 1);
+        CHECK(reports.back().transferredBytes == 0);
+    }
+
+    SECTION("upload()")
+    {
+        const std::string contents = makeFileContents(3 * 1024 * 1024 + 5);
+        writeFile(directory / "upload.bin", contents);
+
+        // The file may be sent by the system without going through the socket, it must be counted all the same
+        sf::Socket::resetGlobalStatistics();
+        sf::Socket::setGlobalStatisticsEnabled(true);
+
+        SECTION("Default buffer size")
+        {
+            CHECK(ftp.upload(directory / "upload.bin", "").isOk());
+        }
+
+        SECTION("Small buffer size")
+        {
+            ftp.setTransferBufferSize(4096);
+            CHECK(ftp.upload(directory / "upload.bin", "").isOk());
+            CHECK(reports.size() >= contents.size() / 4096);
+        }
+
+        sf::Socket::setGlobalStatisticsEnabled(false);
+        CHECK(sf::Socket::getGlobalStatistics().bytesSent >= contents.size());
+
+        CHECK(server.getFile("upload.bin") == contents);
+        REQUIRE(!reports.empty());
+        CHECK(reports.back().transferredBytes == contents.size());
+        CHECK(reports.back().totalBytes == contents.size());
+    }
+
+    SECTION("upload() missing file")
+    {
+        CHECK(ftp.upload(directory / "missing.bin", "").getStatus() == sf::Ftp::Response::Status::InvalidFile);
+        CHECK(reports.empty());
+    }
+
+    SECTION("getDirectoryListing()")
+    {
+        server.setFile("a.txt", "a");
+        server.setFile("b.txt", "b");
+
+        const sf::Ftp::ListingResponse listing = ftp.getDirectoryListing();
+        CHECK(listing.isOk());
+        CHECK(listing.getListing() == std::vector<std::string>{"a.txt", "b.txt"});
+        CHECK(reports.empty());
+    }
+
+    CHECK(ftp.disconnect().isOk());
+    std::filesystem::remove_all(directory);
+}
+
+TEST_CASE("[Network] sf::Ftp Loopback Throughput", runLoopbackTests() + "[.benchmark]")
+{
+    const std::filesystem::path directory = std::filesystem::temp_directory_path() / "sfml-ftp-benchmark";
+    std::filesystem::create_directories(directory);
+
+    const std::string contents = makeFileContents(64 * 1024 * 1024);
+    writeFile(directory / "large.bin", contents);
+
+    LoopbackFtpServer server;
+    server.setFile("large.bin", contents);
+
+    sf::Ftp ftp;
+    REQUIRE(ftp.connect(sf::IpAddress::LocalHost, server.getPort()).isOk());
+    REQUIRE(ftp.login("user", "password").isOk());
+
+    for (const std::size_t bufferSize : {std::size_t{1024}, std::size_t{256 * 1024}})
+    {
+        ftp.setTransferBufferSize(bufferSize);
+
+        BENCHMARK("Download 64 MiB, " + std::to_string(bufferSize) + " byte buffer")
+        {
+            return ftp.download("large.bin", directory).isOk();
+        };
+
+        BENCHMARK("Upload 64 MiB, " + std::to_string(bufferSize) + " byte buffer")
+        {
+            return ftp.upload(directory / "large.bin", "").isOk();
+        };
+    }
+
+    CHECK(ftp.disconnect().isOk());
+    std::filesystem::remove_all(directory);
+}
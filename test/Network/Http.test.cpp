@@ -1,9 +1,196 @@
 #include <SFML/Network/Http.hpp>
 
+// Other 1st party headers
+#include <SFML/Network/SocketSelector.hpp>
+#include <SFML/Network/TcpListener.hpp>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 
 #include <NetworkUtil.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
 #include <type_traits>
+#include <vector>
+
+#include <cstddef>
+
+namespace
+{
+constexpr std::size_t largeBodySize = 4 * 1024 * 1024;
+
+std::string makeLargeBody()
+{
+    std::string body(largeBodySize, '\0');
+    for (std::size_t i = 0; i < body.size(); ++i)
+        body[i] = static_cast<char>('a' + i % 26);
+    return body;
+}
+
+////////////////////////////////////////////////////////////
+// Minimal HTTP/1.1 server answering on the loopback interface, with a thread per connection
+//  - "/chunked" answers with a chunked body and a trailer field
+//  - "/close" answers and closes the connection
+//  - "/slow" answers after 100 milliseconds, counting how many such requests are handled at once
+//  - "/large" and "/large-chunked" answer with a body of `largeBodySize` bytes
+//  - any other URI is echoed as the body, with a Content-Length
+////////////////////////////////////////////////////////////
+class LoopbackHttpServer
+{
+public:
+    explicit LoopbackHttpServer(std::size_t maxRequestsPerConnection = 1000)
+    {
+        REQUIRE(m_listener.listen(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+        m_thread = std::thread([this, maxRequestsPerConnection] { run(maxRequestsPerConnection); });
+    }
+
+    ~LoopbackHttpServer()
+    {
+        m_stop = true;
+        m_thread.join();
+    }
+
+    LoopbackHttpServer(const LoopbackHttpServer&)            = delete;
+    LoopbackHttpServer& operator=(const LoopbackHttpServer&) = delete;
+
+    [[nodiscard]] unsigned short getPort() const
+    {
+        return m_listener.getLocalPort();
+    }
+
+    [[nodiscard]] std::size_t getConnectionCount() const
+    {
+        return m_connectionCount;
+    }
+
+    [[nodiscard]] std::size_t getPeakConcurrentRequests() const
+    {
+        return m_peakRequests;
+    }
+
+private:
+    void run(std::size_t maxRequestsPerConnection)
+    {
+        sf::SocketSelector       selector;
+        std::vector<std::thread> clients;
+        selector.add(m_listener);
+
+        while (!m_stop)
+        {
+            auto client = std::make_unique<sf::TcpSocket>();
+            if (selector.wait(sf::milliseconds(10)) && (m_listener.accept(*client) == sf::Socket::Status::Done))
+            {
+                ++m_connectionCount;
+                clients.emplace_back([this, client = std::move(client), maxRequestsPerConnection]
+                                     { serve(*client, maxRequestsPerConnection); });
+            }
+        }
+
+        for (std::thread& client : clients)
+            client.join();
+    }
+
+    void serve(sf::TcpSocket& client, std::size_t maxRequests)
+    {
+        sf::SocketSelector selector;
+        selector.add(client);
+
+        std::string received;
+        std::size_t served = 0;
+
+        while (!m_stop && (served < maxRequests))
+        {
+            const auto headerEnd = received.find("\r\n\r\n");
+            if (headerEnd == std::string::npos)
+            {
+                std::array<char, 1024> buffer{};
+                std::size_t            size = 0;
+                if (selector.wait(sf::milliseconds(10)) &&
+                    (client.receive(buffer.data(), buffer.size(), size) != sf::Socket::Status::Done))
+                    return;
+
+                received.append(buffer.data(), size);
+                continue;
+            }
+
+            const std::string request = received.substr(0, headerEnd);
+            received.erase(0, headerEnd + 4);
+
+            const auto        uriStart = request.find(' ') + 1;
+            const std::string method   = request.substr(0, uriStart - 1);
+            const std::string uri      = request.substr(uriStart, request.find(' ', uriStart) - uriStart);
+            const std::string response = respond(uri, method == "HEAD");
+
+            if (uri == "/slow")
+            {
+                const std::size_t active = ++m_activeRequests;
+                std::size_t       peak   = m_peakRequests;
+                while ((active > peak) && !m_peakRequests.compare_exchange_weak(peak, active))
+                {
+                    // Retry with the updated peak
+                }
+
+                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                --m_activeRequests;
+            }
+
+            if (client.send(response.data(), response.size()) != sf::Socket::Status::Done)
+                return;
+
+            ++served;
+
+            if (uri == "/close")
+                return;
+        }
+    }
+
+    static std::string respond(const std::string& uri, bool head)
+    {
+        if (uri == "/chunked")
+            return "HTTP/1.1 200 OK\r\nTransfer-Encoding: chunked\r\n\r\n"
+                   "7\r\nHello, \r\nd;extension=1\r\nchunked world\r\n0\r\nChecksum: 42\r\n\r\n";
+
+        if (uri == "/large-chunked")
+        {
+            // Chunks of various sizes, so that they straddle the reads of the client
+            const std::string body     = makeLargeBody();
+            std::string       response = "HTTP/1.1 200 OK\r\nTransfer-Encoding: chunked\r\n\r\n";
+            for (std::size_t i = 0, size = 1; i < body.size(); i += size, size = size * 7 % 100'003 + 1)
+            {
+                size = std::min(size, body.size() - i);
+
+                std::ostringstream chunkSize;
+                chunkSize << std::hex << size;
+                response += chunkSize.str() + "\r\n" + body.substr(i, size) + "\r\n";
+            }
+            return response + "0\r\n\r\n";
+        }
+
+        const std::string body     = (uri == "/large") ? makeLargeBody() : uri;
+        std::string       response = "HTTP/1.1 200 OK\r\nContent-Length: " + std::to_string(body.size()) + "\r\n";
+
+        if (uri == "/close")
+            response += "Connection: close\r\n";
+
+        response += "\r\n";
+        return head ? response : response + body;
+    }
+
+    sf::TcpListener          m_listener;
+    std::thread              m_thread;
+    std::atomic<bool>        m_stop{};
+    std::atomic<std::size_t> m_connectionCount{};
+    std::atomic<std::size_t> m_activeRequests{};
+    std::atomic<std::size_t> m_peakRequests{};
+};
+} // namespace
 
 TEST_CASE("[Network] sf::Http")
 {
@@ -166,3 +353,289 @@ TEST_CASE("[Network] sf::Http Connection", runConnectionTests())
         }
     }
 }
+
+TEST_CASE("[Network] sf::Http Loopback", runLoopbackTests())
+{
+    LoopbackHttpServer server(3);
+    sf::Http           http("http://127.0.0.1", server.getPort());
+
+    SECTION("Keep-alive")
+    {
+        CHECK(!http.isKeepAliveEnabled());
+        http.setKeepAlive(true);
+        CHECK(http.isKeepAliveEnabled());
+
+        // The server closes connections after 3 requests, which are then transparently replaced
+        for (int i = 0; i < 7; ++i)
+        {
+            const std::string        uri      = "/resource" + std::to_string(i);
+            const sf::Http::Response response = http.sendRequest(sf::Http::Request(uri));
+            CHECK(response.getStatus() == sf::Http::Response::Status::Ok);
+            CHECK(response.getBody() == uri);
+        }
+
+        CHECK(server.getConnectionCount() == 3);
+    }
+
+    SECTION("Without keep-alive")
+    {
+        for (int i = 0; i < 3; ++i)
+            CHECK(http.sendRequest(sf::Http::Request("/resource")).getBody() == "/resource");
+
+        CHECK(server.getConnectionCount() == 3);
+    }
+
+    SECTION("Chunked body")
+    {
+        http.setKeepAlive(true);
+
+        const sf::Http::Response response = http.sendRequest(sf::Http::Request("/chunked"));
+        CHECK(response.getStatus() == sf::Http::Response::Status::Ok);
+        CHECK(response.getBody() == "Hello, chunked world");
+        CHECK(response.getField("Checksum") == "42");
+
+        // The connection remains usable after the last chunk
+        CHECK(http.sendRequest(sf::Http::Request("/next")).getBody() == "/next");
+        CHECK(server.getConnectionCount() == 1);
+    }
+
+    SECTION("HEAD request")
+    {
+        http.setKeepAlive(true);
+
+        const sf::Http::Response response = http.sendRequest(
+            sf::Http::Request("/resource", sf::Http::Request::Method::Head));
+        CHECK(response.getStatus() == sf::Http::Response::Status::Ok);
+        CHECK(response.getField("Content-Length") == "9");
+        CHECK(response.getBody().empty());
+
+        CHECK(http.sendRequest(sf::Http::Request("/next")).getBody() == "/next");
+        CHECK(server.getConnectionCount() == 1);
+    }
+
+    SECTION("Connection closed by the server")
+    {
+        http.setKeepAlive(true);
+
+        CHECK(http.sendRequest(sf::Http::Request("/close")).getBody() == "/close");
+        CHECK(http.sendRequest(sf::Http::Request("/next")).getBody() == "/next");
+        CHECK(server.getConnectionCount() == 2);
+    }
+
+    SECTION("Pipelining")
+    {
+        http.setKeepAlive(true);
+
+        std::vector<sf::Http::Request> requests;
+        for (int i = 0; i < 10; ++i)
+            requests.emplace_back("/resource" + std::to_string(i));
+        requests.emplace_back("/chunked");
+
+        const auto responses = http.sendRequests(requests);
+        REQUIRE(responses.size() == requests.size());
+
+        for (int i = 0; i < 10; ++i)
+            CHECK(responses[static_cast<std::size_t>(i)].getBody() == "/resource" + std::to_string(i));
+        CHECK(responses.back().getBody() == "Hello, chunked world");
+
+        // Requests left unanswered when the server closed a connection were sent again
+        CHECK(server.getConnectionCount() == 4);
+    }
+
+    SECTION("Streamed body")
+    {
+        http.setKeepAlive(true);
+
+        std::string body;
+        bool        headerFirst = false;
+
+        const sf::Http::Response response = http.sendRequest(
+            sf::Http::Request("/chunked"),
+            [&](const sf::Http::Response& header)
+            {
+                headerFirst = body.empty() && (header.getStatus() == sf::Http::Response::Status::Ok);
+                return true;
+            },
+            [&](const void* data, std::size_t size)
+            {
+                body.append(static_cast<const char*>(data), size);
+                return true;
+            });
+
+        CHECK(headerFirst);
+        CHECK(body == "Hello, chunked world");
+        CHECK(response.getStatus() == sf::Http::Response::Status::Ok);
+        CHECK(response.getField("Checksum") == "42");
+        CHECK(response.getBody().empty());
+    }
+
+    SECTION("Large streamed body")
+    {
+        http.setKeepAlive(true);
+        const std::string expected = makeLargeBody();
+
+        for (const std::string uri : {"/large", "/large-chunked"})
+        {
+            INFO("URI: " << uri);
+
+            std::size_t received = 0;
+            std::size_t maxPiece = 0;
+            bool        matches  = true;
+
+            const auto onBody = [&](const void* data, std::size_t size)
+            {
+                matches = matches && (expected.compare(received, size, static_cast<const char*>(data), size) == 0);
+                received += size;
+                maxPiece = std::max(maxPiece, size);
+                return true;
+            };
+
+            const sf::Http::Response response = http.sendRequest(sf::Http::Request(uri), nullptr, onBody);
+
+            CHECK(response.getStatus() == sf::Http::Response::Status::Ok);
+            CHECK(received == largeBodySize);
+            CHECK(matches);
+
+            // The body is never held in memory as a whole
+            CHECK(maxPiece < largeBodySize / 16);
+        }
+
+        CHECK(server.getConnectionCount() == 1);
+    }
+
+    SECTION("Body written to a stream")
+    {
+        std::ostringstream       stream;
+        const sf::Http::Response response = http.sendRequest(sf::Http::Request("/resource"), stream);
+        CHECK(response.getStatus() == sf::Http::Response::Status::Ok);
+        CHECK(response.getBody().empty());
+        CHECK(stream.str() == "/resource");
+    }
+
+    SECTION("Stopped transfer")
+    {
+        http.setKeepAlive(true);
+
+        std::size_t received = 0;
+        const auto  onBody   = [&received](const void*, std::size_t size)
+        {
+            received += size;
+            return false;
+        };
+
+        const sf::Http::Response response = http.sendRequest(sf::Http::Request("/large"), nullptr, onBody);
+        CHECK(response.getStatus() == sf::Http::Response::Status::Ok);
+        CHECK(received > 0);
+        CHECK(received < largeBodySize);
+
+        // The interrupted connection can't be reused
+        CHECK(http.sendRequest(sf::Http::Request("/next")).getBody() == "/next");
+        CHECK(server.getConnectionCount() == 2);
+    }
+
+    SECTION("Asynchronous requests")
+    {
+        std::vector<std::future<sf::Http::Response>> responses;
+        for (int i = 0; i < 20; ++i)
+            responses.push_back(http.sendRequestAsync(sf::Http::Request("/resource" + std::to_string(i))));
+
+        for (std::size_t i = 0; i < responses.size(); ++i)
+        {
+            const sf::Http::Response response = responses[i].get();
+            CHECK(response.getStatus() == sf::Http::Response::Status::Ok);
+            CHECK(response.getBody() == "/resource" + std::to_string(i));
+        }
+    }
+
+    SECTION("Asynchronous requests with callbacks")
+    {
+        http.setMaxConnections(4);
+
+        // Callbacks are called from another thread, where assertions can't be used
+        std::atomic<int>   completed{};
+        std::atomic<int>   succeeded{};
+        std::promise<void> allCompleted;
+        for (int i = 0; i < 12; ++i)
+        {
+            http.sendRequestAsync(sf::Http::Request("/slow"),
+                                  [&](sf::Http::Response response)
+                                  {
+                                      if (response.getBody() == "/slow")
+                                          ++succeeded;
+                                      if (++completed == 12)
+                                          allCompleted.set_value();
+                                  });
+        }
+
+        allCompleted.get_future().wait();
+        CHECK(succeeded == 12);
+        CHECK(server.getPeakConcurrentRequests() > 1);
+        CHECK(server.getPeakConcurrentRequests() <= 4);
+    }
+
+    SECTION("Asynchronous keep-alive")
+    {
+        http.setKeepAlive(true);
+
+        CHECK(http.sendRequestAsync(sf::Http::Request("/first")).get().getBody() == "/first");
+        CHECK(http.sendRequest(sf::Http::Request("/second")).getBody() == "/second");
+        CHECK(http.sendRequestAsync(sf::Http::Request("/chunked")).get().getBody() == "Hello, chunked world");
+        CHECK(server.getConnectionCount() == 1);
+    }
+
+    SECTION("Asynchronous timeout")
+    {
+        auto slow = http.sendRequestAsync(sf::Http::Request("/slow"), sf::milliseconds(20));
+        auto fast = http.sendRequestAsync(sf::Http::Request("/fast"), sf::seconds(10));
+
+        CHECK(slow.get().getStatus() == sf::Http::Response::Status::ConnectionFailed);
+        CHECK(fast.get().getBody() == "/fast");
+    }
+
+    SECTION("Pending asynchronous requests")
+    {
+        std::future<sf::Http::Response> response;
+        {
+            const sf::Http pending("http://127.0.0.1", server.getPort());
+            response = pending.sendRequestAsync(sf::Http::Request("/slow"));
+        }
+
+        CHECK(response.get().getStatus() == sf::Http::Response::Status::ConnectionFailed);
+    }
+
+    SECTION("Connection failure")
+    {
+        const sf::Http unreachable("http://127.0.0.1", 1);
+        CHECK(unreachable.sendRequest(sf::Http::Request()).getStatus() == sf::Http::Response::Status::ConnectionFailed);
+        CHECK(unreachable.sendRequests({sf::Http::Request(), sf::Http::Request()}).size() == 2);
+        CHECK(unreachable.sendRequestAsync(sf::Http::Request(), sf::seconds(10)).get().getStatus() ==
+              sf::Http::Response::Status::ConnectionFailed);
+    }
+}
+
+TEST_CASE("[Network] sf::Http Loopback Throughput", runLoopbackTests() + "[.benchmark]")
+{
+    LoopbackHttpServer server;
+
+    BENCHMARK("100 requests, new connection each")
+    {
+        const sf::Http http("http://127.0.0.1", server.getPort());
+        for (int i = 0; i < 100; ++i)
+            (void)http.sendRequest(sf::Http::Request("/resource"));
+    };
+
+    BENCHMARK("100 requests, keep-alive")
+    {
+        sf::Http http("http://127.0.0.1", server.getPort());
+        http.setKeepAlive(true);
+        for (int i = 0; i < 100; ++i)
+            (void)http.sendRequest(sf::Http::Request("/resource"));
+    };
+
+    BENCHMARK("100 requests, pipelined")
+    {
+        sf::Http http("http://127.0.0.1", server.getPort());
+        http.setKeepAlive(true);
+        return http.sendRequests(std::vector<sf::Http::Request>(100, sf::Http::Request("/resource")));
+    };
+}
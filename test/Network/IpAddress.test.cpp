@@ -2,10 +2,13 @@
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <array>
 #include <sstream>
 #include <string_view>
 #include <type_traits>
 
+#include <cstdint>
+
 using namespace std::string_literals;
 using namespace std::string_view_literals;
 
@@ -66,6 +69,42 @@ TEST_CASE("[Network] sf::IpAddress")
             const sf::IpAddress ipAddress(0xCB'00'71'9A);
             CHECK(ipAddress.toString() == "203.0.113.154"s);
             CHECK(ipAddress.toInteger() == 0xCB'00'71'9A);
+            CHECK(ipAddress.getType() == sf::IpAddress::Type::IpV4);
+            const std::array<std::uint8_t, 16> mapped{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xFF, 0xFF, 203, 0, 113, 154};
+            CHECK(ipAddress.toBytes() == mapped);
+        }
+
+        SECTION("IPv6 byte constructor")
+        {
+            const std::array<std::uint8_t, 16> bytes{0x20, 0x01, 0x0D, 0xB8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x01};
+            const sf::IpAddress                ipAddress(bytes);
+            CHECK(ipAddress.getType() == sf::IpAddress::Type::IpV6);
+            CHECK(ipAddress.toString() == "2001:db8::1"s);
+            CHECK(ipAddress.toBytes() == bytes);
+            CHECK(ipAddress.toInteger() == 0);
+        }
+
+        SECTION("IPv6 'resolve'")
+        {
+            const auto ipAddress = sf::IpAddress::resolve("2001:DB8:0:0:0:0:0:2"sv);
+            REQUIRE(ipAddress.has_value());
+            CHECK(ipAddress->getType() == sf::IpAddress::Type::IpV6);
+            CHECK(ipAddress->toString() == "2001:db8::2"s);
+
+            CHECK(sf::IpAddress::resolve("[2001:db8::2]"sv) == ipAddress);
+            CHECK(sf::IpAddress::resolve("::1"sv) == sf::IpAddress::LocalHostV6);
+            CHECK(sf::IpAddress::resolve("::"sv) == sf::IpAddress::AnyV6);
+
+            // IPv4-mapped addresses are kept as IPv6 addresses
+            const auto mapped = sf::IpAddress::resolve("::ffff:203.0.113.2"sv);
+            REQUIRE(mapped.has_value());
+            CHECK(mapped->getType() == sf::IpAddress::Type::IpV6);
+            CHECK(mapped->toBytes() == sf::IpAddress(203, 0, 113, 2).toBytes());
+            CHECK(*mapped != sf::IpAddress(203, 0, 113, 2));
+
+            CHECK(!sf::IpAddress::resolve("2001:db8::g"sv).has_value());
+            CHECK(!sf::IpAddress::resolve("1:2:3:4:5:6:7:8:9"sv).has_value());
+            CHECK(!sf::IpAddress::resolve("[::1"sv).has_value());
         }
     }
 
@@ -104,6 +143,12 @@ TEST_CASE("[Network] sf::IpAddress")
 
         CHECK(sf::IpAddress::Broadcast.toString() == "255.255.255.255"s);
         CHECK(sf::IpAddress::Broadcast.toInteger() == 0xFF'FF'FF'FF);
+
+        CHECK(sf::IpAddress::AnyV6.toString() == "::"s);
+        CHECK(sf::IpAddress::AnyV6.getType() == sf::IpAddress::Type::IpV6);
+
+        CHECK(sf::IpAddress::LocalHostV6.toString() == "::1"s);
+        CHECK(sf::IpAddress::LocalHostV6.getType() == sf::IpAddress::Type::IpV6);
     }
 
     SECTION("Operators")
@@ -128,6 +173,10 @@ TEST_CASE("[Network] sf::IpAddress")
             CHECK(sf::IpAddress(0, 0, 1, 0) < sf::IpAddress(0, 1, 0, 0));
             CHECK(sf::IpAddress(0, 0, 0, 1) < sf::IpAddress(0, 0, 1, 0));
             CHECK(sf::IpAddress(0, 0, 0, 1) < sf::IpAddress(1, 0, 0, 1));
+
+            // IPv4 addresses are ordered before IPv6 addresses
+            CHECK(sf::IpAddress::Broadcast < sf::IpAddress::AnyV6);
+            CHECK(sf::IpAddress::AnyV6 < sf::IpAddress::LocalHostV6);
         }
 
         SECTION("operator>")
@@ -1,16 +1,24 @@
 #include <SFML/Network/Packet.hpp>
 
 // Other 1st party headers
+#include <SFML/Network/PacketBufferPool.hpp>
+
 #include <SFML/System/String.hpp>
 
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 
 #include <array>
 #include <limits>
+#include <numeric>
+#include <string>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
+#include <cmath>
 #include <cstddef>
+#include <cstring>
 #include <cwchar>
 
 #define CHECK_PACKET_STREAM_OPERATORS(expected)              \
@@ -101,6 +109,294 @@ TEST_CASE("[Network] sf::Packet")
         CHECK(bool{packet});
     }
 
+    SECTION("Growing storage")
+    {
+        std::vector<std::uint8_t> bytes(1000);
+        std::iota(bytes.begin(), bytes.end(), std::uint8_t{0});
+
+        // Cross the inline capacity one byte at a time
+        sf::Packet packet;
+        for (std::size_t i = 0; i < bytes.size(); ++i)
+        {
+            packet << bytes[i];
+            REQUIRE(packet.getDataSize() == i + 1);
+            REQUIRE(std::memcmp(packet.getData(), bytes.data(), i + 1) == 0);
+        }
+
+        for (const std::size_t size : {10u, 64u, 65u, 1000u})
+        {
+            sf::Packet original;
+            original.append(bytes.data(), size);
+
+            const sf::Packet copy(original); // NOLINT(performance-unnecessary-copy-initialization)
+            REQUIRE(copy.getDataSize() == size);
+            CHECK(std::memcmp(copy.getData(), bytes.data(), size) == 0);
+
+            sf::Packet assigned;
+            assigned.append(bytes.data(), 100);
+            assigned = original;
+            REQUIRE(assigned.getDataSize() == size);
+            CHECK(std::memcmp(assigned.getData(), bytes.data(), size) == 0);
+
+            const sf::Packet moved(std::move(original));
+            REQUIRE(moved.getDataSize() == size);
+            CHECK(std::memcmp(moved.getData(), bytes.data(), size) == 0);
+        }
+    }
+
+    SECTION("reserve()")
+    {
+        sf::Packet packet;
+        packet.reserve(4096);
+        CHECK(packet.getData() == nullptr);
+        CHECK(packet.getDataSize() == 0);
+
+        packet << std::uint32_t{42};
+        const void* const storage = packet.getData();
+        for (std::uint32_t i = 1; i < 1024; ++i)
+            packet << i;
+        CHECK(packet.getData() == storage);
+        CHECK(packet.getDataSize() == 4096);
+
+        std::uint32_t value = 0;
+        CHECK(packet >> value);
+        CHECK(value == 42);
+    }
+
+    SECTION("Buffer pool")
+    {
+        sf::PacketBufferPool pool;
+
+        {
+            sf::Packet packet(pool);
+            packet << std::uint8_t{1};
+            CHECK(pool.getBufferCount() == 0);
+        }
+        CHECK(pool.getBufferCount() == 0); // Small packets never leave the inline storage
+
+        {
+            sf::Packet packet(pool);
+            packet.append(std::string(200, 'x').data(), 200);
+            CHECK(packet.getDataSize() == 200);
+        }
+        CHECK(pool.getBufferCount() == 1);
+
+        {
+            sf::Packet packet(pool);
+            packet.append(std::string(100, 'y').data(), 100);
+            CHECK(pool.getBufferCount() == 0); // The released buffer was reused
+
+            const sf::Packet copy(packet); // NOLINT(performance-unnecessary-copy-initialization)
+            CHECK(copy.getDataSize() == 100);
+        }
+        CHECK(pool.getBufferCount() == 2);
+
+        {
+            sf::Packet packet(pool);
+            packet.append(std::string(200, 'z').data(), 200);
+            CHECK(pool.getBufferCount() == 1);
+
+            // Outgrowing an external buffer replaces the heap storage, which goes back to the pool
+            std::array<std::byte, 8> buffer{};
+            packet.writeInto(buffer.data(), buffer.size());
+            packet.append(std::string(1000, 'w').data(), 1000);
+            CHECK(packet.getDataSize() == 1000);
+            CHECK(pool.getBufferCount() == 1);
+        }
+        CHECK(pool.getBufferCount() == 2);
+    }
+
+    SECTION("Compact encoding")
+    {
+        sf::Packet packet;
+        packet.setEncoding(sf::Packet::Encoding::Compact);
+        CHECK(packet.getEncoding() == sf::Packet::Encoding::Compact);
+
+        SECTION("Integer sizes")
+        {
+            packet << std::uint64_t{1};
+            CHECK(packet.getDataSize() == 1);
+            packet << std::int32_t{-1};
+            CHECK(packet.getDataSize() == 2);
+            packet << std::uint16_t{300};
+            CHECK(packet.getDataSize() == 4);
+            packet << std::numeric_limits<std::uint64_t>::max();
+            CHECK(packet.getDataSize() == 14);
+            packet << std::numeric_limits<std::int64_t>::min();
+            CHECK(packet.getDataSize() == 24);
+            packet << std::string("hi");
+            CHECK(packet.getDataSize() == 27);
+
+            std::uint64_t a = 0;
+            std::int32_t  b = 0;
+            std::uint16_t c = 0;
+            std::uint64_t d = 0;
+            std::int64_t  e = 0;
+            std::string   f;
+            CHECK(packet >> a >> b >> c >> d >> e >> f);
+            CHECK(a == 1);
+            CHECK(b == -1);
+            CHECK(c == 300);
+            CHECK(d == std::numeric_limits<std::uint64_t>::max());
+            CHECK(e == std::numeric_limits<std::int64_t>::min());
+            CHECK(f == "hi");
+            CHECK(packet.endOfPacket());
+        }
+
+        SECTION("Round trip")
+        {
+            packet << std::int16_t{-12345} << std::uint32_t{4'000'000'000} << std::int8_t{-8} << 1.25f << 2.5
+                   << std::wstring(L"wide") << sf::String("sf") << std::int64_t{-1'000'000'000'000};
+
+            std::int16_t  a = 0;
+            std::uint32_t b = 0;
+            std::int8_t   c = 0;
+            float         d = 0;
+            double        e = 0;
+            std::wstring  f;
+            sf::String    g;
+            std::int64_t  h = 0;
+            CHECK(packet >> a >> b >> c >> d >> e >> f >> g >> h);
+            CHECK(a == -12345);
+            CHECK(b == 4'000'000'000);
+            CHECK(c == -8);
+            CHECK(d == 1.25f);
+            CHECK(e == 2.5);
+            CHECK(f == L"wide");
+            CHECK(g == "sf");
+            CHECK(h == -1'000'000'000'000);
+            CHECK(packet.endOfPacket());
+        }
+
+        SECTION("Booleans")
+        {
+            for (int i = 0; i < 10; ++i)
+                packet << (i % 3 == 0);
+            CHECK(packet.getDataSize() == 2);
+
+            for (int i = 0; i < 10; ++i)
+            {
+                bool value = false;
+                CHECK(packet >> value);
+                CHECK(value == (i % 3 == 0));
+            }
+            CHECK(packet.endOfPacket());
+        }
+
+        SECTION("Malformed varints")
+        {
+            static constexpr std::array<std::uint8_t, 3> tooLarge = {0xFF, 0xFF, 0x7F};
+            packet.append(tooLarge.data(), tooLarge.size());
+            std::uint16_t small = 0;
+            CHECK_FALSE(packet >> small);
+            CHECK(small == 0);
+
+            packet.clear();
+            CHECK(packet.getEncoding() == sf::Packet::Encoding::Compact);
+            static constexpr std::array<std::uint8_t, 2> truncated = {0x80, 0x80};
+            packet.append(truncated.data(), truncated.size());
+            std::uint32_t value = 0;
+            CHECK_FALSE(packet >> value);
+
+            packet.clear();
+            std::array<std::uint8_t, 11> overlong{};
+            overlong.fill(0x80);
+            overlong.back() = 0x01;
+            packet.append(overlong.data(), overlong.size());
+            std::uint64_t large = 0;
+            CHECK_FALSE(packet >> large);
+        }
+    }
+
+    SECTION("Bits")
+    {
+        sf::Packet packet;
+        packet.writeBits(5, 3) << std::uint32_t{42};
+        packet.writeBits(0x1FF, 9).writeQuantized(0.3f, -1.f, 1.f, 12).writeBits(0xDEADBEEF, 32);
+        CHECK(packet.getDataSize() == 4 + 7); // 56 bits and a std::uint32_t
+
+        std::uint32_t a = 0;
+        std::uint32_t b = 0;
+        std::uint32_t c = 0;
+        float         d = 0;
+        std::uint32_t e = 0;
+        CHECK(packet.readBits(a, 3) >> b);
+        CHECK(packet.readBits(c, 9).readQuantized(d, -1.f, 1.f, 12).readBits(e, 32));
+        CHECK(a == 5);
+        CHECK(b == 42);
+        CHECK(c == 0x1FF);
+        CHECK(std::abs(d - 0.3f) <= 2.f / 4095);
+        CHECK(e == 0xDEADBEEF);
+        CHECK(packet.endOfPacket());
+
+        CHECK_FALSE(packet.readBits(a, 1));
+    }
+
+    SECTION("Quantized range")
+    {
+        sf::Packet packet;
+        packet.writeQuantized(-5.f, 0.f, 10.f, 4).writeQuantized(10.f, 0.f, 10.f, 4).writeQuantized(20.f, 0.f, 10.f, 4);
+
+        std::array<float, 3> values{};
+        CHECK(packet.readQuantized(values[0], 0.f, 10.f, 4)
+                  .readQuantized(values[1], 0.f, 10.f, 4)
+                  .readQuantized(values[2], 0.f, 10.f, 4));
+        CHECK(values == std::array{0.f, 10.f, 10.f});
+    }
+
+    SECTION("readFrom()")
+    {
+        static constexpr std::array<std::uint8_t, 5> bytes = {0, 0, 0, 7, 9};
+
+        sf::Packet packet;
+        packet << std::uint8_t{1};
+        packet.readFrom(bytes.data(), bytes.size());
+        CHECK(packet.getData() == bytes.data());
+        CHECK(packet.getDataSize() == bytes.size());
+
+        std::uint32_t value = 0;
+        CHECK(packet >> value);
+        CHECK(value == 7);
+
+        // Appending copies the viewed data instead of writing to it
+        packet << std::uint8_t{10};
+        CHECK(packet.getData() != bytes.data());
+        CHECK(packet.getDataSize() == 6);
+        CHECK(bytes.back() == 9);
+
+        std::uint8_t last = 0;
+        CHECK(packet >> last >> last);
+        CHECK(last == 10);
+    }
+
+    SECTION("writeInto()")
+    {
+        std::array<std::byte, 8> buffer{};
+
+        sf::Packet packet;
+        packet.writeInto(buffer.data(), buffer.size());
+        packet << std::uint32_t{1} << std::uint16_t{2};
+        CHECK(packet.getData() == buffer.data());
+        CHECK(packet.getDataSize() == 6);
+        CHECK(buffer[3] == std::byte{1});
+
+        packet << std::uint32_t{3};
+        CHECK(packet.getData() != buffer.data());
+        CHECK(packet.getDataSize() == 10);
+
+        std::uint32_t a = 0;
+        std::uint16_t b = 0;
+        std::uint32_t c = 0;
+        CHECK(packet >> a >> b >> c);
+        CHECK(a == 1);
+        CHECK(b == 2);
+        CHECK(c == 3);
+
+        packet.clear();
+        packet << std::uint8_t{4};
+        CHECK(packet.getData() != buffer.data());
+    }
+
     SECTION("Network ordering")
     {
         sf::Packet packet;
@@ -305,3 +601,61 @@ TEST_CASE("[Network] sf::Packet")
         CHECK(out.empty());
     }
 }
+
+TEST_CASE("[Network] sf::Packet Serialization", "[.benchmark]")
+{
+    // Typical small game message
+    const auto serialize = [](sf::Packet& packet, std::uint32_t id)
+    { packet << id << 1.5f << 2.5f << std::int16_t{-3} << std::string("player"); };
+
+    const auto deserialize = [](sf::Packet& packet)
+    {
+        std::uint32_t id = 0;
+        float         x  = 0;
+        float         y  = 0;
+        std::int16_t  z  = 0;
+        std::string   name;
+        packet >> id >> x >> y >> z >> name;
+        return id;
+    };
+
+    BENCHMARK("1000 messages, one packet each")
+    {
+        std::uint32_t sum = 0;
+        for (std::uint32_t i = 0; i < 1000; ++i)
+        {
+            sf::Packet packet;
+            serialize(packet, i);
+            sum += deserialize(packet);
+        }
+        return sum;
+    };
+
+    BENCHMARK("1000 messages, single reserved packet")
+    {
+        sf::Packet packet;
+        packet.reserve(1000 * 28);
+        for (std::uint32_t i = 0; i < 1000; ++i)
+            serialize(packet, i);
+
+        std::uint32_t sum = 0;
+        for (std::uint32_t i = 0; i < 1000; ++i)
+            sum += deserialize(packet);
+        return sum;
+    };
+
+    sf::PacketBufferPool pool;
+
+    BENCHMARK("100 large messages, pooled packets")
+    {
+        std::uint32_t sum = 0;
+        for (std::uint32_t i = 0; i < 100; ++i)
+        {
+            sf::Packet packet(pool);
+            for (std::uint32_t j = 0; j < 20; ++j)
+                serialize(packet, i);
+            sum += deserialize(packet);
+        }
+        return sum;
+    };
+}
@@ -0,0 +1,86 @@
+#include <SFML/Network/PacketBufferPool.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <cstddef>
+
+TEST_CASE("[Network] sf::PacketBufferPool")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::PacketBufferPool>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::PacketBufferPool>);
+        STATIC_CHECK(!std::is_nothrow_move_constructible_v<sf::PacketBufferPool>);
+        STATIC_CHECK(!std::is_nothrow_move_assignable_v<sf::PacketBufferPool>);
+    }
+
+    SECTION("Construction")
+    {
+        const sf::PacketBufferPool pool;
+        CHECK(pool.getBufferCount() == 0);
+    }
+
+    SECTION("acquire()/release()")
+    {
+        sf::PacketBufferPool pool;
+
+        auto buffer = pool.acquire(1024);
+        CHECK(buffer.empty());
+        CHECK(buffer.capacity() >= 1024);
+
+        buffer.resize(10);
+        const auto* const storage = buffer.data();
+        pool.release(std::move(buffer));
+        CHECK(pool.getBufferCount() == 1);
+
+        const auto reused = pool.acquire(512);
+        CHECK(reused.empty());
+        CHECK(reused.data() == storage);
+        CHECK(pool.getBufferCount() == 0);
+
+        // Buffers without memory aren't worth keeping
+        pool.release({});
+        CHECK(pool.getBufferCount() == 0);
+    }
+
+    SECTION("Maximum buffer count")
+    {
+        sf::PacketBufferPool pool(2);
+        for (int i = 0; i < 5; ++i)
+            pool.release(pool.acquire(16));
+        CHECK(pool.getBufferCount() == 1);
+
+        std::vector<std::vector<std::byte>> buffers;
+        for (int i = 0; i < 5; ++i)
+            buffers.push_back(pool.acquire(16));
+        for (auto& buffer : buffers)
+            pool.release(std::move(buffer));
+        CHECK(pool.getBufferCount() == 2);
+    }
+
+    SECTION("Concurrent use")
+    {
+        sf::PacketBufferPool pool;
+
+        std::vector<std::thread> threads;
+        for (int i = 0; i < 4; ++i)
+        {
+            threads.emplace_back(
+                [&pool]
+                {
+                    for (int j = 0; j < 1000; ++j)
+                        pool.release(pool.acquire(64));
+                });
+        }
+
+        for (auto& thread : threads)
+            thread.join();
+
+        CHECK(pool.getBufferCount() >= 1);
+        CHECK(pool.getBufferCount() <= 4);
+    }
+}
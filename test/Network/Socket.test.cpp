@@ -4,6 +4,10 @@
 
 #include <type_traits>
 
+#if !defined(SFML_SYSTEM_WINDOWS)
+#include <sys/socket.h>
+#endif
+
 class TestSocket : public sf::Socket
 {
 public:
@@ -13,7 +17,11 @@ public:
 
     using sf::Socket::close;
     using sf::Socket::create;
+    using sf::Socket::getBusyPoll;
     using sf::Socket::getNativeHandle;
+    using sf::Socket::isReusePort;
+    using sf::Socket::setBusyPoll;
+    using sf::Socket::setReusePort;
 };
 
 TEST_CASE("[Network] sf::Socket")
@@ -25,11 +33,17 @@ TEST_CASE("[Network] sf::Socket")
         STATIC_CHECK(!std::is_copy_assignable_v<sf::Socket>);
         STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::Socket>);
         STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::Socket>);
+        STATIC_CHECK(std::is_aggregate_v<sf::Socket::Statistics>);
     }
 
     SECTION("Constants")
     {
         STATIC_CHECK(sf::Socket::AnyPort == 0);
+
+        constexpr sf::Socket::KeepAlive keepAlive;
+        STATIC_CHECK(keepAlive.idle == sf::seconds(10));
+        STATIC_CHECK(keepAlive.interval == sf::seconds(1));
+        STATIC_CHECK(keepAlive.probeCount == 5);
     }
 
     const auto invalidHandle = static_cast<sf::SocketHandle>(-1);
@@ -39,6 +53,31 @@ TEST_CASE("[Network] sf::Socket")
         const TestSocket testSocket;
         CHECK(testSocket.isBlocking());
         CHECK(testSocket.getNativeHandle() == invalidHandle);
+        CHECK(testSocket.getSendBufferSize() == 0);
+        CHECK(testSocket.getReceiveBufferSize() == 0);
+        CHECK(!testSocket.isReusePort());
+        CHECK(testSocket.getBusyPoll() == sf::Time::Zero);
+
+        const sf::Socket::Statistics statistics = testSocket.getStatistics();
+        CHECK(statistics.bytesSent == 0);
+        CHECK(statistics.bytesReceived == 0);
+        CHECK(statistics.sendCalls == 0);
+        CHECK(statistics.receiveCalls == 0);
+        CHECK(statistics.tlsHandshakeTime == sf::Time::Zero);
+    }
+
+    SECTION("Global statistics")
+    {
+        CHECK(!sf::Socket::isGlobalStatisticsEnabled());
+
+        sf::Socket::setGlobalStatisticsEnabled(true);
+        CHECK(sf::Socket::isGlobalStatisticsEnabled());
+
+        sf::Socket::resetGlobalStatistics();
+        CHECK(sf::Socket::getGlobalStatistics().bytesSent == 0);
+
+        sf::Socket::setGlobalStatisticsEnabled(false);
+        CHECK(!sf::Socket::isGlobalStatisticsEnabled());
     }
 
     SECTION("Move semantics")
@@ -47,9 +86,11 @@ TEST_CASE("[Network] sf::Socket")
         {
             TestSocket movedTestSocket;
             movedTestSocket.setBlocking(false);
+            movedTestSocket.setReceiveBufferSize(1024);
             movedTestSocket.create();
             const TestSocket testSocket(std::move(movedTestSocket));
             CHECK(!testSocket.isBlocking());
+            CHECK(testSocket.getReceiveBufferSize() == 1024);
             CHECK(testSocket.getNativeHandle() != invalidHandle);
         }
 
@@ -57,10 +98,12 @@ TEST_CASE("[Network] sf::Socket")
         {
             TestSocket movedTestSocket;
             movedTestSocket.setBlocking(false);
+            movedTestSocket.setReceiveBufferSize(1024);
             movedTestSocket.create();
             TestSocket testSocket;
             testSocket = std::move(movedTestSocket);
             CHECK(!testSocket.isBlocking());
+            CHECK(testSocket.getReceiveBufferSize() == 1024);
             CHECK(testSocket.getNativeHandle() != invalidHandle);
         }
     }
@@ -72,6 +115,38 @@ TEST_CASE("[Network] sf::Socket")
         CHECK(!testSocket.isBlocking());
     }
 
+    SECTION("Set/get options")
+    {
+        TestSocket testSocket;
+        testSocket.setSendBufferSize(128 * 1024);
+        testSocket.setReceiveBufferSize(256 * 1024);
+        testSocket.setReusePort(true);
+        testSocket.setBusyPoll(sf::seconds(-1));
+        CHECK(testSocket.getSendBufferSize() == 128 * 1024);
+        CHECK(testSocket.getReceiveBufferSize() == 256 * 1024);
+        CHECK(testSocket.isReusePort());
+        CHECK(testSocket.getBusyPoll() == sf::Time::Zero);
+
+#if !defined(SFML_SYSTEM_WINDOWS)
+        // Options set before the socket exists are applied when it is created
+        testSocket.create();
+        const auto getOption = [&testSocket](int name)
+        {
+            int       value  = 0;
+            socklen_t length = sizeof(value);
+            REQUIRE(getsockopt(testSocket.getNativeHandle(), SOL_SOCKET, name, &value, &length) == 0);
+            return value;
+        };
+        CHECK(getOption(SO_SNDBUF) >= 128 * 1024);
+        CHECK(getOption(SO_RCVBUF) >= 256 * 1024);
+        CHECK(getOption(SO_REUSEPORT) != 0);
+
+        // Options set afterwards are applied right away
+        testSocket.setReusePort(false);
+        CHECK(getOption(SO_REUSEPORT) == 0);
+#endif
+    }
+
     SECTION("create()")
     {
         TestSocket testSocket;
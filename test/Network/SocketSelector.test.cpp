@@ -1,11 +1,37 @@
 #include <SFML/Network/SocketSelector.hpp>
 
 // Other 1st party headers
+#include <SFML/Network/IpAddress.hpp>
 #include <SFML/Network/UdpSocket.hpp>
 
+#include <SFML/System/Time.hpp>
+
 #include <catch2/catch_test_macros.hpp>
 
+#include <NetworkUtil.hpp>
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <optional>
 #include <type_traits>
+#include <vector>
+
+#include <cstddef>
+
+#if !defined(SFML_SYSTEM_WINDOWS)
+#include <sys/resource.h>
+#include <sys/select.h>
+#endif
+
+namespace
+{
+// Socket holding data the operating system doesn't know about, like a TLS socket with part of a record decrypted
+class BufferedSocket : public sf::UdpSocket
+{
+public:
+    using sf::UdpSocket::setBufferedData;
+};
+} // namespace
 
 TEST_CASE("[Network] sf::SocketSelector")
 {
@@ -23,5 +49,204 @@ TEST_CASE("[Network] sf::SocketSelector")
     {
         const sf::SocketSelector socketSelector;
         CHECK(!socketSelector.isReady(socket));
+        CHECK(socketSelector.getReadySockets().empty());
+        CHECK(!socketSelector.isEdgeTriggered());
+    }
+
+    SECTION("Set/get edge-triggered")
+    {
+        sf::SocketSelector socketSelector;
+        socketSelector.setEdgeTriggered(true);
+        CHECK(socketSelector.isEdgeTriggered());
+    }
+}
+
+TEST_CASE("[Network] sf::SocketSelector Loopback", runLoopbackTests())
+{
+    // Bind a few sockets, so that the ready one isn't the only one in the selector
+    std::array<sf::UdpSocket, 4> sockets;
+    for (auto& socket : sockets)
+        REQUIRE(socket.bind(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+
+    sf::SocketSelector socketSelector;
+    for (auto& socket : sockets)
+        socketSelector.add(socket);
+
+    auto&                      target = sockets[2];
+    const std::array<char, 16> data{};
+
+    const auto sendToTarget = [&]
+    {
+        sf::UdpSocket sender;
+        REQUIRE(sender.send(data.data(), data.size(), sf::IpAddress::LocalHost, target.getLocalPort()) ==
+                sf::Socket::Status::Done);
+    };
+
+    const auto receiveFromTarget = [&]
+    {
+        std::array<char, 16>         buffer{};
+        std::size_t                  received = 0;
+        std::optional<sf::IpAddress> sender;
+        unsigned short               port = 0;
+        CHECK(target.receive(buffer.data(), buffer.size(), received, sender, port) == sf::Socket::Status::Done);
+    };
+
+    SECTION("wait()")
+    {
+        CHECK(!socketSelector.wait(sf::milliseconds(10)));
+        CHECK(socketSelector.getReadySockets().empty());
+
+        sendToTarget();
+        REQUIRE(socketSelector.wait(sf::seconds(1)));
+        CHECK(socketSelector.isReady(target));
+        CHECK(!socketSelector.isReady(sockets[0]));
+        CHECK(socketSelector.getReadySockets() == std::vector<sf::Socket*>{&target});
+
+        // Level-triggered: the socket stays ready until the data is received
+        CHECK(socketSelector.wait(sf::milliseconds(10)));
+        CHECK(socketSelector.isReady(target));
+
+        receiveFromTarget();
+        CHECK(!socketSelector.wait(sf::milliseconds(10)));
+        CHECK(!socketSelector.isReady(target));
     }
+
+    SECTION("remove()")
+    {
+        sendToTarget();
+        REQUIRE(socketSelector.wait(sf::seconds(1)));
+        socketSelector.remove(target);
+        CHECK(!socketSelector.isReady(target));
+        CHECK(socketSelector.getReadySockets().empty());
+        CHECK(!socketSelector.wait(sf::milliseconds(10)));
+    }
+
+    SECTION("Copy")
+    {
+        sendToTarget();
+        REQUIRE(socketSelector.wait(sf::seconds(1)));
+
+        sf::SocketSelector copy(socketSelector);
+        CHECK(copy.isReady(target));
+        CHECK(copy.getReadySockets() == std::vector<sf::Socket*>{&target});
+
+        socketSelector.clear();
+        CHECK(copy.wait(sf::seconds(1)));
+        CHECK(copy.isReady(target));
+        CHECK(!socketSelector.wait(sf::milliseconds(10)));
+    }
+
+    SECTION("Buffered data")
+    {
+        BufferedSocket socket;
+        REQUIRE(socket.bind(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+        socketSelector.add(socket);
+
+        // Ready although nothing arrived, along with the sockets the operating system reports
+        socket.setBufferedData(true);
+        sendToTarget();
+        REQUIRE(socketSelector.wait(sf::seconds(10)));
+        CHECK(socketSelector.isReady(socket));
+        CHECK(socketSelector.isReady(target));
+
+        receiveFromTarget();
+        CHECK(socketSelector.wait(sf::seconds(10)));
+        CHECK(socketSelector.getReadySockets() == std::vector<sf::Socket*>{&socket});
+
+        // Selectors which don't watch the socket aren't affected
+        sf::SocketSelector otherSelector;
+        otherSelector.add(target);
+        CHECK(!otherSelector.wait(sf::milliseconds(10)));
+
+        socket.setBufferedData(false);
+        CHECK(!socketSelector.wait(sf::milliseconds(10)));
+
+        // Closing the socket forgets its buffered data, even if its handle is reused
+        socket.setBufferedData(true);
+        socket.unbind();
+
+        sf::UdpSocket reused;
+        REQUIRE(reused.bind(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+        socketSelector.add(reused);
+        CHECK(!socketSelector.wait(sf::milliseconds(10)));
+        socketSelector.remove(reused);
+    }
+
+    SECTION("Closed without being removed")
+    {
+        // The handle of the closed socket is usually reused by the next one
+        target.unbind();
+
+        sf::UdpSocket socket;
+        REQUIRE(socket.bind(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+        socketSelector.add(socket);
+
+        sf::UdpSocket sender;
+        REQUIRE(sender.send(data.data(), data.size(), sf::IpAddress::LocalHost, socket.getLocalPort()) ==
+                sf::Socket::Status::Done);
+        REQUIRE(socketSelector.wait(sf::seconds(1)));
+        CHECK(socketSelector.isReady(socket));
+        CHECK(socketSelector.getReadySockets() == std::vector<sf::Socket*>{&socket});
+    }
+
+#if defined(SFML_SYSTEM_LINUX)
+    SECTION("Edge-triggered")
+    {
+        socketSelector.setEdgeTriggered(true);
+
+        sendToTarget();
+        REQUIRE(socketSelector.wait(sf::seconds(1)));
+        CHECK(socketSelector.isReady(target));
+
+        // No new data arrived, the socket isn't reported again
+        CHECK(!socketSelector.wait(sf::milliseconds(10)));
+
+        sendToTarget();
+        CHECK(socketSelector.wait(sf::seconds(1)));
+        CHECK(socketSelector.getReadySockets() == std::vector<sf::Socket*>{&target});
+    }
+#endif
+}
+
+#if !defined(SFML_SYSTEM_WINDOWS)
+TEST_CASE("[Network] sf::SocketSelector More than FD_SETSIZE sockets", runLoopbackTests())
+{
+    // select() can't watch handles greater than or equal to FD_SETSIZE, the selector must
+    constexpr std::size_t count = FD_SETSIZE + 64;
+
+    rlimit limit{};
+    REQUIRE(getrlimit(RLIMIT_NOFILE, &limit) == 0);
+    if (limit.rlim_cur < count + 64)
+    {
+        limit.rlim_cur = std::min<rlim_t>(count + 64, limit.rlim_max);
+        REQUIRE(setrlimit(RLIMIT_NOFILE, &limit) == 0);
+    }
+
+    if (limit.rlim_cur < count + 64)
+    {
+        WARN("The process can't open enough sockets");
+        return;
+    }
+
+    std::vector<std::unique_ptr<sf::UdpSocket>> sockets;
+    sf::SocketSelector                          socketSelector;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        auto& socket = *sockets.emplace_back(std::make_unique<sf::UdpSocket>());
+        REQUIRE(socket.bind(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+        socketSelector.add(socket);
+    }
+
+    // Handles are allocated in increasing order, the last socket's is beyond FD_SETSIZE
+    sf::UdpSocket& target = *sockets.back();
+    CHECK(!socketSelector.wait(sf::milliseconds(10)));
+
+    const std::array<char, 16> data{};
+    sf::UdpSocket              sender;
+    REQUIRE(sender.send(data.data(), data.size(), sf::IpAddress::LocalHost, target.getLocalPort()) ==
+            sf::Socket::Status::Done);
+
+    REQUIRE(socketSelector.wait(sf::seconds(1)));
+    CHECK(socketSelector.getReadySockets() == std::vector<sf::Socket*>{&target});
 }
+#endif
@@ -1,11 +1,21 @@
 #include <SFML/Network/TcpListener.hpp>
 
 // Other 1st party headers
+#include <SFML/Network/SocketSelector.hpp>
 #include <SFML/Network/TcpSocket.hpp>
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <NetworkUtil.hpp>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
 #include <type_traits>
+#include <vector>
+
+#include <cstddef>
 
 TEST_CASE("[Network] sf::TcpListener")
 {
@@ -17,6 +27,11 @@ TEST_CASE("[Network] sf::TcpListener")
         STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::TcpListener>);
     }
 
+    SECTION("Constants")
+    {
+        STATIC_CHECK(sf::TcpListener::MaxBacklog == 0x7FFFFFFF);
+    }
+
     SECTION("Construction")
     {
         const sf::TcpListener tcpListener;
@@ -38,7 +53,53 @@ TEST_CASE("[Network] sf::TcpListener")
             CHECK(tcpListener.listen(0, sf::IpAddress::Broadcast) == sf::Socket::Status::Error);
             CHECK(tcpListener.getLocalPort() == 0);
         }
+
+        SECTION("Backlog")
+        {
+            CHECK(tcpListener.listen(0, sf::IpAddress::LocalHost, 1) == sf::Socket::Status::Done);
+            CHECK(tcpListener.getLocalPort() != 0);
+        }
+    }
+
+    SECTION("createShards()")
+    {
+        CHECK(sf::TcpListener::createShards(0, 0).empty());
+
+        const std::vector<sf::TcpListener> shards = sf::TcpListener::createShards(4, 0, sf::IpAddress::LocalHost);
+#if defined(SFML_SYSTEM_WINDOWS)
+        REQUIRE(shards.size() == 1);
+#else
+        REQUIRE(shards.size() == 4);
+#endif
+        for (const sf::TcpListener& shard : shards)
+        {
+            CHECK(shard.getLocalPort() == shards.front().getLocalPort());
+            CHECK(shard.getLocalPort() != 0);
+        }
+
+        // A port already taken by a listener which doesn't share it can't be sharded
+        sf::TcpListener tcpListener;
+        REQUIRE(tcpListener.listen(0, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+        CHECK(sf::TcpListener::createShards(2, tcpListener.getLocalPort(), sf::IpAddress::LocalHost).empty());
+    }
+
+#if !defined(SFML_SYSTEM_WINDOWS)
+    SECTION("setReusePort()")
+    {
+        sf::TcpListener tcpListener;
+        CHECK_FALSE(tcpListener.isReusePort());
+        tcpListener.setReusePort(true);
+        CHECK(tcpListener.isReusePort());
+        REQUIRE(tcpListener.listen(0, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+
+        // Only listeners which all enabled port reuse can share the port
+        sf::TcpListener other;
+        CHECK(other.listen(tcpListener.getLocalPort(), sf::IpAddress::LocalHost) == sf::Socket::Status::Error);
+
+        other.setReusePort(true);
+        CHECK(other.listen(tcpListener.getLocalPort(), sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
     }
+#endif
 
     SECTION("close()")
     {
@@ -56,3 +117,77 @@ TEST_CASE("[Network] sf::TcpListener")
         CHECK(tcpListener.accept(tcpSocket) == sf::Socket::Status::Error);
     }
 }
+
+TEST_CASE("[Network] sf::TcpListener Shards Loopback", runLoopbackTests())
+{
+    std::vector<sf::TcpListener> shards = sf::TcpListener::createShards(4, 0, sf::IpAddress::LocalHost);
+    REQUIRE(!shards.empty());
+    const unsigned short port = shards.front().getLocalPort();
+
+    // Each shard is served by its own thread, which hands the accepted sockets over to the main thread
+    constexpr std::size_t      clientCount = 32;
+    std::mutex                 mutex;
+    std::vector<sf::TcpSocket> accepted;
+    std::atomic<bool>          running{true};
+    std::vector<std::thread>   threads;
+    for (sf::TcpListener& shard : shards)
+    {
+        threads.emplace_back(
+            [&]
+            {
+                sf::SocketSelector selector;
+                selector.add(shard);
+                while (running)
+                {
+                    if (!selector.wait(sf::milliseconds(10)))
+                        continue;
+
+                    sf::TcpSocket socket;
+                    socket.setBlocking(false);
+                    if (shard.accept(socket) == sf::Socket::Status::Done)
+                    {
+                        const std::lock_guard lock(mutex);
+                        accepted.push_back(std::move(socket));
+                    }
+                }
+            });
+    }
+
+    std::vector<sf::TcpSocket> clients(clientCount);
+    for (sf::TcpSocket& client : clients)
+        REQUIRE(client.connect(sf::IpAddress::LocalHost, port, sf::seconds(10)) == sf::Socket::Status::Done);
+
+    const auto start = std::chrono::steady_clock::now();
+    while (true)
+    {
+        {
+            const std::lock_guard lock(mutex);
+            if (accepted.size() == clientCount)
+                break;
+        }
+
+        REQUIRE(std::chrono::steady_clock::now() - start < std::chrono::seconds(10));
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    running = false;
+    for (std::thread& thread : threads)
+        thread.join();
+
+    // Accepted sockets are created directly in the blocking state they were given
+    std::array<char, 1> data{};
+    std::size_t         received = 0;
+    for (sf::TcpSocket& socket : accepted)
+    {
+        CHECK(!socket.isBlocking());
+        CHECK(socket.receive(data.data(), data.size(), received) == sf::Socket::Status::NotReady);
+        std::size_t sent = 0;
+        CHECK(socket.send("x", 1, sent) == sf::Socket::Status::Done);
+    }
+
+    for (sf::TcpSocket& client : clients)
+    {
+        REQUIRE(client.receive(data.data(), data.size(), received) == sf::Socket::Status::Done);
+        CHECK(data[0] == 'x');
+    }
+}
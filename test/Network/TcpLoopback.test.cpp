@@ -1,3 +1,4 @@
+#include <SFML/Network/Packet.hpp>
 #include <SFML/Network/SocketSelector.hpp>
 #include <SFML/Network/TcpListener.hpp>
 #include <SFML/Network/TcpSocket.hpp>
@@ -7,12 +8,15 @@
 
 #include <NetworkUtil.hpp>
 #include <algorithm>
+#include <array>
 #include <chrono>
 #include <random>
+#include <string>
 #include <string_view>
 #include <vector>
 
 #include <cstddef>
+#include <cstdint>
 
 namespace
 {
@@ -202,6 +206,11 @@ TEST_CASE("[Network] sf::Tcp Loopback", runLoopbackTests())
         CHECK_FALSE(clientSocket.getCurrentCiphersuiteName() == std::nullopt);
         CHECK(serverSocket.getCurrentCiphersuiteName() == clientSocket.getCurrentCiphersuiteName());
 
+        CHECK(serverSocket.getStatistics().tlsHandshakes == 1);
+        CHECK(clientSocket.getStatistics().tlsHandshakes == 1);
+        CHECK(clientSocket.getStatistics().tlsHandshakeTime > sf::Time::Zero);
+        CHECK(clientSocket.getStatistics().bytesSent > 0);
+
         start = std::chrono::steady_clock::now();
 
         while (true)
@@ -238,5 +247,201 @@ TEST_CASE("[Network] sf::Tcp Loopback", runLoopbackTests())
         }
 
         CHECK(std::equal(buffer.begin(), buffer.end(), testData.begin()));
+
+        // 1 MiB of application data takes at least 64 records of 16 KiB
+        CHECK(serverSocket.getStatistics().tlsRecordsSent >= 64);
+        CHECK(clientSocket.getStatistics().tlsRecordsReceived >= 64);
+        CHECK(clientSocket.getStatistics().bytesReceived > testData.size());
     }
+
+    SECTION("TLS with selector and session resumption")
+    {
+        // The second connection resumes the session established by the first one
+        for (int connection = 0; connection < 2; ++connection)
+        {
+            sf::TcpSocket serverSocket;
+            sf::TcpSocket clientSocket;
+            clientSocket.setBlocking(false);
+            REQUIRE(clientSocket.connect(sf::IpAddress(127, 0, 0, 1), localPort, sf::milliseconds(10000)) ==
+                    sf::TcpSocket::Status::NotReady);
+
+            auto start = std::chrono::steady_clock::now();
+
+            while (tcpListener.accept(serverSocket) != sf::TcpListener::Status::Done)
+                REQUIRE(std::chrono::steady_clock::now() - start < std::chrono::milliseconds(10000));
+
+            serverSocket.setBlocking(false);
+
+            // Only call the handshake functions again once the selector says they can make progress
+            sf::SocketSelector selector;
+            selector.add(serverSocket);
+            selector.add(clientSocket);
+
+            while (true)
+            {
+                const auto serverStatus = serverSocket.setupTlsServer(certificate, privateKey);
+                const auto clientStatus = clientSocket.setupTlsClient(commonName, certificate);
+
+                REQUIRE(serverStatus != sf::TcpSocket::TlsStatus::Error);
+                REQUIRE(clientStatus != sf::TcpSocket::TlsStatus::Error);
+
+                if ((serverStatus == sf::TcpSocket::TlsStatus::HandshakeComplete) &&
+                    (clientStatus == sf::TcpSocket::TlsStatus::HandshakeComplete))
+                    break;
+
+                REQUIRE(selector.wait(sf::seconds(10)));
+            }
+
+            CHECK(serverSocket.getStatistics().tlsHandshakes == 1);
+            if (connection == 1)
+                CHECK(serverSocket.getStatistics().tlsResumedHandshakes == 1);
+
+            constexpr std::string_view message = "resumable";
+            REQUIRE(serverSocket.send(message.data(), message.size()) == sf::TcpSocket::Status::Done);
+
+            std::string received;
+            start = std::chrono::steady_clock::now();
+
+            while (received.size() < message.size())
+            {
+                REQUIRE(selector.wait(sf::seconds(10)));
+
+                std::array<char, 64> chunk{};
+                std::size_t          size   = 0;
+                const auto           status = clientSocket.receive(chunk.data(), chunk.size(), size);
+                REQUIRE(((status == sf::TcpSocket::Status::Done) || (status == sf::TcpSocket::Status::Partial) ||
+                         (status == sf::TcpSocket::Status::NotReady)));
+                received.append(chunk.data(), size);
+
+                REQUIRE(std::chrono::steady_clock::now() - start < std::chrono::milliseconds(10000));
+            }
+
+            CHECK(received == message);
+
+            clientSocket.disconnect();
+            serverSocket.disconnect();
+        }
+    }
+}
+
+TEST_CASE("[Network] sf::Tcp IPv6 Loopback", runLoopbackTests())
+{
+    const std::string_view message = "IPv6";
+    std::array<char, 4>    buffer{};
+    std::size_t            received = 0;
+
+    SECTION("IPv6 client")
+    {
+        sf::TcpListener tcpListener;
+        REQUIRE(tcpListener.listen(sf::Socket::AnyPort, sf::IpAddress::LocalHostV6) == sf::Socket::Status::Done);
+        CHECK(tcpListener.getLocalPort() != 0);
+
+        sf::TcpSocket clientSocket;
+        REQUIRE(clientSocket.connect(sf::IpAddress::LocalHostV6, tcpListener.getLocalPort(), sf::seconds(10)) ==
+                sf::Socket::Status::Done);
+        CHECK(clientSocket.getRemoteAddress() == sf::IpAddress::LocalHostV6);
+        CHECK(clientSocket.getRemotePort() == tcpListener.getLocalPort());
+        CHECK(clientSocket.getLocalPort() != 0);
+
+        sf::TcpSocket serverSocket;
+        REQUIRE(tcpListener.accept(serverSocket) == sf::Socket::Status::Done);
+        CHECK(serverSocket.getRemoteAddress() == sf::IpAddress::LocalHostV6);
+        CHECK(serverSocket.getRemotePort() == clientSocket.getLocalPort());
+
+        REQUIRE(serverSocket.send(message.data(), message.size()) == sf::Socket::Status::Done);
+        REQUIRE(clientSocket.receive(buffer.data(), buffer.size(), received) == sf::Socket::Status::Done);
+        CHECK(std::string_view(buffer.data(), received) == message);
+    }
+
+    SECTION("IPv4 client on a dual-stack listener")
+    {
+        sf::TcpListener tcpListener;
+        REQUIRE(tcpListener.listen(sf::Socket::AnyPort, sf::IpAddress::AnyV6) == sf::Socket::Status::Done);
+
+        sf::TcpSocket clientSocket;
+        REQUIRE(clientSocket.connect(sf::IpAddress::LocalHost, tcpListener.getLocalPort(), sf::seconds(10)) ==
+                sf::Socket::Status::Done);
+
+        // IPv4-mapped peers are reported as plain IPv4 addresses
+        sf::TcpSocket serverSocket;
+        REQUIRE(tcpListener.accept(serverSocket) == sf::Socket::Status::Done);
+        CHECK(serverSocket.getRemoteAddress() == sf::IpAddress::LocalHost);
+        CHECK(serverSocket.getRemotePort() == clientSocket.getLocalPort());
+
+        REQUIRE(clientSocket.send(message.data(), message.size()) == sf::Socket::Status::Done);
+        REQUIRE(serverSocket.receive(buffer.data(), buffer.size(), received) == sf::Socket::Status::Done);
+        CHECK(std::string_view(buffer.data(), received) == message);
+    }
+}
+
+TEST_CASE("[Network] sf::Tcp Statistics Loopback", runLoopbackTests())
+{
+    sf::TcpListener tcpListener;
+    REQUIRE(tcpListener.listen(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+
+    sf::TcpSocket clientSocket;
+    REQUIRE(clientSocket.connect(sf::IpAddress::LocalHost, tcpListener.getLocalPort()) == sf::Socket::Status::Done);
+
+    sf::TcpSocket serverSocket;
+    REQUIRE(tcpListener.accept(serverSocket) == sf::Socket::Status::Done);
+
+    sf::Socket::resetGlobalStatistics();
+    sf::Socket::setGlobalStatisticsEnabled(true);
+
+    // Packets are counted with their size prefix
+    sf::Packet packet;
+    packet << std::uint32_t{42} << std::string("statistics");
+    const std::uint64_t packetBytes = sizeof(std::uint32_t) + packet.getDataSize();
+    REQUIRE(clientSocket.send(packet) == sf::Socket::Status::Done);
+    REQUIRE(clientSocket.send(packet) == sf::Socket::Status::Done);
+
+    sf::Packet received;
+    REQUIRE(serverSocket.receive(received) == sf::Socket::Status::Done);
+    REQUIRE(serverSocket.receive(received) == sf::Socket::Status::Done);
+
+    const sf::Socket::Statistics client = clientSocket.getStatistics();
+    CHECK(client.bytesSent == 2 * packetBytes);
+    CHECK(client.messagesSent == 2);
+    CHECK(client.sendCalls == 2);
+    CHECK(client.bytesReceived == 0);
+    CHECK(client.partialSends == 0);
+    CHECK(client.tlsRecordsSent == 0);
+
+    const sf::Socket::Statistics server = serverSocket.getStatistics();
+    CHECK(server.bytesReceived == 2 * packetBytes);
+    CHECK(server.messagesReceived == 2);
+    CHECK(server.receiveCalls >= 2);
+    CHECK(server.notReadyReceives == 0);
+
+    // Polling a non-blocking socket without data is counted as well
+    std::array<char, 16> buffer{};
+    std::size_t          size = 0;
+    serverSocket.setBlocking(false);
+    CHECK(serverSocket.receive(buffer.data(), buffer.size(), size) == sf::Socket::Status::NotReady);
+    CHECK(serverSocket.getStatistics().notReadyReceives == 1);
+
+    // Queued packets are counted when they are flushed
+    clientSocket.queue(packet);
+    clientSocket.queue(packet);
+    clientSocket.queue(packet);
+    CHECK(clientSocket.getStatistics().messagesSent == 2);
+    REQUIRE(clientSocket.flush() == sf::Socket::Status::Done);
+    CHECK(clientSocket.getStatistics().messagesSent == 5);
+    CHECK(clientSocket.getStatistics().bytesSent == 5 * packetBytes);
+
+    // The global statistics add up the traffic of all the sockets
+    const sf::Socket::Statistics global = sf::Socket::getGlobalStatistics();
+    CHECK(global.bytesSent == 5 * packetBytes);
+    CHECK(global.messagesSent == 5);
+    CHECK(global.messagesReceived == 2);
+    CHECK(global.notReadyReceives == 1);
+
+    sf::Socket::setGlobalStatisticsEnabled(false);
+    REQUIRE(clientSocket.send(packet) == sf::Socket::Status::Done);
+    CHECK(sf::Socket::getGlobalStatistics().messagesSent == 5);
+    CHECK(clientSocket.getStatistics().messagesSent == 6);
+
+    clientSocket.resetStatistics();
+    CHECK(clientSocket.getStatistics().bytesSent == 0);
+    CHECK(clientSocket.getStatistics().messagesSent == 0);
 }
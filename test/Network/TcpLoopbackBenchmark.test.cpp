@@ -0,0 +1,204 @@
+#include <SFML/Network/IpAddress.hpp>
+#include <SFML/Network/Packet.hpp>
+#include <SFML/Network/TcpListener.hpp>
+#include <SFML/Network/TcpSocket.hpp>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <NetworkUtil.hpp>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cstddef>
+#include <cstring>
+
+namespace
+{
+struct Connection
+{
+    Connection()
+    {
+        REQUIRE(listener.listen(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+        REQUIRE(client.connect(sf::IpAddress::LocalHost, listener.getLocalPort()) == sf::Socket::Status::Done);
+        REQUIRE(listener.accept(server) == sf::Socket::Status::Done);
+    }
+
+    // Send from another thread, the packet doesn't fit in the socket buffers
+    sf::Socket::Status transfer(sf::Packet& sent, sf::Packet& received)
+    {
+        auto        sendStatus = sf::Socket::Status::Error;
+        std::thread sender([&] { sendStatus = client.send(sent); });
+        const auto  receiveStatus = server.receive(received);
+        sender.join();
+        return sendStatus == sf::Socket::Status::Done ? receiveStatus : sendStatus;
+    }
+
+    sf::TcpListener listener;
+    sf::TcpSocket   client;
+    sf::TcpSocket   server;
+};
+
+sf::Packet makePacket(std::size_t size)
+{
+    std::vector<unsigned char> data(size);
+    std::iota(data.begin(), data.end(), static_cast<unsigned char>(0));
+
+    sf::Packet packet;
+    packet.append(data.data(), data.size());
+    return packet;
+}
+
+class CopyingPacket : public sf::Packet
+{
+    void onReceive(const void* data, std::size_t size) override
+    {
+        ++receiveCount;
+        append(data, size);
+    }
+
+public:
+    int receiveCount{};
+};
+} // namespace
+
+TEST_CASE("[Network] sf::TcpSocket Packet Loopback", runLoopbackTests())
+{
+    Connection connection;
+
+    SECTION("Large packet")
+    {
+        auto       sent = makePacket(3 * 1024 * 1024 + 17);
+        sf::Packet received;
+        REQUIRE(connection.transfer(sent, received) == sf::Socket::Status::Done);
+        CHECK(received.getDataSize() == sent.getDataSize());
+        CHECK(std::memcmp(received.getData(), sent.getData(), sent.getDataSize()) == 0);
+    }
+
+    SECTION("Consecutive packets")
+    {
+        for (const std::size_t size : {1u, 100'000u, 0u, 2'000'000u})
+        {
+            auto       sent = makePacket(size);
+            sf::Packet received;
+            REQUIRE(connection.transfer(sent, received) == sf::Socket::Status::Done);
+            CHECK(received.getDataSize() == size);
+            CHECK(received.endOfPacket() == (size == 0));
+        }
+    }
+
+    SECTION("Overridden onReceive")
+    {
+        auto          sent = makePacket(1024 * 1024);
+        CopyingPacket received;
+        REQUIRE(connection.transfer(sent, received) == sf::Socket::Status::Done);
+        CHECK(received.receiveCount == 1);
+        CHECK(received.getDataSize() == sent.getDataSize());
+        CHECK(std::memcmp(received.getData(), sent.getData(), sent.getDataSize()) == 0);
+    }
+
+    SECTION("Queued packets")
+    {
+        // More packets than a single gathering call can take
+        std::vector<sf::Packet> sent;
+        for (std::size_t i = 0; i < 500; ++i)
+            sent.push_back(makePacket((i * 37) % 300));
+        sent.push_back(makePacket(2'000'000));
+
+        for (auto& packet : sent)
+            connection.client.queue(packet);
+
+        auto        flushStatus = sf::Socket::Status::Error;
+        std::thread sender([&] { flushStatus = connection.client.flush(); });
+        for (const auto& packet : sent)
+        {
+            sf::Packet received;
+            REQUIRE(connection.server.receive(received) == sf::Socket::Status::Done);
+            REQUIRE(received.getDataSize() == packet.getDataSize());
+            CHECK(std::memcmp(received.getData(), packet.getData(), packet.getDataSize()) == 0);
+        }
+        sender.join();
+        CHECK(flushStatus == sf::Socket::Status::Done);
+        CHECK(connection.client.flush() == sf::Socket::Status::Done);
+    }
+
+    SECTION("Non-blocking flush")
+    {
+        std::vector<sf::Packet> sent;
+        for (const std::size_t size : {3'000'000u, 5u, 4'000'000u, 0u})
+            sent.push_back(makePacket(size));
+
+        connection.client.setBlocking(false);
+        for (auto& packet : sent)
+            connection.client.queue(packet);
+
+        // Catch2 assertions aren't thread-safe, only record the outcome here
+        bool        receivedAll = true;
+        std::thread receiver(
+            [&]
+            {
+                for (const auto& packet : sent)
+                {
+                    sf::Packet received;
+                    receivedAll = receivedAll && connection.server.receive(received) == sf::Socket::Status::Done &&
+                                  received.getDataSize() == packet.getDataSize() &&
+                                  std::memcmp(received.getData(), packet.getData(), packet.getDataSize()) == 0;
+                }
+            });
+
+        auto status = connection.client.flush();
+        while ((status == sf::Socket::Status::Partial) || (status == sf::Socket::Status::NotReady))
+        {
+            std::this_thread::yield();
+            status = connection.client.flush();
+        }
+        receiver.join();
+        CHECK(status == sf::Socket::Status::Done);
+        CHECK(receivedAll);
+    }
+}
+
+TEST_CASE("[Network] sf::TcpSocket Packet Throughput", runLoopbackTests() + "[.benchmark]")
+{
+    Connection connection;
+
+    for (const std::size_t size : {1024u, 64u * 1024, 1024u * 1024, 16u * 1024 * 1024})
+    {
+        auto       sent = makePacket(size);
+        sf::Packet received;
+
+        BENCHMARK(std::to_string(size) + " byte packet")
+        {
+            return connection.transfer(sent, received);
+        };
+    }
+
+    // Many small packets, as in a game server broadcasting state updates
+    std::vector<sf::Packet> updates(1000, makePacket(32));
+    sf::Packet              received;
+
+    const auto receiveAll = [&]
+    {
+        for (std::size_t i = 0; i < updates.size(); ++i)
+            (void)connection.server.receive(received);
+    };
+
+    BENCHMARK("1000 small packets, one send each")
+    {
+        std::thread receiver(receiveAll);
+        for (auto& packet : updates)
+            (void)connection.client.send(packet);
+        receiver.join();
+    };
+
+    BENCHMARK("1000 small packets, queued and flushed")
+    {
+        std::thread receiver(receiveAll);
+        for (auto& packet : updates)
+            connection.client.queue(packet);
+        (void)connection.client.flush();
+        receiver.join();
+    };
+}
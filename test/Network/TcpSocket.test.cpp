@@ -6,6 +6,7 @@
 #include <catch2/catch_test_macros.hpp>
 
 #include <NetworkUtil.hpp>
+#include <optional>
 #include <type_traits>
 
 TEST_CASE("[Network] sf::TcpSocket")
@@ -25,6 +26,29 @@ TEST_CASE("[Network] sf::TcpSocket")
         CHECK_FALSE(tcpSocket.getRemoteAddress().has_value());
         CHECK(tcpSocket.getRemotePort() == 0);
         CHECK_FALSE(tcpSocket.getCurrentCiphersuiteName().has_value());
+        CHECK(tcpSocket.isNoDelay());
+        CHECK_FALSE(tcpSocket.getLinger().has_value());
+        CHECK_FALSE(tcpSocket.getKeepAlive().has_value());
+        CHECK(tcpSocket.getBusyPoll() == sf::Time::Zero);
+    }
+
+    SECTION("Set/get options")
+    {
+        sf::TcpSocket tcpSocket;
+        tcpSocket.setNoDelay(false);
+        CHECK_FALSE(tcpSocket.isNoDelay());
+
+        tcpSocket.setLinger(sf::Time::Zero);
+        CHECK(tcpSocket.getLinger() == sf::Time::Zero);
+
+        tcpSocket.setKeepAlive(sf::TcpSocket::KeepAlive{sf::seconds(30), sf::seconds(5), 3});
+        REQUIRE(tcpSocket.getKeepAlive().has_value());
+        CHECK(tcpSocket.getKeepAlive()->idle == sf::seconds(30));
+        CHECK(tcpSocket.getKeepAlive()->interval == sf::seconds(5));
+        CHECK(tcpSocket.getKeepAlive()->probeCount == 3);
+
+        tcpSocket.setKeepAlive(std::nullopt);
+        CHECK_FALSE(tcpSocket.getKeepAlive().has_value());
     }
 }
 
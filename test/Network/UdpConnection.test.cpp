@@ -0,0 +1,362 @@
+#include <SFML/Network/Packet.hpp>
+#include <SFML/Network/UdpConnection.hpp>
+#include <SFML/Network/UdpSocket.hpp>
+
+#include <SFML/System/Clock.hpp>
+#include <SFML/System/Sleep.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <NetworkUtil.hpp>
+#include <SystemUtil.hpp>
+#include <functional>
+#include <set>
+#include <type_traits>
+#include <vector>
+
+#include <cstdint>
+
+namespace
+{
+// Update both peers until the condition holds, giving up after a few seconds
+bool updateUntil(sf::UdpConnection& first, sf::UdpConnection& second, const std::function<bool()>& condition)
+{
+    const sf::Clock clock;
+    while (clock.getElapsedTime() < sf::seconds(10))
+    {
+        first.update();
+        second.update();
+
+        if (condition())
+            return true;
+
+        sf::sleep(sf::milliseconds(1));
+    }
+
+    return false;
+}
+
+// Build a message whose bytes depend on its number
+sf::Packet makeMessage(std::uint32_t number, std::size_t size)
+{
+    sf::Packet packet;
+    packet << number;
+    for (std::size_t i = 0; i < size; ++i)
+        packet << static_cast<std::uint8_t>(number + i);
+    return packet;
+}
+
+// Check that a message was built by makeMessage, and get its number
+bool readMessage(sf::Packet& packet, std::uint32_t& number, std::size_t size)
+{
+    if (!(packet >> number) || (packet.getDataSize() != sizeof(number) + size))
+        return false;
+
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        std::uint8_t value = 0;
+        if (!(packet >> value) || (value != static_cast<std::uint8_t>(number + i)))
+            return false;
+    }
+
+    return true;
+}
+
+// Size of the messages sent by the simulated loss test
+std::size_t getLossyMessageSize(std::uint32_t number)
+{
+    return (number % 20 == 0) ? 5000 : number;
+}
+} // namespace
+
+TEST_CASE("[Network] sf::UdpConnection")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::UdpConnection>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::UdpConnection>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::UdpConnection>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::UdpConnection>);
+        STATIC_CHECK(std::is_aggregate_v<sf::UdpConnection::Statistics>);
+    }
+
+    SECTION("Constants")
+    {
+        STATIC_CHECK(sf::UdpConnection::FragmentSize == 1024);
+        STATIC_CHECK(sf::UdpConnection::MaxMessageSize == 1024 * 65535);
+    }
+
+    SECTION("Construction")
+    {
+        sf::UdpConnection connection;
+        CHECK(connection.getState() == sf::UdpConnection::State::Disconnected);
+        CHECK(connection.getLocalPort() == 0);
+        CHECK(!connection.getRemoteAddress().has_value());
+        CHECK(connection.getRemotePort() == 0);
+        CHECK(connection.getTimeout() == sf::seconds(10));
+        CHECK(connection.getSimulatedLoss() == 0.f);
+
+        const sf::UdpConnection::Statistics statistics = connection.getStatistics();
+        CHECK(statistics.messagesSent == 0);
+        CHECK(statistics.messagesReceived == 0);
+        CHECK(statistics.fragmentsSent == 0);
+        CHECK(statistics.datagramsSent == 0);
+        CHECK(statistics.roundTripTime == sf::Time::Zero);
+
+        sf::Packet packet;
+        CHECK(connection.send(packet, sf::UdpConnection::Channel::ReliableOrdered) == sf::Socket::Status::Disconnected);
+        CHECK(connection.receive(packet) == sf::Socket::Status::Disconnected);
+    }
+
+    SECTION("Set/get timeout")
+    {
+        sf::UdpConnection connection;
+        connection.setTimeout(sf::milliseconds(500));
+        CHECK(connection.getTimeout() == sf::milliseconds(500));
+    }
+
+    SECTION("Set/get simulated loss")
+    {
+        sf::UdpConnection connection;
+        connection.setSimulatedLoss(0.25f);
+        CHECK(connection.getSimulatedLoss() == 0.25f);
+        connection.setSimulatedLoss(2.f);
+        CHECK(connection.getSimulatedLoss() == 1.f);
+        connection.setSimulatedLoss(-1.f);
+        CHECK(connection.getSimulatedLoss() == 0.f);
+    }
+
+    SECTION("listen()")
+    {
+        sf::UdpConnection connection;
+        REQUIRE(connection.listen(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+        CHECK(connection.getState() == sf::UdpConnection::State::Listening);
+        CHECK(connection.getLocalPort() != 0);
+        CHECK(connection.getSocket().getLocalPort() == connection.getLocalPort());
+
+        // Nothing can be sent before a peer connects
+        sf::Packet packet;
+        CHECK(connection.send(packet, sf::UdpConnection::Channel::Unreliable) == sf::Socket::Status::Disconnected);
+        CHECK(connection.receive(packet) == sf::Socket::Status::NotReady);
+
+        connection.disconnect();
+        CHECK(connection.getState() == sf::UdpConnection::State::Disconnected);
+        CHECK(connection.getLocalPort() == 0);
+    }
+}
+
+TEST_CASE("[Network] sf::UdpConnection Loopback", runLoopbackTests())
+{
+    using Channel = sf::UdpConnection::Channel;
+    using State   = sf::UdpConnection::State;
+
+    sf::UdpConnection server;
+    REQUIRE(server.listen(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+
+    sf::UdpConnection client;
+    REQUIRE(client.connect(sf::IpAddress::LocalHost, server.getLocalPort()) == sf::Socket::Status::Done);
+    CHECK(client.getState() == State::Connecting);
+    CHECK(client.getRemoteAddress() == sf::IpAddress::LocalHost);
+    CHECK(client.getRemotePort() == server.getLocalPort());
+
+    // Messages sent while connecting wait for the handshake
+    sf::Packet packet = makeMessage(0, 16);
+    REQUIRE(client.send(packet, Channel::ReliableOrdered) == sf::Socket::Status::Done);
+
+    const auto isConnected = [&]
+    { return (client.getState() == State::Connected) && (server.getState() == State::Connected); };
+    REQUIRE(updateUntil(client, server, isConnected));
+    CHECK(server.getRemoteAddress() == sf::IpAddress::LocalHost);
+    CHECK(server.getRemotePort() == client.getLocalPort());
+
+    std::uint32_t number = 0;
+    REQUIRE(updateUntil(client, server, [&] { return server.receive(packet) == sf::Socket::Status::Done; }));
+    CHECK(readMessage(packet, number, 16));
+    CHECK(number == 0);
+
+    SECTION("Channels")
+    {
+        for (const Channel channel : {Channel::Unreliable, Channel::ReliableUnordered, Channel::ReliableOrdered})
+        {
+            packet = makeMessage(static_cast<std::uint32_t>(channel), 100);
+            REQUIRE(server.send(packet, channel) == sf::Socket::Status::Done);
+
+            Channel received{};
+            const auto isReceived = [&] { return client.receive(packet, received) == sf::Socket::Status::Done; };
+            REQUIRE(updateUntil(client, server, isReceived));
+            CHECK(received == channel);
+            CHECK(readMessage(packet, number, 100));
+            CHECK(number == static_cast<std::uint32_t>(channel));
+        }
+
+        // Empty messages are delivered too
+        packet.clear();
+        REQUIRE(client.send(packet, Channel::ReliableUnordered) == sf::Socket::Status::Done);
+        packet << std::uint32_t{1};
+        REQUIRE(updateUntil(client, server, [&] { return server.receive(packet) == sf::Socket::Status::Done; }));
+        CHECK(packet.getDataSize() == 0);
+
+        const sf::UdpConnection::Statistics statistics = server.getStatistics();
+        CHECK(statistics.messagesSent == 3);
+        CHECK(statistics.messagesReceived == 2);
+        CHECK(statistics.datagramsSent > 0);
+        CHECK(statistics.datagramsReceived > 0);
+    }
+
+    SECTION("Fragmentation")
+    {
+        // Larger than a datagram, with a last fragment only partially filled
+        constexpr std::size_t unreliableSize = 10 * sf::UdpConnection::FragmentSize + 123;
+        constexpr std::size_t reliableSize   = 100 * sf::UdpConnection::FragmentSize + 123;
+
+        packet = makeMessage(7, unreliableSize);
+        REQUIRE(client.send(packet, Channel::Unreliable) == sf::Socket::Status::Done);
+        REQUIRE(updateUntil(client, server, [&] { return server.receive(packet) == sf::Socket::Status::Done; }));
+        CHECK(readMessage(packet, number, unreliableSize));
+        CHECK(number == 7);
+
+        packet = makeMessage(8, reliableSize);
+        REQUIRE(client.send(packet, Channel::ReliableOrdered) == sf::Socket::Status::Done);
+        REQUIRE(updateUntil(client, server, [&] { return server.receive(packet) == sf::Socket::Status::Done; }));
+        CHECK(readMessage(packet, number, reliableSize));
+        CHECK(number == 8);
+
+        CHECK(client.getStatistics().fragmentsSent > 110);
+    }
+
+    SECTION("Simulated loss")
+    {
+        client.setSimulatedLoss(0.3f);
+        server.setSimulatedLoss(0.3f);
+
+        // Reliable messages of all sizes survive the loss of their datagrams, and of the acks
+        constexpr std::uint32_t count = 200;
+        for (std::uint32_t i = 0; i < count; ++i)
+        {
+            const std::size_t size = getLossyMessageSize(i);
+
+            packet = makeMessage(i, size);
+            REQUIRE(client.send(packet, Channel::ReliableOrdered) == sf::Socket::Status::Done);
+            packet = makeMessage(i, size);
+            REQUIRE(client.send(packet, Channel::ReliableUnordered) == sf::Socket::Status::Done);
+            packet = makeMessage(i, size);
+            REQUIRE(client.send(packet, Channel::Unreliable) == sf::Socket::Status::Done);
+        }
+
+        std::uint32_t           nextOrdered = 0;
+        std::set<std::uint32_t> unordered;
+        std::set<std::uint32_t> unreliable;
+        bool                    valid = true;
+
+        const bool done = updateUntil(client,
+                                      server,
+                                      [&]
+                                      {
+                                          Channel channel{};
+                                          while (server.receive(packet, channel) == sf::Socket::Status::Done)
+                                          {
+                                              const std::size_t size = packet.getDataSize() - sizeof(number);
+                                              std::uint32_t     received = 0;
+                                              valid = valid && readMessage(packet, received, size) &&
+                                                      (size == getLossyMessageSize(received));
+
+                                              if (channel == Channel::ReliableOrdered)
+                                                  valid = valid && (received == nextOrdered++);
+                                              else if (channel == Channel::ReliableUnordered)
+                                                  valid = valid && unordered.insert(received).second;
+                                              else
+                                                  unreliable.insert(received);
+                                          }
+
+                                          return (nextOrdered == count) && (unordered.size() == count);
+                                      });
+
+        CHECK(done);
+        CHECK(valid);
+        CHECK(unreliable.size() < count);
+
+        const sf::UdpConnection::Statistics clientStatistics = client.getStatistics();
+        CHECK(clientStatistics.datagramsDropped > 0);
+        CHECK(clientStatistics.fragmentsRetransmitted > 0);
+        CHECK(clientStatistics.roundTripTime > sf::Time::Zero);
+        CHECK(server.getStatistics().datagramsDropped > 0);
+        CHECK(client.getState() == State::Connected);
+        CHECK(server.getState() == State::Connected);
+    }
+
+    SECTION("disconnect()")
+    {
+        packet = makeMessage(1, 16);
+        REQUIRE(client.send(packet, Channel::ReliableOrdered) == sf::Socket::Status::Done);
+        client.update();
+        client.disconnect();
+        CHECK(client.getState() == State::Disconnected);
+        CHECK(client.send(packet, Channel::ReliableOrdered) == sf::Socket::Status::Disconnected);
+
+        // Messages received before the disconnection can still be read
+        REQUIRE(updateUntil(client, server, [&] { return server.getState() == State::Disconnected; }));
+        CHECK(server.receive(packet) == sf::Socket::Status::Done);
+        CHECK(server.receive(packet) == sf::Socket::Status::Disconnected);
+    }
+
+    SECTION("Timeout")
+    {
+        server.setTimeout(sf::milliseconds(200));
+        client.setSimulatedLoss(1.f);
+
+        REQUIRE(updateUntil(client, server, [&] { return server.getState() == State::Disconnected; }));
+        CHECK(server.receive(packet) == sf::Socket::Status::Disconnected);
+    }
+}
+
+TEST_CASE("[Network] sf::UdpConnection Handshake Loopback", runLoopbackTests())
+{
+    using State = sf::UdpConnection::State;
+
+    sf::UdpConnection server;
+    sf::UdpConnection client;
+
+    SECTION("Lossy handshake")
+    {
+        REQUIRE(server.listen(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+        client.setSimulatedLoss(0.5f);
+        server.setSimulatedLoss(0.5f);
+
+        REQUIRE(client.connect(sf::IpAddress::LocalHost, server.getLocalPort()) == sf::Socket::Status::Done);
+        const auto isConnected = [&]
+        { return (client.getState() == State::Connected) && (server.getState() == State::Connected); };
+        REQUIRE(updateUntil(client, server, isConnected));
+    }
+
+    SECTION("Nobody listening")
+    {
+        // Find a port without a listener
+        sf::UdpSocket socket;
+        REQUIRE(socket.bind(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+        const unsigned short port = socket.getLocalPort();
+        socket.unbind();
+
+        client.setTimeout(sf::milliseconds(200));
+        REQUIRE(client.connect(sf::IpAddress::LocalHost, port) == sf::Socket::Status::Done);
+        REQUIRE(updateUntil(client, server, [&] { return client.getState() == State::Disconnected; }));
+
+        sf::Packet packet;
+        CHECK(client.receive(packet) == sf::Socket::Status::Disconnected);
+    }
+
+    SECTION("Reconnection")
+    {
+        REQUIRE(server.listen(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+        const unsigned short port = server.getLocalPort();
+
+        for (int i = 0; i < 2; ++i)
+        {
+            REQUIRE(client.connect(sf::IpAddress::LocalHost, port) == sf::Socket::Status::Done);
+            REQUIRE(updateUntil(client, server, [&] { return server.getState() == State::Connected; }));
+
+            client.disconnect();
+            REQUIRE(updateUntil(client, server, [&] { return server.getState() == State::Disconnected; }));
+            REQUIRE(server.listen(port, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+        }
+    }
+}
@@ -1,8 +1,21 @@
 #include <SFML/Network/UdpSocket.hpp>
 
+// Other 1st party headers
+#include <SFML/Network/SocketSelector.hpp>
+
+#include <SFML/System/Time.hpp>
+
 #include <catch2/catch_test_macros.hpp>
 
+#include <NetworkUtil.hpp>
+#include <algorithm>
+#include <array>
+#include <optional>
 #include <type_traits>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
 
 TEST_CASE("[Network] sf::UdpSocket")
 {
@@ -35,4 +48,265 @@ TEST_CASE("[Network] sf::UdpSocket")
         udpSocket.unbind();
         CHECK(udpSocket.getLocalPort() == 0);
     }
+
+#if !defined(SFML_SYSTEM_WINDOWS)
+    SECTION("setReusePort()")
+    {
+        sf::UdpSocket udpSocket;
+        udpSocket.setReusePort(true);
+        CHECK(udpSocket.isReusePort());
+        REQUIRE(udpSocket.bind(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+
+        sf::UdpSocket other;
+        other.setReusePort(true);
+        CHECK(other.bind(udpSocket.getLocalPort(), sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+    }
+#endif
+
+    SECTION("send()")
+    {
+        // A socket bound to an IPv4 address can't reach IPv6 peers
+        sf::UdpSocket       udpSocket;
+        std::array<char, 1> data{};
+        REQUIRE(udpSocket.bind(sf::Socket::AnyPort) == sf::Socket::Status::Done);
+        CHECK(udpSocket.send(data.data(), data.size(), sf::IpAddress::LocalHostV6, 9) == sf::Socket::Status::Error);
+    }
+}
+
+TEST_CASE("[Network] sf::UdpSocket IPv6 Loopback", runLoopbackTests())
+{
+    const std::array<char, 4>    data{'I', 'P', 'v', '6'};
+    std::array<char, 16>         buffer{};
+    std::size_t                  received = 0;
+    std::optional<sf::IpAddress> remoteAddress;
+    unsigned short               remotePort = 0;
+
+    sf::UdpSocket receiver;
+    REQUIRE(receiver.bind(sf::Socket::AnyPort, sf::IpAddress::AnyV6) == sf::Socket::Status::Done);
+    CHECK(receiver.getLocalPort() != 0);
+
+    SECTION("IPv6 sender")
+    {
+        sf::UdpSocket sender;
+        REQUIRE(sender.bind(sf::Socket::AnyPort, sf::IpAddress::LocalHostV6) == sf::Socket::Status::Done);
+        REQUIRE(sender.send(data.data(), data.size(), sf::IpAddress::LocalHostV6, receiver.getLocalPort()) ==
+                sf::Socket::Status::Done);
+
+        REQUIRE(receiver.receive(buffer.data(), buffer.size(), received, remoteAddress, remotePort) ==
+                sf::Socket::Status::Done);
+        CHECK(received == data.size());
+        CHECK(remoteAddress == sf::IpAddress::LocalHostV6);
+        CHECK(remotePort == sender.getLocalPort());
+
+        // Replies go back over IPv6
+        REQUIRE(receiver.send(data.data(), data.size(), *remoteAddress, remotePort) == sf::Socket::Status::Done);
+        REQUIRE(sender.receive(buffer.data(), buffer.size(), received, remoteAddress, remotePort) ==
+                sf::Socket::Status::Done);
+        CHECK(remoteAddress == sf::IpAddress::LocalHostV6);
+        CHECK(remotePort == receiver.getLocalPort());
+    }
+
+    SECTION("IPv4 sender on a dual-stack socket")
+    {
+        sf::UdpSocket sender;
+        REQUIRE(sender.send(data.data(), data.size(), sf::IpAddress::LocalHost, receiver.getLocalPort()) ==
+                sf::Socket::Status::Done);
+
+        REQUIRE(receiver.receive(buffer.data(), buffer.size(), received, remoteAddress, remotePort) ==
+                sf::Socket::Status::Done);
+        CHECK(received == data.size());
+        CHECK(remoteAddress == sf::IpAddress::LocalHost);
+        CHECK(remotePort == sender.getLocalPort());
+
+        // Replies to IPv4 peers are mapped by the dual-stack socket
+        REQUIRE(receiver.send(data.data(), data.size(), *remoteAddress, remotePort) == sf::Socket::Status::Done);
+        REQUIRE(sender.receive(buffer.data(), buffer.size(), received, remoteAddress, remotePort) ==
+                sf::Socket::Status::Done);
+        CHECK(remoteAddress == sf::IpAddress::LocalHost);
+    }
+
+    SECTION("Batch send and receive")
+    {
+        sf::UdpSocket                          sender;
+        std::array<sf::UdpSocket::Datagram, 3> datagrams{};
+        for (auto& datagram : datagrams)
+            datagram = {reinterpret_cast<const std::byte*>(data.data()),
+                        data.size(),
+                        sf::IpAddress::LocalHostV6,
+                        receiver.getLocalPort()};
+
+        std::size_t sent = 0;
+        REQUIRE(sender.send(datagrams.data(), datagrams.size(), sent) == sf::Socket::Status::Done);
+        CHECK(sent == datagrams.size());
+
+        std::array<std::byte, 64>              arena{};
+        std::array<sf::UdpSocket::Datagram, 3> batch{};
+        std::size_t                            total = 0;
+        while (total < datagrams.size())
+        {
+            std::size_t count = 0;
+            REQUIRE(receiver.receive(arena.data(), arena.size(), batch.data(), batch.size(), count) ==
+                    sf::Socket::Status::Done);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                CHECK(batch[i].remoteAddress == sf::IpAddress::LocalHostV6);
+                CHECK(batch[i].size == data.size());
+            }
+            total += count;
+        }
+    }
+}
+
+TEST_CASE("[Network] sf::UdpSocket Batch Loopback", runLoopbackTests())
+{
+    sf::UdpSocket receiver;
+    REQUIRE(receiver.bind(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+
+    sf::UdpSocket sender;
+    REQUIRE(sender.bind(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+
+    // More datagrams than a single system call handles
+    constexpr std::size_t                count = 150;
+    std::vector<std::vector<std::byte>>  payloads(count);
+    std::vector<sf::UdpSocket::Datagram> datagrams(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        payloads[i].assign(i % 100 + 1, static_cast<std::byte>(i));
+        datagrams[i] = {payloads[i].data(), payloads[i].size(), sf::IpAddress::LocalHost, receiver.getLocalPort()};
+    }
+
+    SECTION("Invalid parameters")
+    {
+        const sf::UdpSocket::Datagram tooLarge{payloads[0].data(),
+                                               sf::UdpSocket::MaxDatagramSize + 1,
+                                               sf::IpAddress::LocalHost,
+                                               receiver.getLocalPort()};
+
+        std::size_t sent = 0;
+        CHECK(sender.send(&tooLarge, 1, sent) == sf::Socket::Status::Error);
+        CHECK(sent == 0);
+
+        std::array<std::byte, 16> arena{};
+        std::size_t               received = 0;
+        CHECK(receiver.receive(arena.data(), arena.size(), datagrams.data(), 0, received) == sf::Socket::Status::Error);
+        CHECK(receiver.receive(nullptr, 1024, datagrams.data(), 1, received) == sf::Socket::Status::Error);
+        CHECK(received == 0);
+    }
+
+    SECTION("Send and receive")
+    {
+        std::size_t sent = 0;
+        REQUIRE(sender.send(datagrams.data(), datagrams.size(), sent) == sf::Socket::Status::Done);
+        CHECK(sent == count);
+
+        std::vector<std::byte>               arena(64 * 128);
+        std::vector<sf::UdpSocket::Datagram> received(64);
+        std::size_t                          total = 0;
+        while (total < count)
+        {
+            std::size_t batch = 0;
+            REQUIRE(receiver.receive(arena.data(), arena.size(), received.data(), received.size(), batch) ==
+                    sf::Socket::Status::Done);
+            REQUIRE(batch > 0);
+            REQUIRE(total + batch <= count);
+
+            for (std::size_t i = 0; i < batch; ++i, ++total)
+            {
+                const auto& datagram = received[i];
+                CHECK(datagram.remoteAddress == sf::IpAddress::LocalHost);
+                CHECK(datagram.remotePort == sender.getLocalPort());
+                REQUIRE(datagram.size == payloads[total].size());
+                CHECK(datagram.data >= arena.data());
+                CHECK(datagram.data + datagram.size <= arena.data() + arena.size());
+                CHECK(std::equal(datagram.data, datagram.data + datagram.size, payloads[total].begin()));
+            }
+        }
+    }
+
+    SECTION("Oversized datagrams")
+    {
+        // A single slot of 32 bytes, which the 100-byte datagram doesn't fit in
+        std::array<std::byte, 32>              arena{};
+        std::array<sf::UdpSocket::Datagram, 1> received{};
+        std::size_t                            batch = 0;
+        std::size_t                            sent  = 0;
+        REQUIRE(sender.send(&datagrams[99], 1, sent) == sf::Socket::Status::Done);
+
+        SECTION("Blocking")
+        {
+            REQUIRE(sender.send(&datagrams[0], 1, sent) == sf::Socket::Status::Done);
+
+            // The oversized datagram is dropped and the receive keeps waiting for the next one
+            REQUIRE(receiver.receive(arena.data(), arena.size(), received.data(), received.size(), batch) ==
+                    sf::Socket::Status::Done);
+            REQUIRE(batch == 1);
+            CHECK(received[0].size == payloads[0].size());
+            CHECK(received[0].data[0] == payloads[0][0]);
+        }
+
+        SECTION("Non-blocking")
+        {
+            // Make sure the oversized datagram has arrived before receiving without waiting
+            sf::SocketSelector selector;
+            selector.add(receiver);
+            REQUIRE(selector.wait(sf::seconds(1)));
+
+            receiver.setBlocking(false);
+            CHECK(receiver.receive(arena.data(), arena.size(), received.data(), received.size(), batch) ==
+                  sf::Socket::Status::NotReady);
+            CHECK(batch == 0);
+        }
+    }
+
+    SECTION("Non-blocking receive")
+    {
+        receiver.setBlocking(false);
+
+        std::array<std::byte, 1024>            arena{};
+        std::array<sf::UdpSocket::Datagram, 8> received{};
+        std::size_t                            batch = 0;
+        CHECK(receiver.receive(arena.data(), arena.size(), received.data(), received.size(), batch) ==
+              sf::Socket::Status::NotReady);
+        CHECK(batch == 0);
+        CHECK(receiver.getStatistics().notReadyReceives == 1);
+    }
+
+    SECTION("Statistics")
+    {
+        std::size_t sent = 0;
+        REQUIRE(sender.send(datagrams.data(), datagrams.size(), sent) == sf::Socket::Status::Done);
+
+        std::uint64_t bytes = 0;
+        for (const auto& payload : payloads)
+            bytes += payload.size();
+
+        const sf::Socket::Statistics senderStatistics = sender.getStatistics();
+        CHECK(senderStatistics.messagesSent == count);
+        CHECK(senderStatistics.bytesSent == bytes);
+        CHECK(senderStatistics.sendCalls >= 1);
+        CHECK(senderStatistics.sendCalls <= count);
+
+        std::vector<std::byte>               arena(count * 128);
+        std::vector<sf::UdpSocket::Datagram> received(count);
+        std::size_t                          total = 0;
+        while (total < count)
+        {
+            std::size_t batch = 0;
+            REQUIRE(receiver.receive(arena.data(), arena.size(), received.data(), received.size(), batch) ==
+                    sf::Socket::Status::Done);
+            total += batch;
+        }
+
+        const sf::Socket::Statistics receiverStatistics = receiver.getStatistics();
+        CHECK(receiverStatistics.messagesReceived == count);
+        CHECK(receiverStatistics.bytesReceived == bytes);
+        CHECK(receiverStatistics.receiveCalls >= 1);
+
+        // Single datagrams are counted as well
+        const std::array<std::byte, 8> data{};
+        REQUIRE(sender.send(data.data(), data.size(), sf::IpAddress::LocalHost, receiver.getLocalPort()) ==
+                sf::Socket::Status::Done);
+        CHECK(sender.getStatistics().messagesSent == count + 1);
+        CHECK(sender.getStatistics().bytesSent == bytes + data.size());
+    }
 }